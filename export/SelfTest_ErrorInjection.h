@@ -73,4 +73,8 @@
 #define ERROR_IN_MOTIF                                      0u
 #define ERROR_IN_CORDIC                                     0u
 #define ERROR_IN_ECC                                        0u
+#define ERROR_IN_CRC                                        0u
+#define ERROR_IN_CONF_REG_MONITOR                           0u
+#define ERROR_IN_FLOW_MONITOR                               0u
+#define ERROR_IN_MULTI_CORE                                 0u
 #endif /* SELFTESTERRORINJECTION_H */
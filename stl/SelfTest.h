@@ -40,10 +40,15 @@
 #include "cy_pdl.h"
 #include "SelfTest_Analog.h"
 #include "SelfTest_Clock.h"
+#include "SelfTest_Clock_CSV.h"
+#include "SelfTest_Clock_Engine.h"
+#include "SelfTest_Clock_Trend.h"
 #include "SelfTest_ConfigRegisters.h"
 #include "SelfTest_CPU.h"
 #include "SelfTest_CPU_Regs.h"
+#include "SelfTest_Flow_Monitor.h"
 #include "SelfTest_CRC_calc.h"
+#include "SelfTest_CRC_Engine.h"
 #include "SelfTest_Flash.h"
 #include "SelfTest_I2C_SCB.h"
 #include "SelfTest_Interrupt.h"
@@ -63,6 +68,7 @@
 #include "SelfTest_FPU_Regs.h"
 #include "SelfTest_DMA_DW.h"
 #include "SelfTest_IPC.h"
+#include "SelfTest_MultiCore.h"
 #include "SelfTest_Motif.h"
 #include "SelfTest_Cordic.h"
 #include "SelfTest_ECC.h"
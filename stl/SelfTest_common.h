@@ -96,6 +96,9 @@
 /* Clock Self-Test return status */
 #define ERROR_INCORRECT_USAGE_STATUS    (4u)
 
+/* Clock drift trend return status: the filtered deviation reached the warning threshold */
+#define CLOCK_DRIFT_WARNING_STATUS      (5u)
+
 /* Startup Configuration Registers Self-Test return status */
 /* If this status flag is true then CRC already saved */
 #define CRC_SAVED_STATUS                (2u)
@@ -742,5 +742,368 @@ __test_asm_fail
 
     ENDFUNC
 
+
+;----------------------------------------------------------------------------------
+; SelfTest_FPU_Regs_Group_GCC
+;----------------------------------------------------------------------------------
+;
+; Summary:
+;   This function performs checkerboard test for one group of FPU registers:
+;   0 - D0 to D3, 1 - D4 to D7, 2 - D8 to D11, 3 - D12 to D15, 4 - FPSCR.
+;   Each register is written through its D view and restored before the compare,
+;   so the FPU state of the application is not changed.
+;
+; Parameters:
+;   r0 - The register group number.
+;
+; Return:
+;  0 - No error
+;  Not 0 - Error detected or invalid group number
+;
+; Destroys:
+;   r0
+;----------------------------------------------------------------------------------
+
+; uint8 SelfTest_FPU_Regs_Group_GCC(uint32_t group);
+
+SelfTest_FPU_Regs_Group_GCC FUNCTION
+    EXPORT SelfTest_FPU_Regs_Group_GCC
+    PUSH      {R1-R7, LR}
+    VMRS      R1, FPSCR
+    MOV       R6, #0xAAAAAAAA
+    MOV       R7, #0x55555555
+
+    ; Branch to the register group in R0
+    CMP       R0, #0
+    BEQ       __test_fpu_grp_d0_d3
+    CMP       R0, #1
+    BEQ       __test_fpu_grp_d4_d7
+    CMP       R0, #2
+    BEQ       __test_fpu_grp_d8_d11
+    CMP       R0, #3
+    BEQ       __test_fpu_grp_d12_d15
+    CMP       R0, #4
+    BEQ       __test_fpu_grp_fpscr
+    ; Invalid group number
+    B         __test_fpu_grp_fail
+
+    ; Group 0: D0 to D3 (S0 to S7) registers
+__test_fpu_grp_d0_d3
+    ; D0 (S0, S1) registers test
+    VMOV      R4, R5, D0
+    VMOV      D0, R6, R7
+    VMOV      R2, R3, D0
+    VMOV      D0, R4, R5
+    CMP       R2, R6
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R7
+    BNE       __test_fpu_grp_fail
+    VMOV      D0, R7, R6
+    VMOV      R2, R3, D0
+    VMOV      D0, R4, R5
+    CMP       R2, R7
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R6
+    BNE       __test_fpu_grp_fail
+
+    ; D1 (S2, S3) registers test
+    VMOV      R4, R5, D1
+    VMOV      D1, R6, R7
+    VMOV      R2, R3, D1
+    VMOV      D1, R4, R5
+    CMP       R2, R6
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R7
+    BNE       __test_fpu_grp_fail
+    VMOV      D1, R7, R6
+    VMOV      R2, R3, D1
+    VMOV      D1, R4, R5
+    CMP       R2, R7
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R6
+    BNE       __test_fpu_grp_fail
+
+    ; D2 (S4, S5) registers test
+    VMOV      R4, R5, D2
+    VMOV      D2, R6, R7
+    VMOV      R2, R3, D2
+    VMOV      D2, R4, R5
+    CMP       R2, R6
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R7
+    BNE       __test_fpu_grp_fail
+    VMOV      D2, R7, R6
+    VMOV      R2, R3, D2
+    VMOV      D2, R4, R5
+    CMP       R2, R7
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R6
+    BNE       __test_fpu_grp_fail
+
+    ; D3 (S6, S7) registers test
+    VMOV      R4, R5, D3
+    VMOV      D3, R6, R7
+    VMOV      R2, R3, D3
+    VMOV      D3, R4, R5
+    CMP       R2, R6
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R7
+    BNE       __test_fpu_grp_fail
+    VMOV      D3, R7, R6
+    VMOV      R2, R3, D3
+    VMOV      D3, R4, R5
+    CMP       R2, R7
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R6
+    BNE       __test_fpu_grp_fail
+
+    B         __test_fpu_grp_ok
+
+    ; Group 1: D4 to D7 (S8 to S15) registers
+__test_fpu_grp_d4_d7
+    ; D4 (S8, S9) registers test
+    VMOV      R4, R5, D4
+    VMOV      D4, R6, R7
+    VMOV      R2, R3, D4
+    VMOV      D4, R4, R5
+    CMP       R2, R6
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R7
+    BNE       __test_fpu_grp_fail
+    VMOV      D4, R7, R6
+    VMOV      R2, R3, D4
+    VMOV      D4, R4, R5
+    CMP       R2, R7
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R6
+    BNE       __test_fpu_grp_fail
+
+    ; D5 (S10, S11) registers test
+    VMOV      R4, R5, D5
+    VMOV      D5, R6, R7
+    VMOV      R2, R3, D5
+    VMOV      D5, R4, R5
+    CMP       R2, R6
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R7
+    BNE       __test_fpu_grp_fail
+    VMOV      D5, R7, R6
+    VMOV      R2, R3, D5
+    VMOV      D5, R4, R5
+    CMP       R2, R7
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R6
+    BNE       __test_fpu_grp_fail
+
+    ; D6 (S12, S13) registers test
+    VMOV      R4, R5, D6
+    VMOV      D6, R6, R7
+    VMOV      R2, R3, D6
+    VMOV      D6, R4, R5
+    CMP       R2, R6
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R7
+    BNE       __test_fpu_grp_fail
+    VMOV      D6, R7, R6
+    VMOV      R2, R3, D6
+    VMOV      D6, R4, R5
+    CMP       R2, R7
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R6
+    BNE       __test_fpu_grp_fail
+
+    ; D7 (S14, S15) registers test
+    VMOV      R4, R5, D7
+    VMOV      D7, R6, R7
+    VMOV      R2, R3, D7
+    VMOV      D7, R4, R5
+    CMP       R2, R6
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R7
+    BNE       __test_fpu_grp_fail
+    VMOV      D7, R7, R6
+    VMOV      R2, R3, D7
+    VMOV      D7, R4, R5
+    CMP       R2, R7
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R6
+    BNE       __test_fpu_grp_fail
+
+    B         __test_fpu_grp_ok
+
+    ; Group 2: D8 to D11 (S16 to S23) registers
+__test_fpu_grp_d8_d11
+    ; D8 (S16, S17) registers test
+    VMOV      R4, R5, D8
+    VMOV      D8, R6, R7
+    VMOV      R2, R3, D8
+    VMOV      D8, R4, R5
+    CMP       R2, R6
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R7
+    BNE       __test_fpu_grp_fail
+    VMOV      D8, R7, R6
+    VMOV      R2, R3, D8
+    VMOV      D8, R4, R5
+    CMP       R2, R7
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R6
+    BNE       __test_fpu_grp_fail
+
+    ; D9 (S18, S19) registers test
+    VMOV      R4, R5, D9
+    VMOV      D9, R6, R7
+    VMOV      R2, R3, D9
+    VMOV      D9, R4, R5
+    CMP       R2, R6
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R7
+    BNE       __test_fpu_grp_fail
+    VMOV      D9, R7, R6
+    VMOV      R2, R3, D9
+    VMOV      D9, R4, R5
+    CMP       R2, R7
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R6
+    BNE       __test_fpu_grp_fail
+
+    ; D10 (S20, S21) registers test
+    VMOV      R4, R5, D10
+    VMOV      D10, R6, R7
+    VMOV      R2, R3, D10
+    VMOV      D10, R4, R5
+    CMP       R2, R6
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R7
+    BNE       __test_fpu_grp_fail
+    VMOV      D10, R7, R6
+    VMOV      R2, R3, D10
+    VMOV      D10, R4, R5
+    CMP       R2, R7
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R6
+    BNE       __test_fpu_grp_fail
+
+    ; D11 (S22, S23) registers test
+    VMOV      R4, R5, D11
+    VMOV      D11, R6, R7
+    VMOV      R2, R3, D11
+    VMOV      D11, R4, R5
+    CMP       R2, R6
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R7
+    BNE       __test_fpu_grp_fail
+    VMOV      D11, R7, R6
+    VMOV      R2, R3, D11
+    VMOV      D11, R4, R5
+    CMP       R2, R7
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R6
+    BNE       __test_fpu_grp_fail
+
+    B         __test_fpu_grp_ok
+
+    ; Group 3: D12 to D15 (S24 to S31) registers
+__test_fpu_grp_d12_d15
+    ; D12 (S24, S25) registers test
+    VMOV      R4, R5, D12
+    VMOV      D12, R6, R7
+    VMOV      R2, R3, D12
+    VMOV      D12, R4, R5
+    CMP       R2, R6
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R7
+    BNE       __test_fpu_grp_fail
+    VMOV      D12, R7, R6
+    VMOV      R2, R3, D12
+    VMOV      D12, R4, R5
+    CMP       R2, R7
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R6
+    BNE       __test_fpu_grp_fail
+
+    ; D13 (S26, S27) registers test
+    VMOV      R4, R5, D13
+    VMOV      D13, R6, R7
+    VMOV      R2, R3, D13
+    VMOV      D13, R4, R5
+    CMP       R2, R6
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R7
+    BNE       __test_fpu_grp_fail
+    VMOV      D13, R7, R6
+    VMOV      R2, R3, D13
+    VMOV      D13, R4, R5
+    CMP       R2, R7
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R6
+    BNE       __test_fpu_grp_fail
+
+    ; D14 (S28, S29) registers test
+    VMOV      R4, R5, D14
+    VMOV      D14, R6, R7
+    VMOV      R2, R3, D14
+    VMOV      D14, R4, R5
+    CMP       R2, R6
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R7
+    BNE       __test_fpu_grp_fail
+    VMOV      D14, R7, R6
+    VMOV      R2, R3, D14
+    VMOV      D14, R4, R5
+    CMP       R2, R7
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R6
+    BNE       __test_fpu_grp_fail
+
+    ; D15 (S30, S31) registers test
+    VMOV      R4, R5, D15
+    VMOV      D15, R6, R7
+    VMOV      R2, R3, D15
+    VMOV      D15, R4, R5
+    CMP       R2, R6
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R7
+    BNE       __test_fpu_grp_fail
+    VMOV      D15, R7, R6
+    VMOV      R2, R3, D15
+    IF ERROR_IN_FPU_REGISTERS == 1
+    ADD       R3, R3, #1
+    ENDIF
+    VMOV      D15, R4, R5
+    CMP       R2, R7
+    BNE       __test_fpu_grp_fail
+    CMP       R3, R6
+    BNE       __test_fpu_grp_fail
+
+    B         __test_fpu_grp_ok
+
+    ; Group 4: FPSCR register, only the implemented bits are compared
+__test_fpu_grp_fpscr
+    LDR       R0, =0xA280008A
+    VMSR      FPSCR, R0
+    VMRS      R2, FPSCR
+    CMP       R2, R0
+    BNE       __test_fpu_grp_fail
+    LDR       R0, =0x55400015
+    VMSR      FPSCR, R0
+    VMRS      R2, FPSCR
+    CMP       R2, R0
+    BNE       __test_fpu_grp_fail
+
+    ; Return success
+__test_fpu_grp_ok
+    MOVS      R0, #0
+    VMSR      FPSCR, R1
+    POP       {R1-R7, PC}
+
+    ; Return failure
+__test_fpu_grp_fail
+    MOVS      R0, #0x01
+    VMSR      FPSCR, R1
+    POP       {R1-R7, PC}
+
+    ENDFUNC
+
     END
 ; [] END OF FILE  
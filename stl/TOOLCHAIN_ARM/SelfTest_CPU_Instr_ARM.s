@@ -0,0 +1,748 @@
+;-------------------------------------------------------------------------------
+; FILENAME: SelfTest_CPU_Instr_ARM.s
+;
+; Description: This file contains the function to perform the CPU instruction self
+; test. Deterministic instruction sequences are executed for the adder, logic unit,
+; barrel shifter, multiplier, divider and DSP extension, and their results and flags
+; are folded into a signature.
+;
+;-------------------------------------------------------------------------------
+; (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+; Technologies AG. All rights reserved.
+; This software, associated documentation and materials ("Software") is
+; owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+; and is protected by and subject to worldwide patent protection, worldwide
+; copyright laws, and international treaty provisions. Therefore, you may use
+; this Software only as provided in the license agreement accompanying the
+; software package from which you obtained this Software. If no license
+; agreement applies, then any use, reproduction, modification, translation, or
+; compilation of this Software is prohibited without the express written
+; permission of Infineon.
+;
+; Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+; IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+; INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+; THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+; SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+; Infineon reserves the right to make changes to the Software without notice.
+; You are responsible for properly designing, programming, and testing the
+; functionality and safety of your intended application of the Software, as
+; well as complying with any legal requirements related to its use. Infineon
+; does not guarantee that the Software will be free from intrusion, data theft
+; or loss, or other breaches ("Security Breaches"), and Infineon shall have
+; no liability arising out of any Security Breaches. Unless otherwise
+; explicitly approved by Infineon, the Software may not be used in any
+; application where a failure of the Product or any consequences of the use
+; thereof can reasonably be expected to result in personal injury.
+;-------------------------------------------------------------------------------
+
+    AREA |.text|,CODE
+    THUMB
+
+; Set this const to 0x01 to generate error for CPU instruction test
+ERROR_IN_CPU_INSTRUCTIONS   EQU     0x00
+
+;-------------------------------------------------------------------------------
+; Function Name: SelfTest_CPU_Instr_Group_ARM
+;-------------------------------------------------------------------------------
+; Summary:
+;   This function executes the instruction sequence of one group and folds the
+;   results and flags into a signature: 0 - adder and logic unit, 1 - barrel
+;   shifter, 2 - multiplier, 3 - long multiply, divider and bit field (ARMv7-M
+;   and ARMv8-M Mainline), 4 - SIMD and saturating arithmetic (DSP extension).
+;
+; Parameters:
+;   r0 - The instruction group number.
+;
+; Return:
+;   r0 - The signature of the group, 0 for an invalid group number.
+;
+; Destroys:
+;   r0
+;-------------------------------------------------------------------------------
+; uint32_t SelfTest_CPU_Instr_Group_ARM(uint32_t group)
+SelfTest_CPU_Instr_Group_ARM FUNCTION
+
+    EXPORT SelfTest_CPU_Instr_Group_ARM
+
+    PUSH    {R4-R7, LR}
+
+    ; Branch to the instruction group in R0
+    CMP     R0, #0
+    BNE     __test_instr_n0
+    B       __test_instr_alu
+__test_instr_n0
+    CMP     R0, #1
+    BNE     __test_instr_n1
+    B       __test_instr_shift
+__test_instr_n1
+    CMP     R0, #2
+    BNE     __test_instr_n2
+    B       __test_instr_mul
+__test_instr_n2
+    IF {TARGET_FEATURE_DIVIDE}
+    CMP     R0, #3
+    BNE     __test_instr_n3
+    B       __test_instr_long
+__test_instr_n3
+    ENDIF
+    IF {TARGET_FEATURE_DSPMUL}
+    CMP     R0, #4
+    BNE     __test_instr_n4
+    B       __test_instr_dsp
+__test_instr_n4
+    ENDIF
+    ; Invalid group number
+    MOVS    R7, #0
+
+    ; Return the signature
+__test_instr_done
+    MOVS    R0, R7
+    POP     {R4-R7, PC}
+
+    ; Group 0: adder, logic unit and byte reverse
+__test_instr_alu
+    ; R7 - signature, R6 - rotation of the signature per folded value
+    LDR     R7, =0xC3C3C3C3
+    MOVS    R6, #5
+    CMP     R7, R7
+    LDR     R1, =0x89ABCDEF
+    LDR     R2, =0x12345678
+    LDR     R4, =0x7FFFFFFF
+    LDR     R5, =0x80000001
+    ADDS    R3, R1, R2
+    IF ERROR_IN_CPU_INSTRUCTIONS == 1
+    ADDS    R3, R3, #1
+    ENDIF
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    ADDS    R3, R4, R4
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    ADDS    R3, R5, R5
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    ADDS    R3, R1, #7
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    SUBS    R3, R1, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    SUBS    R3, R2, R1
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    SUBS    R3, R4, R5
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    RSBS    R3, R2, #0
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    MOVS    R3, R1
+    ADCS    R3, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    MOVS    R3, R4
+    SBCS    R3, R1
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    CMP     R1, R2
+    MRS     R0, APSR
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    CMN     R4, R4
+    MRS     R0, APSR
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    MOVS    R3, R1
+    ANDS    R3, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    MOVS    R3, R1
+    ORRS    R3, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    MOVS    R3, R1
+    EORS    R3, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    MOVS    R3, R1
+    BICS    R3, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    MVNS    R3, R1
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    REV     R3, R1
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    REV16   R3, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    REVSH   R3, R1
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    B       __test_instr_done
+    LTORG
+
+    ; Group 1: barrel shifter
+__test_instr_shift
+    ; R7 - signature, R6 - rotation of the signature per folded value
+    LDR     R7, =0xC3C3C3C3
+    MOVS    R6, #5
+    CMP     R7, R7
+    LDR     R1, =0x89ABCDEF
+    LDR     R2, =0xF0F0F00F
+    LSLS    R3, R1, #1
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    LSLS    R3, R1, #31
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    LSRS    R3, R1, #1
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    LSRS    R3, R1, #32
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    ASRS    R3, R1, #7
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    ASRS    R3, R1, #32
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    ASRS    R3, R2, #4
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    MOVS    R4, #13
+    MOVS    R3, R1
+    LSLS    R3, R4
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    MOVS    R3, R1
+    LSRS    R3, R4
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    MOVS    R3, R1
+    ASRS    R3, R4
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    MOVS    R3, R1
+    RORS    R3, R4
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    MOVS    R4, #32
+    MOVS    R3, R1
+    LSLS    R3, R4
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    MOVS    R3, R1
+    RORS    R3, R4
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    MOVS    R4, #40
+    MOVS    R3, R2
+    LSRS    R3, R4
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    MOVS    R3, R2
+    ASRS    R3, R4
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    B       __test_instr_done
+    LTORG
+
+    ; Group 2: multiplier
+__test_instr_mul
+    ; R7 - signature, R6 - rotation of the signature per folded value
+    LDR     R7, =0xC3C3C3C3
+    MOVS    R6, #5
+    CMP     R7, R7
+    LDR     R1, =0x89ABCDEF
+    LDR     R2, =0x12345678
+    LDR     R4, =0x7FFFFFFF
+    LDR     R5, =0xF0F0F00F
+    MOVS    R3, R1
+    MULS    R3, R2, R3
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    MOVS    R3, R4
+    MULS    R3, R4, R3
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    MOVS    R3, R5
+    MULS    R3, R1, R3
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    MOVS    R3, #0
+    MULS    R3, R1, R3
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    MOVS    R3, #255
+    MULS    R3, R3, R3
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    LSRS    R0, R0, #28
+    EORS    R7, R0
+    RORS    R7, R6
+    B       __test_instr_done
+    LTORG
+
+    IF {TARGET_FEATURE_DIVIDE}
+    ; Group 3: long multiply, divider, bit field and shifted operands
+__test_instr_long
+    ; R7 - signature, R6 - rotation of the signature per folded value
+    LDR     R7, =0xC3C3C3C3
+    MOVS    R6, #5
+    CMP     R7, R7
+    LDR     R1, =0x89ABCDEF
+    LDR     R2, =0x12345678
+    LDR     R4, =0x7FFFFFFF
+    LDR     R5, =0x80000001
+    UMULL   R3, R0, R1, R2
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    SMULL   R3, R0, R1, R2
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    UMLAL   R3, R0, R4, R5
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    SMLAL   R3, R0, R4, R5
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    MLA     R3, R1, R2, R4
+    EORS    R7, R3
+    RORS    R7, R6
+    MLS     R3, R1, R2, R4
+    EORS    R7, R3
+    RORS    R7, R6
+    UDIV    R3, R1, R2
+    EORS    R7, R3
+    RORS    R7, R6
+    SDIV    R3, R1, R2
+    EORS    R7, R3
+    RORS    R7, R6
+    SDIV    R3, R2, R1
+    EORS    R7, R3
+    RORS    R7, R6
+    LDR     R0, =0xFFFFFFFF
+    LDR     R3, =0x80000000
+    SDIV    R3, R3, R0
+    EORS    R7, R3
+    RORS    R7, R6
+    UDIV    R3, R2, R2
+    EORS    R7, R3
+    RORS    R7, R6
+    CLZ     R3, R2
+    EORS    R7, R3
+    RORS    R7, R6
+    RBIT    R3, R1
+    EORS    R7, R3
+    RORS    R7, R6
+    UBFX    R3, R1, #4, #12
+    EORS    R7, R3
+    RORS    R7, R6
+    SBFX    R3, R1, #20, #9
+    EORS    R7, R3
+    RORS    R7, R6
+    MOVS    R3, R2
+    BFI     R3, R1, #8, #13
+    EORS    R7, R3
+    RORS    R7, R6
+    ADD     R3, R1, R2, ROR #7
+    EORS    R7, R3
+    RORS    R7, R6
+    SUB     R3, R1, R2, LSR #3
+    EORS    R7, R3
+    RORS    R7, R6
+    EOR     R3, R1, R2, ASR #13
+    EORS    R7, R3
+    RORS    R7, R6
+    ORN     R3, R1, R2, LSL #9
+    EORS    R7, R3
+    RORS    R7, R6
+    CMP     R2, R1
+    RRX     R3, R1
+    EORS    R7, R3
+    RORS    R7, R6
+    CMP     R1, R2
+    RRX     R3, R2
+    EORS    R7, R3
+    RORS    R7, R6
+    B       __test_instr_done
+    LTORG
+    ENDIF
+
+    IF {TARGET_FEATURE_DSPMUL}
+    ; Group 4: SIMD, saturating arithmetic and DSP multiply
+__test_instr_dsp
+    ; R7 - signature, R6 - rotation of the signature per folded value
+    LDR     R7, =0xC3C3C3C3
+    MOVS    R6, #5
+    CMP     R7, R7
+    MOVS    R0, #0
+    MSR     APSR_nzcvqg, R0
+    LDR     R1, =0x89ABCDEF
+    LDR     R2, =0x12345678
+    LDR     R4, =0x7FFFFFFF
+    LDR     R5, =0x80000001
+    UADD8   R3, R1, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    SEL     R3, R1, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    USUB8   R3, R2, R1
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    SEL     R3, R1, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    SADD16  R3, R1, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    SSUB16  R3, R2, R1
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    SEL     R3, R2, R1
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    UQADD8  R3, R1, R1
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    UQSUB16 R3, R2, R1
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    SHADD16 R3, R1, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    UHSUB8  R3, R1, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    QADD16  R3, R1, R1
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    QSUB8   R3, R2, R1
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    USAD8   R3, R1, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    QADD    R3, R2, R1
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    QADD    R3, R4, R4
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    MOVS    R0, #0
+    MSR     APSR_nzcvqg, R0
+    QSUB    R3, R5, R4
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    QDADD   R3, R2, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    MOVS    R0, #0
+    MSR     APSR_nzcvqg, R0
+    SSAT    R3, #8, R1
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    SSAT    R3, #16, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    USAT    R3, #8, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    USAT    R3, #31, R1
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    MOVS    R0, #0
+    MSR     APSR_nzcvqg, R0
+    SMULBB  R3, R1, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    SMULTT  R3, R1, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    SMULBT  R3, R1, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    SMUAD   R3, R1, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    SMUSD   R3, R1, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    SMLAD   R3, R1, R2, R4
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    SMLABB  R3, R1, R2, R4
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    SMMUL   R3, R1, R2
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    LDR     R0, =0x80008000
+    SMUAD   R3, R0, R0
+    MRS     R0, APSR
+    EORS    R7, R3
+    RORS    R7, R6
+    EORS    R7, R0
+    RORS    R7, R6
+    B       __test_instr_done
+    LTORG
+    ENDIF
+
+    ENDFUNC
+
+    END
+; [] END OF FILE
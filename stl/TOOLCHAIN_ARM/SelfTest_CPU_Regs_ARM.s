@@ -297,5 +297,270 @@ __test_asm_fail
 
     ENDFUNC
 
+;-------------------------------------------------------------------------------
+; Function Name: SelfTest_CPU_Regs_Group_ARM
+;-------------------------------------------------------------------------------
+; Summary:
+;   Tests one group of ARM M0 CPU registers: 0 - SP, 1 - R8 to R10,
+;   2 - R11, R12 and LR, 3 - R0 to R3, 4 - R4 to R7.
+;
+; Parameters:
+;   R0 - The register group number.
+;
+; Return:
+;   0 - pass test; 1 - fail test or invalid group.
+;
+;-------------------------------------------------------------------------------
+; uint8_t SelfTest_CPU_Regs_Group_ARM(uint32_t group)
+SelfTest_CPU_Regs_Group_ARM FUNCTION
+
+    EXPORT SelfTest_CPU_Regs_Group_ARM
+
+        PUSH  {R1-R7, LR}
+
+        ; Branch to the register group in R0
+        CMP   R0, #0
+        BNE   __test_grp_n0
+        B     __test_grp_sp
+__test_grp_n0
+        CMP   R0, #1
+        BNE   __test_grp_n1
+        B     __test_grp_r8_r10
+__test_grp_n1
+        CMP   R0, #2
+        BNE   __test_grp_n2
+        B     __test_grp_r11_lr
+__test_grp_n2
+        CMP   R0, #3
+        BNE   __test_grp_n3
+        B     __test_grp_r0_r3
+__test_grp_n3
+        CMP   R0, #4
+        BNE   __test_grp_n4
+        B     __test_grp_r4_r7
+__test_grp_n4
+        ; Invalid group number
+        B     __test_grp_fail
+
+        ; Group 0: SP register
+__test_grp_sp
+        ; SP ignores writes to the lower two bits, so they are intentionally set to 0
+        MOV   R1, SP
+        LDR   R0, =0xAAAAAAA8
+        MOV   SP, R0
+        CMP   SP, R0
+        MOV   SP, R1
+        BNE   __test_grp_fail
+        LDR   R0, =0x55555554
+        MOV   SP, R0
+        CMP   SP, R0
+        MOV   SP, R1
+        BNE   __test_grp_fail
+        B     __test_grp_ok
+
+        ; Group 1: R8 to R10 registers
+__test_grp_r8_r10
+        ; R8 registers test
+        MOV   R1, R8
+        LDR   R0, =0xAAAAAAAA
+        MOV   R8, R0
+        CMP   R8, R0
+        MOV   R8, R1
+        BNE   __test_grp_fail
+
+        LDR   R0, =0x55555555
+        MOV   R8, R0
+        CMP   R8, R0
+        MOV   R8, R1
+        BNE   __test_grp_fail
+
+        ; R9 registers test
+        MOV   R1, R9
+        LDR   R0, =0xAAAAAAAA
+        MOV   R9, R0
+        CMP   R9, R0
+        MOV   R9, R1
+        BNE   __test_grp_fail
+
+        LDR   R0, =0x55555555
+        MOV   R9, R0
+        CMP   R9, R0
+        MOV   R9, R1
+        BNE   __test_grp_fail
+
+        ; R10 registers test
+        MOV   R1, R10
+        LDR   R0, =0xAAAAAAAA
+        MOV   R10, R0
+        CMP   R10, R0
+        MOV   R10, R1
+        BNE   __test_grp_fail
+
+        LDR   R0, =0x55555555
+        MOV   R10, R0
+        CMP   R10, R0
+        MOV   R10, R1
+        BNE   __test_grp_fail
+
+        B     __test_grp_ok
+
+        ; Return success
+__test_grp_ok
+        MOVS  R0, #0
+        POP   {R1-R7, PC}
+
+        ; Return failure
+__test_grp_fail
+        MOVS  R0, #0x01
+        POP   {R1-R7, PC}
+
+        ; Group 2: R11, R12 and LR registers
+__test_grp_r11_lr
+        ; R11 registers test
+        MOV   R1, R11
+        LDR   R0, =0xAAAAAAAA
+        MOV   R11, R0
+        CMP   R11, R0
+        MOV   R11, R1
+        BNE   __test_grp_fail
+
+        LDR   R0, =0x55555555
+        MOV   R11, R0
+        CMP   R11, R0
+        MOV   R11, R1
+        BNE   __test_grp_fail
+
+        ; R12 registers test
+        MOV   R1, R12
+        LDR   R0, =0xAAAAAAAA
+        MOV   R12, R0
+        CMP   R12, R0
+        MOV   R12, R1
+        BNE   __test_grp_fail
+
+        LDR   R0, =0x55555555
+        MOV   R12, R0
+        CMP   R12, R0
+        MOV   R12, R1
+        BNE   __test_grp_fail
+
+        ; LR registers test
+        MOV   R1, LR
+        LDR   R0, =0xAAAAAAAA
+        MOV   LR, R0
+        CMP   LR, R0
+        MOV   LR, R1
+        BNE   __test_grp_fail
+
+        LDR   R0, =0x55555555
+        MOV   LR, R0
+        CMP   LR, R0
+        MOV   LR, R1
+        BNE   __test_grp_fail
+
+        B     __test_grp_ok
+
+        ; Group 3: R0 to R3 registers
+__test_grp_r0_r3
+        ; R0 registers test
+        LDR   R1, =0xAAAAAAAA
+        MOV   R0, R1
+        CMP   R0, R1
+        BNE   __test_grp_fail
+
+        LDR   R1, =0x55555555
+        MOV   R0, R1
+        CMP   R0, R1
+        BNE   __test_grp_fail
+
+        ; R1 registers test
+        LDR   R0, =0xAAAAAAAA
+        MOV   R1, R0
+        IF (ERROR_IN_CPU_REGISTERS == 1)
+        ADDS  R1, R1, #0x01
+        ENDIF
+        CMP   R1, R0
+        BNE   __test_grp_fail
+
+        LDR   R0, =0x55555555
+        MOV   R1, R0
+        CMP   R1, R0
+        BNE   __test_grp_fail
+
+        ; R2 registers test
+        LDR   R0, =0xAAAAAAAA
+        MOV   R2, R0
+        CMP   R2, R0
+        BNE   __test_grp_fail
+
+        LDR   R0, =0x55555555
+        MOV   R2, R0
+        CMP   R2, R0
+        BNE   __test_grp_fail
+
+        ; R3 registers test
+        LDR   R0, =0xAAAAAAAA
+        MOV   R3, R0
+        CMP   R3, R0
+        BNE   __test_grp_fail
+
+        LDR   R0, =0x55555555
+        MOV   R3, R0
+        CMP   R3, R0
+        BNE   __test_grp_fail
+
+        B     __test_grp_ok
+
+        ; Group 4: R4 to R7 registers
+__test_grp_r4_r7
+        ; R4 registers test
+        LDR   R0, =0xAAAAAAAA
+        MOV   R4, R0
+        CMP   R4, R0
+        BNE   __test_grp_fail
+
+        LDR   R0, =0x55555555
+        MOV   R4, R0
+        CMP   R4, R0
+        BNE   __test_grp_fail
+
+        ; R5 registers test
+        LDR   R0, =0xAAAAAAAA
+        MOV   R5, R0
+        CMP   R5, R0
+        BNE   __test_grp_fail
+
+        LDR   R0, =0x55555555
+        MOV   R5, R0
+        CMP   R5, R0
+        BNE   __test_grp_fail
+
+        ; R6 registers test
+        LDR   R0, =0xAAAAAAAA
+        MOV   R6, R0
+        CMP   R6, R0
+        BNE   __test_grp_fail
+
+        LDR   R0, =0x55555555
+        MOV   R6, R0
+        CMP   R6, R0
+        BNE   __test_grp_fail
+
+        ; R7 registers test
+        LDR   R0, =0xAAAAAAAA
+        MOV   R7, R0
+        CMP   R7, R0
+        BNE   __test_grp_fail
+
+        LDR   R0, =0x55555555
+        MOV   R7, R0
+        CMP   R7, R0
+        BNE   __test_grp_fail
+
+        B     __test_grp_ok
+
+
+    ENDFUNC
+
     END
 ;[] END OF FILE
\ No newline at end of file
@@ -0,0 +1,237 @@
+/*******************************************************************************
+* File Name: SelfTest_Clock_CSV.c
+*
+* Description:
+*  This file provides the source code of the clock monitor with the hardware
+*  clock supervisor (CSV) and the software measurement as fallback.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#include "cy_pdl.h"
+#include "SelfTest_Clock_CSV.h"
+#include "SelfTest_ErrorInjection.h"
+
+#if (STL_CLOCK_CSV_PRESENT == 1u)
+
+#define CLOCK_CSV_PPM               (1000000ULL)
+
+/* Supervisor of CLK_HF root "root" */
+#define CLOCK_CSV(root)             (&SRSS->CSV_HF.CSV[(root)])
+
+#if defined (STL_CLOCK_CSV_FAULT_ID)
+/* Fault set and bit of the supervisor fault source */
+#define CLOCK_CSV_FAULT_SET         \
+    ((cy_en_SysFault_Set_t)((uint32_t)STL_CLOCK_CSV_FAULT_ID / 32UL))
+#define CLOCK_CSV_FAULT_BIT         (1UL << ((uint32_t)STL_CLOCK_CSV_FAULT_ID % 32UL))
+#endif
+
+/* Configured register values, checked by SelfTest_Clock_CSV_Check() */
+static uint32_t csvRefCtl[STL_CLOCK_CSV_ROOTS];
+static uint32_t csvRefLimit[STL_CLOCK_CSV_ROOTS];
+static uint32_t csvMonCtl[STL_CLOCK_CSV_ROOTS];
+static uint32_t csvEnabled = 0UL;
+
+#endif /* if (STL_CLOCK_CSV_PRESENT == 1u) */
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Clock_CSV_Init
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function calculates the limits and enables the supervisor of one
+ *  CLK_HF root.
+ *
+ * Parameters:
+ *  cfg - The supervisor configuration.
+ *
+ * Return:
+ *  OK_STATUS - The supervisor is enabled; ERROR_STATUS - Invalid configuration
+ *  or no supervisor.
+ *
+ ******************************************************************************/
+uint8_t SelfTest_Clock_CSV_Init(const stl_clock_csv_cfg_t* cfg)
+{
+    #if (STL_CLOCK_CSV_PRESENT == 1u)
+    uint64_t expected;
+    uint64_t margin;
+    uint32_t root;
+
+    if ((cfg == NULL) || (cfg->hfRoot >= STL_CLOCK_CSV_ROOTS) || (cfg->monitoredHz == 0UL) ||
+        (cfg->referenceHz == 0UL) || (cfg->windowCycles == 0U))
+    {
+        return ERROR_STATUS;
+    }
+    root = cfg->hfRoot;
+
+    /* Reference cycles in the window, with the tolerance and one count on both sides */
+    expected = (((uint64_t)cfg->windowCycles * cfg->referenceHz) + (cfg->monitoredHz / 2UL)) /
+               cfg->monitoredHz;
+    margin = (((expected * cfg->tolerancePpm) + CLOCK_CSV_PPM) - 1ULL) / CLOCK_CSV_PPM + 1ULL;
+    if ((expected <= margin) || ((expected + margin) > STL_CLOCK_CSV_MAX_COUNT))
+    {
+        return ERROR_STATUS;
+    }
+
+    csvRefLimit[root] = _VAL2FLD(SRSS_CSV_HF_CSV_REF_LIMIT_LOWER, (uint32_t)(expected - margin)) |
+                        _VAL2FLD(SRSS_CSV_HF_CSV_REF_LIMIT_UPPER, (uint32_t)(expected + margin));
+    csvMonCtl[root] = _VAL2FLD(SRSS_CSV_HF_CSV_MON_CTL_PERIOD, (uint32_t)cfg->windowCycles);
+    csvRefCtl[root] = _VAL2FLD(SRSS_CSV_HF_CSV_REF_CTL_STARTUP, (uint32_t)cfg->startupCycles) |
+                      _VAL2FLD(SRSS_CSV_HF_CSV_REF_CTL_CSV_ACTION, cfg->resetOnFault ? 1UL : 0UL) |
+                      SRSS_CSV_HF_CSV_REF_CTL_CSV_EN_Msk;
+
+    /* The limits and the window are changed with the supervisor disabled */
+    CLOCK_CSV(root)->REF_CTL = 0UL;
+    CLOCK_CSV(root)->REF_LIMIT = csvRefLimit[root];
+    CLOCK_CSV(root)->MON_CTL = csvMonCtl[root];
+    CLOCK_CSV(root)->REF_CTL = csvRefCtl[root];
+    csvEnabled |= (1UL << root);
+
+    #if defined (STL_CLOCK_CSV_FAULT_ID)
+    /* Capture the supervisor fault for SelfTest_Clock_CSV_Check() */
+    Cy_SysFault_SetMaskByIdx(STL_CLOCK_CSV_FAULT_STRUCT, STL_CLOCK_CSV_FAULT_ID);
+    #endif
+
+    return OK_STATUS;
+    #else
+    (void)cfg;
+
+    return ERROR_STATUS;
+    #endif /* if (STL_CLOCK_CSV_PRESENT == 1u) */
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Clock_CSV_Check
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function checks the configuration of the enabled supervisors, reads and
+ *  clears the supervisor fault, and checks the reset cause.
+ *
+ * Parameters:
+ *  None.
+ *
+ * Return:
+ *  PASS_COMPLETE_STATUS - No error; ERROR_STATUS - Supervisor error.
+ *
+ ******************************************************************************/
+uint8_t SelfTest_Clock_CSV_Check(void)
+{
+    uint8_t ret = ERROR_STATUS;
+
+    #if (STL_CLOCK_CSV_PRESENT == 1u)
+    uint32_t root;
+
+    if (csvEnabled != 0UL)
+    {
+        ret = PASS_COMPLETE_STATUS;
+    }
+
+    for (root = 0UL; (root < STL_CLOCK_CSV_ROOTS) && (ret == PASS_COMPLETE_STATUS); root++)
+    {
+        if ((csvEnabled & (1UL << root)) != 0UL)
+        {
+            uint32_t refLimit = CLOCK_CSV(root)->REF_LIMIT;
+
+            #if (ERROR_IN_CLOCK == 1)
+            refLimit ^= 1UL;
+            #endif
+
+            if ((CLOCK_CSV(root)->REF_CTL != csvRefCtl[root]) ||
+                (refLimit != csvRefLimit[root]) ||
+                (CLOCK_CSV(root)->MON_CTL != csvMonCtl[root]))
+            {
+                ret = ERROR_STATUS;
+            }
+        }
+    }
+
+    #if defined (STL_CLOCK_CSV_FAULT_ID)
+    /* A captured supervisor fault is cleared, so the next pending fault is captured */
+    if (Cy_SysFault_GetErrorSource(STL_CLOCK_CSV_FAULT_STRUCT) == STL_CLOCK_CSV_FAULT_ID)
+    {
+        Cy_SysFault_ClearStatus(STL_CLOCK_CSV_FAULT_STRUCT);
+        ret = ERROR_STATUS;
+    }
+    if ((Cy_SysFault_GetPendingFault(STL_CLOCK_CSV_FAULT_STRUCT, CLOCK_CSV_FAULT_SET) &
+         CLOCK_CSV_FAULT_BIT) != 0UL)
+    {
+        ret = ERROR_STATUS;
+    }
+    #endif
+
+    #if defined (SRSS_RES_CAUSE2_RESET_CSV_HF_Msk)
+    /* Sticky until the application clears the reset cause */
+    if (_FLD2VAL(SRSS_RES_CAUSE2_RESET_CSV_HF, SRSS->RES_CAUSE2) != 0UL)
+    {
+        ret = ERROR_STATUS;
+    }
+    #endif
+    #endif /* if (STL_CLOCK_CSV_PRESENT == 1u) */
+
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Clock_Monitor
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function checks the clocks with the supervisor if one is enabled, and
+ *  with the software measurement otherwise.
+ *
+ * Parameters:
+ *  TCPWM_Type * base - The pointer to a TCPWM instance.
+ *  cntNum - The Counter instance number in the selected TCPWM.
+ *
+ * Return:
+ *  1 - Test failed
+ *  2 - Still testing
+ *  3 - Test completed
+ *  4 - Incorrect Usage
+ *
+ ******************************************************************************/
+uint8_t SelfTest_Clock_Monitor(TCPWM_Type* base, uint32_t cntNum)
+{
+    #if (STL_CLOCK_CSV_PRESENT == 1u)
+    if (csvEnabled != 0UL)
+    {
+        return SelfTest_Clock_CSV_Check();
+    }
+    #endif
+
+    return SelfTest_Clock(base, cntNum);
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,222 @@
+/*******************************************************************************
+* File Name: SelfTest_Clock_CSV.h
+*
+* Description:
+*  This file provides function prototypes, constants, and parameter values
+*  used for the clock monitor with the hardware clock supervisor (CSV).
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+/**
+ * \addtogroup group_clock_csv
+ * \{
+ *
+ * The clock monitor uses the clock supervisor (CSV) of the SRSS to check CLK_HF roots against
+ * the reference clock continuously in hardware, without an interrupt or CPU time.
+ *
+ * \section group_clock_csv_more_information More Information
+ *
+ * \ref SelfTest_Clock measures one clock with a TCPWM interrupt and the WDT count and has to be
+ * called periodically. With the CSV, the SRSS counts the reference clock during a window of
+ * monitored clock cycles and raises a fault or a reset as soon as the count is outside its
+ * limits, so a clock fault is detected within one window.
+ *      1) \ref SelfTest_Clock_CSV_Init calculates the limits from the nominal frequencies and the
+ *         allowed deviation and enables the supervisor of one CLK_HF root.
+ *      2) \ref SelfTest_Clock_CSV_Check compares the supervisor registers with the configured
+ *         values and checks the reset cause for a supervisor reset. Without the reset action, a
+ *         supervisor error is a fault: \ref SelfTest_Clock_CSV_Init enables the supervisor fault
+ *         source in \ref STL_CLOCK_CSV_FAULT_STRUCT, and \ref SelfTest_Clock_CSV_Check reads and
+ *         clears it there. The application initializes this fault structure with
+ *         Cy_SysFault_Init(); if its fault handler clears the status first, it also handles the
+ *         supervisor fault.
+ *      3) \ref SelfTest_Clock_Monitor returns the same status codes as \ref SelfTest_Clock. It
+ *         uses the supervisor where it is available and the software measurement otherwise, for
+ *         example on PSOC 4.
+ *
+ * The supervisor is available if the device header defines the CSV_HF registers
+ * (\ref STL_CLOCK_CSV_PRESENT), for example on XMC7.
+ *
+ * \code
+ * static const stl_clock_csv_cfg_t csvCfg =
+ * {
+ *     .hfRoot = 0UL,
+ *     .monitoredHz = 100000000UL,     // CLK_HF0
+ *     .referenceHz = 8000000UL,       // IMO
+ *     .tolerancePpm = 30000UL,        // 3 %
+ *     .windowCycles = 50000U,         // 500 us
+ *     .startupCycles = 100U,
+ *     .resetOnFault = false
+ * };
+ *
+ * if (SelfTest_Clock_CSV_Init(&csvCfg) != OK_STATUS)
+ * {
+ *     // Process error
+ * }
+ *
+ * // Periodically
+ * if (SelfTest_Clock_Monitor(CYBSP_CLOCK_TEST_TIMER_HW, CYBSP_CLOCK_TEST_TIMER_NUM) ==
+ *     ERROR_STATUS)
+ * {
+ *     // Process error
+ * }
+ * \endcode
+ *
+ * \defgroup group_clock_csv_macros Macros
+ * \defgroup group_clock_csv_data_structures Data Structures
+ * \defgroup group_clock_csv_functions Functions
+ */
+
+#if !defined(SELFTEST_CLOCK_CSV_H)
+    #define SELFTEST_CLOCK_CSV_H
+
+#include "cy_pdl.h"
+#include "SelfTest_common.h"
+#include "SelfTest_Clock.h"
+
+/** \addtogroup group_clock_csv_macros
+ * \{
+ */
+
+#if (defined (CY_IP_MXS40SRSS) && defined (SRSS_CSV_HF_CSV_REF_CTL_CSV_EN_Msk)) || \
+    defined (CY_DOXYGEN)
+/** Defined to 1 if the SRSS has the CLK_HF clock supervisors */
+#define STL_CLOCK_CSV_PRESENT           (1u)
+/** Number of CLK_HF roots with a supervisor */
+#define STL_CLOCK_CSV_ROOTS             (SRSS_NUM_HFROOT)
+#else
+#define STL_CLOCK_CSV_PRESENT           (0u)
+#define STL_CLOCK_CSV_ROOTS             (0u)
+#endif
+
+/** Largest window and limit of the 16-bit supervisor counters */
+#define STL_CLOCK_CSV_MAX_COUNT         (0xFFFFUL)
+
+#if ((STL_CLOCK_CSV_PRESENT == 1u) && (defined (CY_IP_MXS40FAULT) || defined (CY_IP_MXFAULT))) || \
+    defined (CY_DOXYGEN)
+/** Fault structure that captures the supervisor faults */
+#define STL_CLOCK_CSV_FAULT_STRUCT      (FAULT_STRUCT0)
+/** Fault source of the CLK_HF supervisors */
+#define STL_CLOCK_CSV_FAULT_ID          (SRSS_FAULT_CSV)
+#endif
+
+/** \} group_clock_csv_macros */
+
+/**
+ * \addtogroup group_clock_csv_data_structures
+ * \{
+ */
+
+/** Supervisor configuration of one CLK_HF root */
+typedef struct
+{
+    uint32_t hfRoot;            /**< CLK_HF root */
+    uint32_t monitoredHz;       /**< Nominal frequency of the root in Hz */
+    uint32_t referenceHz;       /**< Nominal frequency of the reference clock in Hz */
+    uint32_t tolerancePpm;      /**< Allowed deviation including the reference accuracy */
+    uint16_t windowCycles;      /**< Window in monitored clock cycles */
+    uint16_t startupCycles;     /**< Delay in reference cycles after enable or DeepSleep wakeup */
+    bool resetOnFault;          /**< true - reset, false - fault on a supervisor error */
+} stl_clock_csv_cfg_t;
+
+/** \} group_clock_csv_data_structures */
+
+/**
+ * \addtogroup group_clock_csv_functions
+ * \{
+ */
+
+/*******************************************************************************
+* Function Name: SelfTest_Clock_CSV_Init
+****************************************************************************//**
+*
+* This function calculates the reference count limits of the window and enables the supervisor
+* of the CLK_HF root. The window holds the nominal reference count plus and minus the tolerance
+* and one count.
+*
+* \param cfg
+* The supervisor configuration.
+*
+* \return
+*  OK_STATUS    - The supervisor is enabled. <br>
+*  ERROR_STATUS - The device has no supervisor, the root is out of range, a frequency is 0, or a
+*                 limit exceeds \ref STL_CLOCK_CSV_MAX_COUNT.
+*
+*
+*******************************************************************************/
+uint8_t SelfTest_Clock_CSV_Init(const stl_clock_csv_cfg_t* cfg);
+
+/*******************************************************************************
+* Function Name: SelfTest_Clock_CSV_Check
+****************************************************************************//**
+*
+* This function checks that the supervisors enabled by \ref SelfTest_Clock_CSV_Init are still
+* configured, that no supervisor fault is captured or pending in
+* \ref STL_CLOCK_CSV_FAULT_STRUCT, and that the last reset was not caused by a supervisor. A
+* captured supervisor fault is cleared.
+*
+* \return
+*  PASS_COMPLETE_STATUS - The supervisors are active and reported no error. <br>
+*  ERROR_STATUS         - A supervisor register changed, no supervisor is enabled, a supervisor
+*                         reported a fault, or a supervisor caused the last reset.
+*
+*
+*******************************************************************************/
+uint8_t SelfTest_Clock_CSV_Check(void);
+
+/*******************************************************************************
+* Function Name: SelfTest_Clock_Monitor
+****************************************************************************//**
+*
+* This function checks the clocks with \ref SelfTest_Clock_CSV_Check if a supervisor was
+* enabled by \ref SelfTest_Clock_CSV_Init, and with \ref SelfTest_Clock otherwise.
+*
+* \param base
+* The pointer to a TCPWM instance, used only by the software measurement
+*
+* \param cntNum
+* The Counter instance number in the selected TCPWM, used only by the software measurement
+*
+* \return
+*  1 - Test failed <br>
+*  2 - Still testing <br>
+*  3 - Test completed <br>
+*  4 - Incorrect Usage
+*
+*******************************************************************************/
+uint8_t SelfTest_Clock_Monitor(TCPWM_Type* base, uint32_t cntNum);
+
+/** \} group_clock_csv_functions */
+
+/** \} group_clock_csv */
+
+#endif /* SELFTEST_CLOCK_CSV_H */
+
+
+/* [] END OF FILE */
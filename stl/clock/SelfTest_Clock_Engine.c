@@ -0,0 +1,331 @@
+/*******************************************************************************
+* File Name: SelfTest_Clock_Engine.c
+*
+* Description:
+*  This file provides the source code of the clock cross-measurement engine
+*  using the SRSS clock calibration counters.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#include "cy_pdl.h"
+#include "SelfTest_Clock_Engine.h"
+#include "SelfTest_ErrorInjection.h"
+
+#if (defined (CY_IP_MXS40SRSS) || defined (CY_IP_MXS40SSRSS))
+
+#define CLOCK_ENGINE_PPM            (1000000ULL)
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Clock_Engine_Ppm
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function calculates the deviation of a measured count from the
+ *  expected count.
+ *
+ * Parameters:
+ *  count - The measured count.
+ *  expected - The expected count, not 0.
+ *
+ * Return:
+ *  The deviation in ppm.
+ *
+ ******************************************************************************/
+int32_t SelfTest_Clock_Engine_Ppm(uint32_t count, uint32_t expected)
+{
+    int64_t ppm = (((int64_t)count - (int64_t)expected) * (int64_t)CLOCK_ENGINE_PPM) /
+                  (int64_t)expected;
+
+    if (ppm > (int64_t)INT32_MAX)
+    {
+        ppm = (int64_t)INT32_MAX;
+    }
+    else if (ppm < (int64_t)INT32_MIN)
+    {
+        ppm = (int64_t)INT32_MIN;
+    }
+
+    return (int32_t)ppm;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Clock_Engine_Init
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function checks the tables and calculates the window, the expected
+ *  count, and the limit of each pair.
+ *
+ * Parameters:
+ *  engine - The engine to initialize.
+ *  domains - The domain table.
+ *  domainCount - The number of domains.
+ *  pairs - The pair table.
+ *  pairCount - The number of pairs.
+ *  results - The buffer for one result per pair.
+ *  windowUs - The measurement window in us.
+ *
+ * Return:
+ *  OK_STATUS - The engine is ready; ERROR_STATUS - The configuration is invalid.
+ *
+ ******************************************************************************/
+uint8_t SelfTest_Clock_Engine_Init(stl_clock_engine_t* engine, const stl_clock_domain_t* domains,
+                                   uint32_t domainCount, const stl_clock_pair_t* pairs,
+                                   uint32_t pairCount, stl_clock_result_t* results,
+                                   uint32_t windowUs)
+{
+    uint8_t ret = OK_STATUS;
+    uint32_t i;
+
+    if ((engine == NULL) || (domains == NULL) || (pairs == NULL) || (results == NULL) ||
+        (pairCount == 0UL))
+    {
+        return ERROR_STATUS;
+    }
+
+    for (i = 0UL; (i < pairCount) && (ret == OK_STATUS); i++)
+    {
+        const stl_clock_domain_t* meas;
+        const stl_clock_domain_t* ref;
+        uint64_t refCycles;
+        uint64_t expected;
+        uint64_t limit;
+
+        if ((pairs[i].measured >= domainCount) || (pairs[i].reference >= domainCount) ||
+            (pairs[i].measured == pairs[i].reference))
+        {
+            ret = ERROR_STATUS;
+            break;
+        }
+        meas = &domains[pairs[i].measured];
+        ref = &domains[pairs[i].reference];
+        if ((meas->nominalHz == 0UL) || (ref->nominalHz == 0UL))
+        {
+            ret = ERROR_STATUS;
+            break;
+        }
+
+        /* The window is a whole number of reference cycles, the expected count follows from it */
+        refCycles = ((uint64_t)ref->nominalHz * windowUs) / CLOCK_ENGINE_PPM;
+        expected = ((uint64_t)meas->nominalHz * refCycles) / ref->nominalHz;
+
+        /* Both accuracies and one count of the measured clock */
+        limit = (uint64_t)meas->accuracyPpm + ref->accuracyPpm;
+        if (expected != 0ULL)
+        {
+            limit += (CLOCK_ENGINE_PPM + expected - 1ULL) / expected;
+        }
+
+        if ((refCycles == 0ULL) || (refCycles > STL_CLOCK_ENGINE_MAX_COUNT) ||
+            (expected == 0ULL) || (limit > (uint64_t)INT32_MAX) ||
+            ((expected + ((expected * limit) / CLOCK_ENGINE_PPM)) > STL_CLOCK_ENGINE_MAX_COUNT))
+        {
+            ret = ERROR_STATUS;
+            break;
+        }
+
+        results[i].ppm = 0;
+        results[i].limitPpm = (uint32_t)limit;
+        results[i].refCycles = (uint32_t)refCycles;
+        results[i].expected = (uint32_t)expected;
+        results[i].count = 0UL;
+        results[i].status = STL_CLOCK_PAIR_PENDING;
+    }
+
+    engine->domains = domains;
+    engine->pairs = pairs;
+    engine->results = results;
+    engine->pairCount = (ret == OK_STATUS) ? pairCount : 0UL;
+    engine->windowUs = windowUs;
+    engine->current = 0UL;
+    engine->invalidCount = 0UL;
+    engine->callCount = 0UL;
+    engine->running = false;
+    engine->failed = false;
+
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: ClockEngine_Next
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function advances to the next pair after the current pair has a result.
+ *
+ * Parameters:
+ *  engine - The engine.
+ *
+ * Return:
+ *  PASS_STILL_TESTING_STATUS - Pairs remain in the pass;
+ *  PASS_COMPLETE_STATUS - All pairs of the pass passed;
+ *  ERROR_STATUS - A pair failed.
+ *
+ ******************************************************************************/
+static uint8_t ClockEngine_Next(stl_clock_engine_t* engine)
+{
+    uint8_t ret = PASS_STILL_TESTING_STATUS;
+
+    if (engine->results[engine->current].status == STL_CLOCK_PAIR_FAIL)
+    {
+        engine->failed = true;
+    }
+    engine->invalidCount = 0UL;
+    engine->callCount = 0UL;
+    engine->current++;
+    if (engine->current >= engine->pairCount)
+    {
+        ret = engine->failed ? ERROR_STATUS : PASS_COMPLETE_STATUS;
+        engine->current = 0UL;
+        engine->failed = false;
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Clock_Engine_Process
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function evaluates the finished measurement and starts the next one.
+ *
+ * Parameters:
+ *  engine - The engine.
+ *
+ * Return:
+ *  PASS_STILL_TESTING_STATUS - The pass is not finished;
+ *  PASS_COMPLETE_STATUS - All pairs of the pass passed;
+ *  ERROR_STATUS - A pair failed, had STL_CLOCK_ENGINE_MAX_INVALID
+ *  consecutive invalid measurements, or had no result in
+ *  STL_CLOCK_ENGINE_MAX_CALLS calls.
+ *
+ ******************************************************************************/
+uint8_t SelfTest_Clock_Engine_Process(stl_clock_engine_t* engine)
+{
+    uint8_t ret = PASS_STILL_TESTING_STATUS;
+    stl_clock_result_t* res;
+
+    if (engine->pairCount == 0UL)
+    {
+        return ERROR_STATUS;
+    }
+
+    engine->callCount++;
+
+    if (engine->running && Cy_SysClk_ClkMeasurementCountersDone())
+    {
+        /* With the window as reference frequency, the result is the raw measured count */
+        res = &engine->results[engine->current];
+        res->count = Cy_SysClk_ClkMeasurementCountersGetFreq(true, res->refCycles);
+        engine->running = false;
+
+        #if (ERROR_IN_CLOCK == 1)
+        res->count -= res->count / 4UL;
+        #endif
+
+        if (res->count == 0UL)
+        {
+            /* Invalid measurement, the pair is measured again below */
+            engine->invalidCount++;
+            if (engine->invalidCount >= STL_CLOCK_ENGINE_MAX_INVALID)
+            {
+                res->ppm = SelfTest_Clock_Engine_Ppm(0UL, res->expected);
+                res->status = STL_CLOCK_PAIR_FAIL;
+                ret = ClockEngine_Next(engine);
+            }
+        }
+        else
+        {
+            res->ppm = SelfTest_Clock_Engine_Ppm(res->count, res->expected);
+            if ((res->ppm > (int32_t)res->limitPpm) || (res->ppm < -(int32_t)res->limitPpm))
+            {
+                res->status = STL_CLOCK_PAIR_FAIL;
+            }
+            else
+            {
+                res->status = STL_CLOCK_PAIR_PASS;
+            }
+            ret = ClockEngine_Next(engine);
+        }
+    }
+    else if (engine->callCount >= STL_CLOCK_ENGINE_MAX_CALLS)
+    {
+        /* The reference clock stopped or the counters stay in use */
+        res = &engine->results[engine->current];
+        res->count = 0UL;
+        res->ppm = SelfTest_Clock_Engine_Ppm(0UL, res->expected);
+        res->status = STL_CLOCK_PAIR_FAIL;
+        engine->running = false;
+        ret = ClockEngine_Next(engine);
+    }
+    else
+    {
+        /* The measurement is running or the counters are in use */
+    }
+
+    /* The next pair starts in the same call, a new pass with the next call */
+    if ((!engine->running) && (ret == PASS_STILL_TESTING_STATUS))
+    {
+        const stl_clock_pair_t* pair = &engine->pairs[engine->current];
+        cy_en_sysclk_status_t status;
+
+        res = &engine->results[engine->current];
+        status = Cy_SysClk_StartClkMeasurementCounters(engine->domains[pair->reference].clock,
+                                                       res->refCycles,
+                                                       engine->domains[pair->measured].clock);
+        if (status == CY_SYSCLK_SUCCESS)
+        {
+            engine->running = true;
+        }
+        else if (status == CY_SYSCLK_BAD_PARAM)
+        {
+            /* The clock cannot be measured on this device */
+            res->status = STL_CLOCK_PAIR_FAIL;
+            ret = ClockEngine_Next(engine);
+        }
+        else
+        {
+            /* The counters are in use, retry with the next call */
+        }
+    }
+
+    return ret;
+}
+
+
+#endif /* if (defined (CY_IP_MXS40SRSS) || defined (CY_IP_MXS40SSRSS)) */
+
+/* [] END OF FILE */
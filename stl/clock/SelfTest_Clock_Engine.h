@@ -0,0 +1,284 @@
+/*******************************************************************************
+* File Name: SelfTest_Clock_Engine.h
+*
+* Description:
+*  This file provides function prototypes, constants, and parameter values
+*  used for the clock cross-measurement engine.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+/**
+ * \addtogroup group_clock_engine
+ * \{
+ *
+ * The clock cross-measurement engine measures several clock domains against each other with the
+ * SRSS clock calibration counters and reports the deviation of each measured clock in ppm.
+ *
+ * \section group_clock_engine_more_information More Information
+ *
+ * \ref SelfTest_Clock checks one clock against the WDT count with fixed limits. The engine is
+ * configured with tables instead:
+ *      1) A \ref stl_clock_domain_t per clock with its nominal frequency and accuracy, for example
+ *         IMO, FLL or PLL path, ECO, WCO, ILO, and the CLK_HF roots of the peripheral clocks.
+ *      2) A \ref stl_clock_pair_t per measurement with the measured and the reference domain.
+ *         The reference counter runs for the measurement window, and the measured clock is
+ *         counted in the same time.
+ *
+ * The limit of each pair is calculated from the nominal frequencies: the sum of both accuracies
+ * plus the resolution of one count of the measured clock in the window. All state is in the
+ * \ref stl_clock_engine_t of the caller, so several engines, for example a start-up and a run-time
+ * configuration, can be used one after the other.
+ *
+ * The device has one pair of calibration counters, and the PDL uses it for example for the ILO
+ * trim. \ref SelfTest_Clock_Engine_Process therefore does not block: it evaluates the finished
+ * measurement and starts the next one in the same call, so the pairs are measured back to back
+ * while the application and the TCPWM-based \ref SelfTest_Clock keep running. If the counters
+ * are in use, the measurement is started by a later call.
+ *
+ * \code
+ * static const stl_clock_domain_t clkDomains[] =
+ * {
+ *     { CY_SYSCLK_MEAS_CLK_IMO, 8000000UL, 20000UL },                // IMO, 2 %
+ *     { CY_SYSCLK_MEAS_CLK_WCO, 32768UL, 150UL },                    // WCO, 150 ppm
+ *     { CY_SYSCLK_MEAS_CLK_ILO, 32000UL, 100000UL },                 // ILO, 10 %
+ *     { CY_SYSCLK_MEAS_CLK_CLK_HFS, 100000000UL, 20000UL }           // CLK_HF0
+ * };
+ * static const stl_clock_pair_t clkPairs[] =
+ * {
+ *     { 0u, 1u },     // IMO against WCO
+ *     { 2u, 1u },     // ILO against WCO
+ *     { 3u, 0u }      // CLK_HF0 against IMO
+ * };
+ * static stl_clock_result_t clkResults[3u];
+ * static stl_clock_engine_t clkEngine;
+ *
+ * (void)SelfTest_Clock_Engine_Init(&clkEngine, clkDomains, 4u, clkPairs, 3u, clkResults, 10000UL);
+ *
+ * // Periodically
+ * status = SelfTest_Clock_Engine_Process(&clkEngine);
+ * if (status == ERROR_STATUS)
+ * {
+ *     // Process error, clkResults[i].ppm and clkResults[i].status show the failed pair
+ * }
+ * \endcode
+ *
+ * \defgroup group_clock_engine_macros Macros
+ * \defgroup group_clock_engine_data_structures Data Structures
+ * \defgroup group_clock_engine_functions Functions
+ */
+
+#if !defined(SELFTEST_CLOCK_ENGINE_H)
+    #define SELFTEST_CLOCK_ENGINE_H
+
+#include "cy_pdl.h"
+#include "SelfTest_common.h"
+
+#if (defined (CY_IP_MXS40SRSS) || defined (CY_IP_MXS40SSRSS) || defined (CY_DOXYGEN))
+
+/** \addtogroup group_clock_engine_macros
+ * \{
+ */
+
+/** Largest value of the 24-bit calibration counters */
+#define STL_CLOCK_ENGINE_MAX_COUNT      (0x00FFFFFFUL)
+
+#if !defined(STL_CLOCK_ENGINE_MAX_INVALID)
+/** Consecutive invalid measurements (count of 0) of a pair that are repeated before the pair
+ * fails, may be defined by the application */
+#define STL_CLOCK_ENGINE_MAX_INVALID    (3u)
+#endif
+
+#if !defined(STL_CLOCK_ENGINE_MAX_CALLS)
+/** Calls of \ref SelfTest_Clock_Engine_Process without a result before a pair fails, may be
+ * defined by the application. It must cover several measurement windows at the call period. */
+#define STL_CLOCK_ENGINE_MAX_CALLS      (1000u)
+#endif
+
+/** \ref stl_clock_result_t status: the pair was not measured since the last pass */
+#define STL_CLOCK_PAIR_PENDING          (0u)
+/** \ref stl_clock_result_t status: the deviation is within the limit */
+#define STL_CLOCK_PAIR_PASS             (1u)
+/** \ref stl_clock_result_t status: the deviation exceeds the limit */
+#define STL_CLOCK_PAIR_FAIL             (2u)
+
+/** \} group_clock_engine_macros */
+
+/**
+ * \addtogroup group_clock_engine_data_structures
+ * \{
+ */
+
+/** Clock domain */
+typedef struct
+{
+    cy_en_meas_clks_t clock;    /**< Clock selection of the calibration counters */
+    uint32_t nominalHz;         /**< Nominal frequency in Hz */
+    uint32_t accuracyPpm;       /**< Accuracy of the clock in ppm */
+} stl_clock_domain_t;
+
+/** Measurement of one domain against another, indices into the domain table */
+typedef struct
+{
+    uint8_t measured;           /**< Domain counted during the window */
+    uint8_t reference;          /**< Domain that defines the window */
+} stl_clock_pair_t;
+
+/** Result of a pair */
+typedef struct
+{
+    int32_t ppm;                /**< Deviation of the measured clock from its nominal frequency */
+    uint32_t limitPpm;          /**< Allowed deviation */
+    uint32_t refCycles;         /**< Window in reference clock cycles */
+    uint32_t expected;          /**< Measured clock cycles in the window at nominal frequencies */
+    uint32_t count;             /**< Measured clock cycles in the window */
+    uint8_t status;             /**< STL_CLOCK_PAIR_* */
+} stl_clock_result_t;
+
+/** Engine, initialized by \ref SelfTest_Clock_Engine_Init */
+typedef struct
+{
+    const stl_clock_domain_t* domains;  /**< Domain table */
+    const stl_clock_pair_t* pairs;      /**< Pair table */
+    stl_clock_result_t* results;        /**< One result per pair */
+    uint32_t pairCount;                 /**< Number of pairs */
+    uint32_t windowUs;                  /**< Measurement window in us */
+    uint32_t current;                   /**< Pair being measured */
+    uint32_t invalidCount;              /**< Consecutive invalid measurements of the current pair */
+    uint32_t callCount;                 /**< Calls since the current pair was started */
+    bool running;                       /**< The counters of the current pair are running */
+    bool failed;                        /**< A pair failed in the current pass */
+} stl_clock_engine_t;
+
+/** \} group_clock_engine_data_structures */
+
+/**
+ * \addtogroup group_clock_engine_functions
+ * \{
+ */
+
+/*******************************************************************************
+* Function Name: SelfTest_Clock_Engine_Init
+****************************************************************************//**
+*
+* This function checks the tables and calculates the limit of each pair.
+*
+* \param engine
+* The engine to initialize.
+*
+* \param domains
+* The domain table. It is referenced by the engine and must stay valid.
+*
+* \param domainCount
+* The number of domains.
+*
+* \param pairs
+* The pair table. It is referenced by the engine and must stay valid.
+*
+* \param pairCount
+* The number of pairs.
+*
+* \param results
+* The buffer for "pairCount" results.
+*
+* \param windowUs
+* The measurement window in us. A longer window gives a finer resolution.
+*
+* \return
+*  OK_STATUS    - The engine is ready. <br>
+*  ERROR_STATUS - A pointer is NULL, a pair refers to a missing domain or to the same domain
+*                 twice, a frequency is 0, or a counter would exceed
+*                 \ref STL_CLOCK_ENGINE_MAX_COUNT.
+*
+*
+*******************************************************************************/
+uint8_t SelfTest_Clock_Engine_Init(stl_clock_engine_t* engine, const stl_clock_domain_t* domains,
+                                   uint32_t domainCount, const stl_clock_pair_t* pairs,
+                                   uint32_t pairCount, stl_clock_result_t* results,
+                                   uint32_t windowUs);
+
+/*******************************************************************************
+* Function Name: SelfTest_Clock_Engine_Process
+****************************************************************************//**
+*
+* This function evaluates the finished measurement and starts the next one. A pass measures
+* every pair once; the next call starts a new pass.
+*
+* A count of 0 is an invalid measurement, for example when the counters were stopped or
+* reconfigured by other code. The pair is measured again, and it fails only after
+* \ref STL_CLOCK_ENGINE_MAX_INVALID consecutive invalid measurements.
+*
+* A pair also fails if it has no result after \ref STL_CLOCK_ENGINE_MAX_CALLS calls, because
+* the reference clock stopped and the measurement never finishes, or because the counters stay
+* in use by other code. The engine then continues with the next pair. With a stopped reference
+* clock, the counters stay busy, so the following pairs fail in the same way.
+*
+* \param engine
+* The engine.
+*
+* \return
+*  PASS_STILL_TESTING_STATUS - The pass is not finished. <br>
+*  PASS_COMPLETE_STATUS      - All pairs of the pass are within their limits. <br>
+*  ERROR_STATUS              - A pair of the pass exceeded its limit, had only invalid
+*                              measurements, or had no result in
+*                              \ref STL_CLOCK_ENGINE_MAX_CALLS calls.
+*
+*
+*******************************************************************************/
+uint8_t SelfTest_Clock_Engine_Process(stl_clock_engine_t* engine);
+
+/*******************************************************************************
+* Function Name: SelfTest_Clock_Engine_Ppm
+****************************************************************************//**
+*
+* This function calculates the deviation of a measured count from the expected count.
+*
+* \param count
+* The measured count.
+*
+* \param expected
+* The expected count at the nominal frequencies, not 0.
+*
+* \return
+* The deviation in ppm, saturated to the int32_t range.
+*
+*
+*******************************************************************************/
+int32_t SelfTest_Clock_Engine_Ppm(uint32_t count, uint32_t expected);
+
+/** \} group_clock_engine_functions */
+
+#endif /* if (defined (CY_IP_MXS40SRSS) || defined (CY_IP_MXS40SSRSS) || defined (CY_DOXYGEN)) */
+
+/** \} group_clock_engine */
+
+#endif /* SELFTEST_CLOCK_ENGINE_H */
+
+
+/* [] END OF FILE */
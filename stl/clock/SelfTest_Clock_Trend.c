@@ -0,0 +1,249 @@
+/*******************************************************************************
+* File Name: SelfTest_Clock_Trend.c
+*
+* Description:
+*  This file provides the source code of the clock drift trend monitor with
+*  a ring buffer history and an exponential moving average.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#include "cy_pdl.h"
+#include "SelfTest_Clock_Trend.h"
+#include "SelfTest_ErrorInjection.h"
+
+/* Fraction bits of the EMA */
+#define CLOCK_TREND_EMA_BITS        (8u)
+
+
+/*******************************************************************************
+ * Function Name: ClockTrend_Abs
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function returns the magnitude of a deviation.
+ *
+ ******************************************************************************/
+static uint32_t ClockTrend_Abs(int32_t ppm)
+{
+    return (ppm < 0) ? (uint32_t)(-ppm) : (uint32_t)ppm;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Clock_Trend_Init
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function initializes the trend of one clock with an empty history.
+ *
+ * Parameters:
+ *  trend - The trend to initialize.
+ *  history - The ring buffer.
+ *  size - The number of samples in the ring buffer.
+ *  emaShift - The EMA weight 1 / 2^emaShift.
+ *  warnPpm - The EMA warning threshold.
+ *  failPpm - The EMA failure threshold.
+ *  hardPpm - The single sample limit, 0 to disable.
+ *
+ * Return:
+ *  OK_STATUS - The trend is ready; ERROR_STATUS - Invalid parameter.
+ *
+ ******************************************************************************/
+uint8_t SelfTest_Clock_Trend_Init(stl_clock_trend_t* trend, int32_t* history, uint16_t size,
+                                  uint8_t emaShift, uint32_t warnPpm, uint32_t failPpm,
+                                  uint32_t hardPpm)
+{
+    if ((trend == NULL) || (history == NULL) || (size == 0U) ||
+        (emaShift > STL_CLOCK_TREND_MAX_SHIFT) || (warnPpm > failPpm))
+    {
+        return ERROR_STATUS;
+    }
+
+    trend->history = history;
+    trend->size = size;
+    trend->count = 0U;
+    trend->head = 0U;
+    trend->emaShift = emaShift;
+    trend->warnPpm = warnPpm;
+    trend->failPpm = failPpm;
+    trend->hardPpm = hardPpm;
+    trend->emaQ8 = 0;
+    trend->sum = 0;
+    trend->sumSq = 0;
+
+    return OK_STATUS;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Clock_Trend_Update
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function adds a measured deviation to the history and the EMA and
+ *  checks the thresholds.
+ *
+ * Parameters:
+ *  trend - The trend.
+ *  ppm - The measured deviation.
+ *
+ * Return:
+ *  OK_STATUS - Below the warning threshold;
+ *  CLOCK_DRIFT_WARNING_STATUS - Warning threshold reached;
+ *  ERROR_STATUS - Failure threshold or hard limit reached.
+ *
+ ******************************************************************************/
+uint8_t SelfTest_Clock_Trend_Update(stl_clock_trend_t* trend, int32_t ppm)
+{
+    uint8_t ret = OK_STATUS;
+    int32_t sample = ppm;
+    uint32_t ema;
+
+    if (sample > STL_CLOCK_TREND_MAX_PPM)
+    {
+        sample = STL_CLOCK_TREND_MAX_PPM;
+    }
+    else if (sample < -STL_CLOCK_TREND_MAX_PPM)
+    {
+        sample = -STL_CLOCK_TREND_MAX_PPM;
+    }
+
+    #if (ERROR_IN_CLOCK == 1)
+    /* Added after the clamp and limited, so the sample cannot overflow */
+    sample += (trend->failPpm < (uint32_t)STL_CLOCK_TREND_MAX_PPM) ?
+              (int32_t)trend->failPpm : STL_CLOCK_TREND_MAX_PPM;
+    #endif
+
+    /* Replace the oldest sample of a full ring buffer */
+    if (trend->count == trend->size)
+    {
+        int64_t old = trend->history[trend->head];
+
+        trend->sum -= old;
+        trend->sumSq -= old * old;
+    }
+    else
+    {
+        trend->count++;
+    }
+    trend->history[trend->head] = sample;
+    trend->head = (uint16_t)((trend->head + 1U) % trend->size);
+    trend->sum += sample;
+    trend->sumSq += (int64_t)sample * sample;
+
+    /* The first sample starts the EMA, later samples move it by 1 / 2^emaShift */
+    if (trend->count == 1U)
+    {
+        trend->emaQ8 = sample * (int32_t)(1L << CLOCK_TREND_EMA_BITS);
+    }
+    else
+    {
+        trend->emaQ8 += ((sample * (int32_t)(1L << CLOCK_TREND_EMA_BITS)) - trend->emaQ8) /
+                        (int32_t)(1L << trend->emaShift);
+    }
+
+    ema = ClockTrend_Abs(trend->emaQ8 / (int32_t)(1L << CLOCK_TREND_EMA_BITS));
+    if (((trend->hardPpm != 0UL) && (ClockTrend_Abs(sample) > trend->hardPpm)) ||
+        (ema >= trend->failPpm))
+    {
+        ret = ERROR_STATUS;
+    }
+    else if (ema >= trend->warnPpm)
+    {
+        ret = CLOCK_DRIFT_WARNING_STATUS;
+    }
+    else
+    {
+        /* Below the warning threshold */
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Clock_Trend_GetStats
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function returns the EMA and the statistics of the ring buffer.
+ *
+ * Parameters:
+ *  trend - The trend.
+ *  stats - The statistics.
+ *
+ * Return:
+ *  None.
+ *
+ ******************************************************************************/
+void SelfTest_Clock_Trend_GetStats(const stl_clock_trend_t* trend,
+                                   stl_clock_trend_stats_t* stats)
+{
+    uint16_t i;
+
+    stats->ema = 0;
+    stats->mean = 0;
+    stats->min = 0;
+    stats->max = 0;
+    stats->variance = 0UL;
+    stats->count = trend->count;
+
+    if (trend->count != 0U)
+    {
+        int64_t mean = trend->sum / trend->count;
+        int64_t variance = (trend->sumSq / trend->count) - (mean * mean);
+
+        stats->ema = trend->emaQ8 / (int32_t)(1L << CLOCK_TREND_EMA_BITS);
+        stats->mean = (int32_t)mean;
+        stats->min = trend->history[0u];
+        stats->max = trend->history[0u];
+        for (i = 1U; i < trend->count; i++)
+        {
+            if (trend->history[i] < stats->min)
+            {
+                stats->min = trend->history[i];
+            }
+            if (trend->history[i] > stats->max)
+            {
+                stats->max = trend->history[i];
+            }
+        }
+        /* Integer rounding of the mean can make a constant history slightly negative */
+        if (variance < 0)
+        {
+            variance = 0;
+        }
+        stats->variance = (variance > (int64_t)UINT32_MAX) ? UINT32_MAX : (uint32_t)variance;
+    }
+}
+
+
+/* [] END OF FILE */
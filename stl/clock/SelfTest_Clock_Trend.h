@@ -0,0 +1,225 @@
+/*******************************************************************************
+* File Name: SelfTest_Clock_Trend.h
+*
+* Description:
+*  This file provides function prototypes, constants, and parameter values
+*  used for the clock drift trend monitor.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+/**
+ * \addtogroup group_clock_trend
+ * \{
+ *
+ * The clock drift trend monitor filters the deviations measured for one clock over time and
+ * decides on the trend instead of a single measurement.
+ *
+ * \section group_clock_trend_more_information More Information
+ *
+ * A single short measurement window reports one-off jitter as a fault, and a clock that slowly
+ * drifts is only detected when it crosses the hard limit. The trend monitor keeps per clock:
+ *      1) A ring buffer of the last deviations in ppm, with the mean, minimum, maximum, and
+ *         variance over the buffer.
+ *      2) An exponential moving average (EMA) with a weight of 1 / 2^emaShift per sample.
+ *
+ * \ref SelfTest_Clock_Trend_Update returns CLOCK_DRIFT_WARNING_STATUS when the EMA reaches the
+ * warning threshold, and ERROR_STATUS when the EMA reaches the failure threshold or a single
+ * sample exceeds the hard limit, for example a stopped clock. Since the EMA averages the
+ * quantization of the measurement, shorter measurement windows can be used.
+ *
+ * The deviations are typically the \ref stl_clock_result_t ppm values of the
+ * \ref group_clock_engine, with the engine limits used as the hard limits:
+ * \code
+ * static int32_t imoHistory[16u];
+ * static stl_clock_trend_t imoTrend;
+ *
+ * // 0.4 % warning, 1 % failure on the EMA, 5 % on a single sample, EMA weight 1/8
+ * (void)SelfTest_Clock_Trend_Init(&imoTrend, imoHistory, 16u, 3u, 4000UL, 10000UL, 50000UL);
+ *
+ * // After each pass of the engine
+ * status = SelfTest_Clock_Trend_Update(&imoTrend, clkResults[0u].ppm);
+ * if (status == CLOCK_DRIFT_WARNING_STATUS)
+ * {
+ *     // Report the drift, for example from SelfTest_Clock_Trend_GetStats()
+ * }
+ * else if (status == ERROR_STATUS)
+ * {
+ *     // Process error
+ * }
+ * \endcode
+ *
+ * \defgroup group_clock_trend_macros Macros
+ * \defgroup group_clock_trend_data_structures Data Structures
+ * \defgroup group_clock_trend_functions Functions
+ */
+
+#if !defined(SELFTEST_CLOCK_TREND_H)
+    #define SELFTEST_CLOCK_TREND_H
+
+#include "cy_pdl.h"
+#include "SelfTest_common.h"
+
+/** \addtogroup group_clock_trend_macros
+ * \{
+ */
+
+/** Samples are limited to this deviation, which keeps the sums within 64 bits */
+#define STL_CLOCK_TREND_MAX_PPM         (1000000L)
+
+/** Largest EMA shift */
+#define STL_CLOCK_TREND_MAX_SHIFT       (8u)
+
+/** \} group_clock_trend_macros */
+
+/**
+ * \addtogroup group_clock_trend_data_structures
+ * \{
+ */
+
+/** Trend of one clock, initialized by \ref SelfTest_Clock_Trend_Init */
+typedef struct
+{
+    int32_t* history;           /**< Ring buffer of the last samples */
+    uint16_t size;              /**< Ring buffer size */
+    uint16_t count;             /**< Valid samples in the ring buffer */
+    uint16_t head;              /**< Position of the next sample */
+    uint8_t emaShift;           /**< EMA weight 1 / 2^emaShift */
+    uint32_t warnPpm;           /**< EMA warning threshold */
+    uint32_t failPpm;           /**< EMA failure threshold */
+    uint32_t hardPpm;           /**< Single sample limit, 0 - not checked */
+    int32_t emaQ8;              /**< EMA in 1/256 ppm */
+    int64_t sum;                /**< Sum of the samples in the ring buffer */
+    int64_t sumSq;              /**< Sum of the squared samples in the ring buffer */
+} stl_clock_trend_t;
+
+/** Statistics of a trend, see \ref SelfTest_Clock_Trend_GetStats */
+typedef struct
+{
+    int32_t ema;                /**< EMA in ppm */
+    int32_t mean;               /**< Mean of the ring buffer in ppm */
+    int32_t min;                /**< Minimum of the ring buffer in ppm */
+    int32_t max;                /**< Maximum of the ring buffer in ppm */
+    uint32_t variance;          /**< Variance of the ring buffer in ppm^2, saturated */
+    uint16_t count;             /**< Valid samples in the ring buffer */
+} stl_clock_trend_stats_t;
+
+/** \} group_clock_trend_data_structures */
+
+/**
+ * \addtogroup group_clock_trend_functions
+ * \{
+ */
+
+/*******************************************************************************
+* Function Name: SelfTest_Clock_Trend_Init
+****************************************************************************//**
+*
+* This function initializes the trend of one clock with an empty history.
+*
+* \param trend
+* The trend to initialize.
+*
+* \param history
+* The ring buffer for "size" samples. It is referenced by the trend and must stay valid.
+*
+* \param size
+* The number of samples in the ring buffer.
+*
+* \param emaShift
+* The EMA weight 1 / 2^emaShift, 0 to \ref STL_CLOCK_TREND_MAX_SHIFT. A larger shift filters
+* more and reacts slower.
+*
+* \param warnPpm
+* The EMA deviation that returns CLOCK_DRIFT_WARNING_STATUS.
+*
+* \param failPpm
+* The EMA deviation that returns ERROR_STATUS, not less than "warnPpm".
+*
+* \param hardPpm
+* The deviation of a single sample that returns ERROR_STATUS, 0 to disable.
+*
+* \return
+*  OK_STATUS    - The trend is ready. <br>
+*  ERROR_STATUS - A pointer is NULL, the size is 0, or a parameter is out of range.
+*
+*
+*******************************************************************************/
+uint8_t SelfTest_Clock_Trend_Init(stl_clock_trend_t* trend, int32_t* history, uint16_t size,
+                                  uint8_t emaShift, uint32_t warnPpm, uint32_t failPpm,
+                                  uint32_t hardPpm);
+
+/*******************************************************************************
+* Function Name: SelfTest_Clock_Trend_Update
+****************************************************************************//**
+*
+* This function adds a measured deviation to the history and the EMA and checks the thresholds.
+* The sample is limited to +/- \ref STL_CLOCK_TREND_MAX_PPM.
+*
+* \param trend
+* The trend.
+*
+* \param ppm
+* The measured deviation of the clock from its nominal frequency.
+*
+* \return
+*  OK_STATUS                  - The EMA is below the warning threshold. <br>
+*  CLOCK_DRIFT_WARNING_STATUS - The EMA reached the warning threshold. <br>
+*  ERROR_STATUS               - The EMA reached the failure threshold, or the sample exceeds
+*                               the hard limit.
+*
+*
+*******************************************************************************/
+uint8_t SelfTest_Clock_Trend_Update(stl_clock_trend_t* trend, int32_t ppm);
+
+/*******************************************************************************
+* Function Name: SelfTest_Clock_Trend_GetStats
+****************************************************************************//**
+*
+* This function returns the EMA and the statistics of the ring buffer.
+*
+* \param trend
+* The trend.
+*
+* \param stats
+* The statistics. All values are 0 if the history is empty.
+*
+*
+*******************************************************************************/
+void SelfTest_Clock_Trend_GetStats(const stl_clock_trend_t* trend,
+                                   stl_clock_trend_stats_t* stats);
+
+/** \} group_clock_trend_functions */
+
+/** \} group_clock_trend */
+
+#endif /* SELFTEST_CLOCK_TREND_H */
+
+
+/* [] END OF FILE */
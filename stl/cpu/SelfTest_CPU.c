@@ -45,6 +45,28 @@ static volatile uint32_t CPU_SelfTestC;
 static uint16_t counter1;
 static uint16_t counter2;
 static bool Program_flow_test;
+static uint32_t CPU_RegsGroup;
+static uint32_t CPU_InstrGroup;
+static uint32_t CPU_PcFailedStub = PC_STUB_NO_FAILED_INDEX;
+/* Data cache line size of Cortex-M7 */
+#define CPU_PC_CACHE_LINE   (32UL)
+/* The signatures of the instruction groups, in the order of the group numbers */
+static const uint32_t CPU_InstrSignature[CPU_INSTR_GROUP_COUNT] =
+{
+    0xC5C3AE8AUL,   /* Adder, logic unit and byte reverse */
+    0xCE84A68FUL,   /* Barrel shifter */
+    0xDDAA4C5AUL,   /* Multiplier */
+#if (CPU_INSTR_GROUP_COUNT > 3u)
+    0xEE9478D1UL,   /* Long multiply, divider, bit field and shifted operands */
+#endif
+#if (CPU_INSTR_GROUP_COUNT > 4u)
+    0x5A779122UL,   /* SIMD, saturating arithmetic and DSP multiply */
+#endif
+};
+
+static uint8_t CPU_InstrCheck(uint32_t group);
+static uint32_t CPU_PcStubCall(const stl_pc_stub_t* stub);
+static void CPU_PcStubSync(uint32_t address);
 /* The definition of the section for the SelfTest_PC5555() and SelfTest_PCAAAA() functions (GCC Compiler).
  *   Custom linkers files are required to placed at correct location
  */
@@ -105,6 +127,172 @@ uint8_t SelfTest_CPU_Registers(void)
 }
 
 
+/*******************************************************************************
+ * Function Name: SelfTest_CPU_Registers_Slice
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function performs the checkerboard test for the next group of CPU
+ *  registers. Interrupts are disabled only while the group is tested.
+ *
+ * Parameters:
+ *  None.
+ *
+ * Return:
+ *  PASS_STILL_TESTING_STATUS - The group passed, more groups to test.
+ *  PASS_COMPLETE_STATUS - The last group passed.
+ *  ERROR_STATUS - Test failed.
+ *
+ ******************************************************************************/
+uint8_t SelfTest_CPU_Registers_Slice(void)
+{
+    uint8_t ret;
+    uint32_t intState;
+
+    intState = Cy_SysLib_EnterCriticalSection();
+
+    #if defined(__ARMCC_VERSION)
+    ret = SelfTest_CPU_Regs_Group_ARM(CPU_RegsGroup);
+    #elif defined(__GNUC__)
+    ret = SelfTest_CPU_Regs_Group_GCC(CPU_RegsGroup);
+    #elif defined(__ICCARM__)
+    ret = SelfTest_CPU_Regs_Group_IAR(CPU_RegsGroup);
+    #else
+    ret = ERROR_STATUS;
+    #endif
+
+    Cy_SysLib_ExitCriticalSection(intState);
+
+    if (ret != OK_STATUS)
+    {
+        CPU_RegsGroup = 0u;
+        ret = ERROR_STATUS;
+    }
+    else
+    {
+        CPU_RegsGroup++;
+        ret = PASS_STILL_TESTING_STATUS;
+        if (CPU_RegsGroup >= CPU_REGS_GROUP_COUNT)
+        {
+            CPU_RegsGroup = 0u;
+            ret = PASS_COMPLETE_STATUS;
+        }
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: CPU_InstrCheck
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function executes the instruction sequence of one group and compares
+ *  its signature with the known value.
+ *
+ * Parameters:
+ *  group - The instruction group number.
+ *
+ * Return:
+ *  OK_STATUS - The signature matches.
+ *  ERROR_STATUS - The signature differs.
+ *
+ ******************************************************************************/
+static uint8_t CPU_InstrCheck(uint32_t group)
+{
+    uint32_t signature;
+    uint8_t ret = ERROR_STATUS;
+
+    #if defined(__ARMCC_VERSION)
+    signature = SelfTest_CPU_Instr_Group_ARM(group);
+    #elif defined(__GNUC__)
+    signature = SelfTest_CPU_Instr_Group_GCC(group);
+    #elif defined(__ICCARM__)
+    signature = SelfTest_CPU_Instr_Group_IAR(group);
+    #else
+    signature = ~CPU_InstrSignature[group];
+    #endif
+
+    if (signature == CPU_InstrSignature[group])
+    {
+        ret = OK_STATUS;
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_CPU_Instructions
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function executes the instruction sequences of all groups and compares
+ *  their signatures with the known values.
+ *
+ * Parameters:
+ *  None.
+ *
+ * Return:
+ *  Result of test:  "0" - pass test; "1" - fail test.
+ *
+ ******************************************************************************/
+uint8_t SelfTest_CPU_Instructions(void)
+{
+    uint8_t ret = OK_STATUS;
+    uint32_t group;
+
+    for (group = 0u; (group < CPU_INSTR_GROUP_COUNT) && (ret == OK_STATUS); group++)
+    {
+        ret = CPU_InstrCheck(group);
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_CPU_Instructions_Slice
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function executes the instruction sequence of the next group and
+ *  compares its signature with the known value.
+ *
+ * Parameters:
+ *  None.
+ *
+ * Return:
+ *  PASS_STILL_TESTING_STATUS - The group passed, more groups to test.
+ *  PASS_COMPLETE_STATUS - The last group passed.
+ *  ERROR_STATUS - Test failed.
+ *
+ ******************************************************************************/
+uint8_t SelfTest_CPU_Instructions_Slice(void)
+{
+    uint8_t ret;
+
+    if (CPU_InstrCheck(CPU_InstrGroup) != OK_STATUS)
+    {
+        CPU_InstrGroup = 0u;
+        ret = ERROR_STATUS;
+    }
+    else
+    {
+        CPU_InstrGroup++;
+        ret = PASS_STILL_TESTING_STATUS;
+        if (CPU_InstrGroup >= CPU_INSTR_GROUP_COUNT)
+        {
+            CPU_InstrGroup = 0u;
+            ret = PASS_COMPLETE_STATUS;
+        }
+    }
+
+    return ret;
+}
+
+
 /*******************************************************************************
  * Function Name: SelfTest_PC
  *******************************************************************************
@@ -176,6 +364,145 @@ uint8_t SelfTest_PC(void)
 }
 
 
+/*******************************************************************************
+ * Function Name: CPU_PcStubSync
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function makes a word written to RAM visible to instruction fetches.
+ *
+ * Parameters:
+ *  address - The address of the written word.
+ *
+ * Return:
+ *  None.
+ *
+ ******************************************************************************/
+static void CPU_PcStubSync(uint32_t address)
+{
+    __DSB();
+    #if (defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U))
+    SCB_CleanDCache_by_Addr((uint32_t*)(address & ~(CPU_PC_CACHE_LINE - 1UL)),
+                            (int32_t)CPU_PC_CACHE_LINE);
+    #else
+    (void)address;
+    #endif
+    #if (defined(__ICACHE_PRESENT) && (__ICACHE_PRESENT == 1U))
+    SCB_InvalidateICache();
+    #endif
+    __ISB();
+}
+
+
+/*******************************************************************************
+ * Function Name: CPU_PcStubCall
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function calls one stub of the program counter test. A RAM stub is
+ *  written before the call and the previous word is restored afterwards.
+ *
+ * Parameters:
+ *  stub - The stub.
+ *
+ * Return:
+ *  The value returned by the stub.
+ *
+ ******************************************************************************/
+static uint32_t CPU_PcStubCall(const stl_pc_stub_t* stub)
+{
+    uint32_t (*call)(void) = (uint32_t (*)(void))(stub->address | 1UL);
+    volatile uint32_t* word = (volatile uint32_t*)stub->address;
+    uint32_t saved;
+    uint32_t intState;
+    uint32_t ret;
+
+    if (stub->ram)
+    {
+        intState = Cy_SysLib_EnterCriticalSection();
+        saved = *word;
+        *word = STL_PC_STUB_WORD;
+        CPU_PcStubSync(stub->address);
+
+        ret = call();
+
+        *word = saved;
+        CPU_PcStubSync(stub->address);
+        Cy_SysLib_ExitCriticalSection(intState);
+    }
+    else
+    {
+        ret = call();
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_PC_Stubs
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function calls each stub of the list and checks that it returns its
+ *  own address plus 4.
+ *
+ * Parameters:
+ *  stubs - The stub list.
+ *  count - The number of stubs.
+ *
+ * Return:
+ *  Result of test:  "0" - pass test; "1" - fail test.
+ *
+ ******************************************************************************/
+uint8_t SelfTest_PC_Stubs(const stl_pc_stub_t* stubs, uint32_t count)
+{
+    uint8_t ret = ((stubs != NULL) && (count != 0UL)) ? OK_STATUS : ERROR_STATUS;
+    uint32_t returned;
+    uint32_t i;
+
+    CPU_PcFailedStub = PC_STUB_NO_FAILED_INDEX;
+
+    for (i = 0UL; (i < count) && (ret == OK_STATUS); i++)
+    {
+        returned = CPU_PcStubCall(&stubs[i]);
+
+        #if ERROR_IN_PROGRAM_COUNTER
+        returned ^= 0x00000100UL;
+        #endif /* End ERROR_IN_PROGRAM_COUNTER */
+
+        if (returned != (stubs[i].address + STL_PC_STUB_PC_OFFSET))
+        {
+            CPU_PcFailedStub = i;
+            ret = ERROR_STATUS;
+        }
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_PC_GetFailedStub
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function returns the index of the stub that failed the last
+ *  SelfTest_PC_Stubs() call.
+ *
+ * Parameters:
+ *  None.
+ *
+ * Return:
+ *  The stub index, or PC_STUB_NO_FAILED_INDEX.
+ *
+ ******************************************************************************/
+uint32_t SelfTest_PC_GetFailedStub(void)
+{
+    return CPU_PcFailedStub;
+}
+
+
 /*******************************************************************************
  * Function Name: SelfTest_PROGRAM_FLOW
  *******************************************************************************
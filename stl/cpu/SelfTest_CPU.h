@@ -59,11 +59,32 @@
  *         verification.
  *      3) The test returns an error code if the returned values do not match.
  *
+ * \ref SelfTest_CPU_Registers tests all registers with interrupts disabled for the whole test.
+ * \ref SelfTest_CPU_Registers_Slice tests one group of registers per call, so interrupts are
+ * disabled only for the duration of one group. It returns PASS_STILL_TESTING_STATUS until all
+ * \ref CPU_REGS_GROUP_COUNT groups are tested.
+ *
  * 2) Program Counter Test: To test these registers, the checkerboard test is commonly used;
  * addresses 0x5555 and 0xAAAA must be allocated for this test. 0x5555 and 0xAAAA represent the
  * checkerboard bit patterns. Functions that are in Flash memory at different addresses are
  * called. <br>
  *
+ * \ref SelfTest_PC covers one Flash area. \ref SelfTest_PC_Stubs extends the test to all Flash
+ * banks and executable RAM such as ITCM. It calls a list of \ref stl_pc_stub_t stubs of two
+ * instructions, "MOV R0, PC" and "BX LR", which return their own address plus 4. A stuck or
+ * coupled PC bit either makes the call land elsewhere or returns a different address. The
+ * stub addresses are chosen so that every address bit of each region is both 0 and 1:
+ * the 0x5555... and 0xAAAA... patterns within the region, and the highest stub address of the
+ * region.
+ *      - Flash stubs are defined with \ref STL_PC_STUB and placed at their addresses by the
+ *        linker script.
+ *      - RAM stubs are written by the test. The word at the stub address is saved, the stub is
+ *        written and called, and the word is restored, with interrupts disabled. The RAM region
+ *        must not contain the stack or data that is accessed by DMA or another core.
+ *
+ * The stl_pc_layout host tool in tools/pc_layout generates the stub table, the stub definitions,
+ * and the linker script fragments for GCC, IAR and ARM from the list of regions.
+ *
  * 3) Program Flow Test: For every critical execution code block, unique numbers are added
  * to or subtracted from complementary counters before the block execution and immediately after
  * execution. This procedures allows verification of whether the code block is correctly called from the main
@@ -71,8 +92,19 @@
  * same numbers of exit and entry points, the counter pair will always be complementary after each
  * tested block.
  *
+ * 4) CPU Instruction Test: Deterministic instruction sequences are executed on fixed operands
+ * for the adder and logic unit, the barrel shifter, the multiplier, the long multiply and
+ * divider, and the SIMD and saturating arithmetic of the DSP extension. The results and the
+ * condition flags of each instruction are folded into a signature that is compared with the
+ * known value of the group. The groups that the core does not implement are skipped, so
+ * \ref CPU_INSTR_GROUP_COUNT is 3 for Cortex-M0+, 4 for cores without the DSP extension, and 5
+ * for Cortex-M4, Cortex-M7 and Cortex-M33 with the DSP extension. The test uses only CPU
+ * registers, so it runs with interrupts enabled. \ref SelfTest_CPU_Instructions_Slice runs one
+ * group per call.
+ *
  *
  * \defgroup group_cpu_macros Macros
+ * \defgroup group_cpu_data_structures Data Structures
  * \defgroup group_cpu_functions Functions
  */
 
@@ -81,6 +113,25 @@
 #include "SelfTest_common.h"
 #include <cycfg.h>
 
+/***************************************
+* Data Structures
+***************************************/
+
+/**
+ * \addtogroup group_cpu_data_structures
+ * \{
+ */
+
+/** Stub of the program counter test, see \ref SelfTest_PC_Stubs */
+typedef struct
+{
+    uint32_t address;   /**< Address of the stub, 4-byte aligned */
+    bool ram;           /**< true - the test writes the stub to RAM before the call,
+                             false - the stub is placed in Flash with \ref STL_PC_STUB */
+} stl_pc_stub_t;
+
+/** \} group_cpu_data_structures */
+
 /***************************************
 * Function Prototypes
 ***************************************/
@@ -108,6 +159,38 @@
 *******************************************************************************/
 uint8_t SelfTest_PC(void);
 
+/*******************************************************************************
+* Function Name: SelfTest_PC_Stubs
+****************************************************************************//**
+*
+*  This function calls each stub of the list and checks that it returns its own address
+*  plus 4. RAM stubs are written before and removed after the call, with interrupts disabled.
+*
+* \param stubs
+*  The stub list, for example the table generated by the stl_pc_layout tool.
+*
+* \param count
+*  The number of stubs.
+*
+* \return
+*  0 - Test passed <br>
+*  1 - Test failed, \ref SelfTest_PC_GetFailedStub returns the failed stub
+*
+*******************************************************************************/
+uint8_t SelfTest_PC_Stubs(const stl_pc_stub_t* stubs, uint32_t count);
+
+/*******************************************************************************
+* Function Name: SelfTest_PC_GetFailedStub
+****************************************************************************//**
+*
+*  This function returns the index of the stub that failed the last \ref SelfTest_PC_Stubs.
+*
+* \return
+*  The index in the stub list, or \ref PC_STUB_NO_FAILED_INDEX.
+*
+*******************************************************************************/
+uint32_t SelfTest_PC_GetFailedStub(void);
+
 /*******************************************************************************
 * Function Name: SelfTest_CPU_Registers
 ****************************************************************************//**
@@ -123,6 +206,56 @@ uint8_t SelfTest_PC(void);
 *******************************************************************************/
 uint8_t SelfTest_CPU_Registers(void);
 
+/*******************************************************************************
+* Function Name: SelfTest_CPU_Registers_Slice
+****************************************************************************//**
+*
+*  This function performs the checkerboard test for the next group of CPU registers, with
+*  interrupts disabled only while the group is tested. The groups are SP, R8 to R10, R11 to LR,
+*  R0 to R3, and R4 to R7. After an error or the last group, the next call starts with the
+*  first group.
+*
+*
+* \return
+*  PASS_STILL_TESTING_STATUS - The group passed, more groups to test <br>
+*  PASS_COMPLETE_STATUS      - The last group passed, all registers are tested <br>
+*  ERROR_STATUS              - Test failed
+*
+*******************************************************************************/
+uint8_t SelfTest_CPU_Registers_Slice(void);
+
+/*******************************************************************************
+* Function Name: SelfTest_CPU_Instructions
+****************************************************************************//**
+*
+*  This function executes the instruction sequences of all groups and compares their
+*  signatures with the known values.
+*
+*
+* \return
+*  0 - Test passed <br>
+*  1 - Test failed
+*
+*******************************************************************************/
+uint8_t SelfTest_CPU_Instructions(void);
+
+/*******************************************************************************
+* Function Name: SelfTest_CPU_Instructions_Slice
+****************************************************************************//**
+*
+*  This function executes the instruction sequence of the next group and compares its
+*  signature with the known value. After an error or the last group, the next call starts
+*  with the first group.
+*
+*
+* \return
+*  PASS_STILL_TESTING_STATUS - The group passed, more groups to test <br>
+*  PASS_COMPLETE_STATUS      - The last group passed, all groups are tested <br>
+*  ERROR_STATUS              - Test failed
+*
+*******************************************************************************/
+uint8_t SelfTest_CPU_Instructions_Slice(void);
+
 /*******************************************************************************
 * Function Name: SelfTest_PROGRAM_FLOW
 ****************************************************************************//**
@@ -156,6 +289,31 @@ uint8_t SelfTest_PROGRAM_FLOW(void);
 /** \addtogroup group_cpu_macros
  * \{
  */
+/** The number of register groups tested by \ref SelfTest_CPU_Registers_Slice */
+#define CPU_REGS_GROUP_COUNT        (5u)
+#if (defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+/** The number of instruction groups tested by \ref SelfTest_CPU_Instructions */
+#define CPU_INSTR_GROUP_COUNT       (5u)
+#elif (defined(__ARM_ARCH_ISA_THUMB) && (__ARM_ARCH_ISA_THUMB >= 2))
+#define CPU_INSTR_GROUP_COUNT       (4u)
+#else
+#define CPU_INSTR_GROUP_COUNT       (3u)
+#endif
+/** Code of a program counter test stub: "MOV R0, PC", "BX LR" */
+#define STL_PC_STUB_CODE            { 0x4678u, 0x4770u }
+/** The stub code as one little-endian word, written to RAM stubs */
+#define STL_PC_STUB_WORD            (0x47704678UL)
+/** The value returned by a stub is its address plus this offset */
+#define STL_PC_STUB_PC_OFFSET       (4UL)
+/** \ref SelfTest_PC_GetFailedStub value when no stub failed */
+#define PC_STUB_NO_FAILED_INDEX     (0xFFFFFFFFUL)
+#if defined(__ICCARM__)
+/** Defines the Flash stub "name" in the linker section "sect" */
+#define STL_PC_STUB(name, sect)     __root const uint16_t name[2u] @ sect = STL_PC_STUB_CODE
+#else
+#define STL_PC_STUB(name, sect)     const uint16_t name[2u] __attribute__((used, section(sect))) = \
+                                    STL_PC_STUB_CODE
+#endif
 /** Unique value returned by SelfTest_PC5555 function if PC is working correctly. */
 #define CHECKERBOARD_PATTERN_55     0x55u
 /** Unique value returned by SelfTest_PCAAAA function if PC is working correctly. */
@@ -46,10 +46,16 @@
 ***************************************/
 #if defined(__ARMCC_VERSION)
 uint8_t SelfTest_CPU_Regs_ARM(void);
+uint8_t SelfTest_CPU_Regs_Group_ARM(uint32_t group);
+uint32_t SelfTest_CPU_Instr_Group_ARM(uint32_t group);
 #elif defined(__GNUC__)
 uint8_t SelfTest_CPU_Regs_GCC(void);
+uint8_t SelfTest_CPU_Regs_Group_GCC(uint32_t group);
+uint32_t SelfTest_CPU_Instr_Group_GCC(uint32_t group);
 #elif defined(__ICCARM__)
 uint8_t SelfTest_CPU_Regs_IAR(void);
+uint8_t SelfTest_CPU_Regs_Group_IAR(uint32_t group);
+uint32_t SelfTest_CPU_Instr_Group_IAR(uint32_t group);
 #elif defined(__CC_ARM)
 uint8_t SelfTest_CPU_Regs_MDK(void);
 #endif /* End (__GNUC__) ||  (__CC_ARM) */
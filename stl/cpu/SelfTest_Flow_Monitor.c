@@ -0,0 +1,216 @@
+/*******************************************************************************
+* File Name: SelfTest_Flow_Monitor.c
+*
+* Description:
+*  This file provides the source code of the signature-based program flow
+*  monitor for application tasks.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#include "cy_pdl.h"
+#include "SelfTest_Flow_Monitor.h"
+#include "SelfTest_ErrorInjection.h"
+
+static stl_flow_task_t* flowTasks = NULL;
+static uint32_t flowTaskCount = 0UL;
+static uint32_t flowFailedTask = STL_FLOW_NO_FAILED_TASK;
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Flow_Init
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function registers the task table and starts the deadline of every
+ *  task.
+ *
+ * Parameters:
+ *  tasks - The task table.
+ *  count - The number of tasks.
+ *  timeStampMs - The millisecond time stamp.
+ *
+ * Return:
+ *  None.
+ *
+ ******************************************************************************/
+void SelfTest_Flow_Init(stl_flow_task_t* tasks, uint32_t count, uint32_t timeStampMs)
+{
+    uint32_t i;
+
+    for (i = 0UL; (tasks != NULL) && (i < count); i++)
+    {
+        tasks[i].sig = STL_FLOW_SEED;
+        tasks[i].lastEndMs = timeStampMs;
+        tasks[i].state = STL_FLOW_STATE_IDLE;
+    }
+
+    flowTasks = tasks;
+    flowTaskCount = (tasks != NULL) ? count : 0UL;
+    flowFailedTask = STL_FLOW_NO_FAILED_TASK;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Flow_Begin
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function starts a sequence of the task.
+ *
+ * Parameters:
+ *  task - The task.
+ *
+ * Return:
+ *  None.
+ *
+ ******************************************************************************/
+void SelfTest_Flow_Begin(stl_flow_task_t* task)
+{
+    if (task->state == STL_FLOW_STATE_IDLE)
+    {
+        task->sig = STL_FLOW_SEED;
+        task->state = STL_FLOW_STATE_RUNNING;
+    }
+    else
+    {
+        /* The previous sequence was not ended, or the task already failed */
+        task->state = STL_FLOW_STATE_ERROR;
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Flow_End
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function ends the sequence of the task and compares its signature with
+ *  the expected value.
+ *
+ * Parameters:
+ *  task - The task.
+ *  timeStampMs - The millisecond time stamp.
+ *
+ * Return:
+ *  OK_STATUS - The sequence executed as expected.
+ *  ERROR_STATUS - The signature differs, or no sequence was started.
+ *
+ ******************************************************************************/
+uint8_t SelfTest_Flow_End(stl_flow_task_t* task, uint32_t timeStampMs)
+{
+    uint8_t ret = ERROR_STATUS;
+    uint32_t sig = task->sig;
+
+    #if (ERROR_IN_FLOW_MONITOR)
+    sig ^= 1UL;
+    #endif /* End (ERROR_IN_FLOW_MONITOR) */
+
+    if ((task->state == STL_FLOW_STATE_RUNNING) && (sig == task->expected))
+    {
+        task->lastEndMs = timeStampMs;
+        task->state = STL_FLOW_STATE_IDLE;
+        ret = OK_STATUS;
+    }
+    else
+    {
+        task->state = STL_FLOW_STATE_ERROR;
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Flow_Verify
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function checks the state and the deadline of all registered tasks.
+ *
+ * Parameters:
+ *  timeStampMs - The millisecond time stamp.
+ *
+ * Return:
+ *  OK_STATUS - All tasks passed.
+ *  ERROR_STATUS - A task failed or missed its deadline.
+ *
+ ******************************************************************************/
+uint8_t SelfTest_Flow_Verify(uint32_t timeStampMs)
+{
+    uint8_t ret = (flowTaskCount != 0UL) ? OK_STATUS : ERROR_STATUS;
+    uint32_t elapsedMs;
+    uint32_t i;
+
+    flowFailedTask = STL_FLOW_NO_FAILED_TASK;
+
+    for (i = 0UL; (i < flowTaskCount) && (ret == OK_STATUS); i++)
+    {
+        /* Unsigned subtraction handles the wrap-around of the time stamp. A task that ended
+         * after "timeStampMs" was taken, for example in an interrupt, has an elapsed time of 0. */
+        elapsedMs = timeStampMs - flowTasks[i].lastEndMs;
+        if ((int32_t)elapsedMs < 0)
+        {
+            elapsedMs = 0UL;
+        }
+
+        if ((flowTasks[i].state == STL_FLOW_STATE_ERROR) || (elapsedMs > flowTasks[i].deadlineMs))
+        {
+            flowFailedTask = i;
+            ret = ERROR_STATUS;
+        }
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Flow_GetFailedTask
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function returns the index of the task that failed the last
+ *  verification.
+ *
+ * Parameters:
+ *  None.
+ *
+ * Return:
+ *  The task index, or STL_FLOW_NO_FAILED_TASK.
+ *
+ ******************************************************************************/
+uint32_t SelfTest_Flow_GetFailedTask(void)
+{
+    return flowFailedTask;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,275 @@
+/*******************************************************************************
+* File Name: SelfTest_Flow_Monitor.h
+*
+* Description:
+*  This file provides function prototypes, constants, and parameter values
+*  used for the signature-based program flow monitor.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+/**
+ * \addtogroup group_flow_monitor
+ * \{
+ *
+ * The program flow monitor checks that the application executes the checkpoints of its tasks in
+ * the expected order and completes each sequence within its deadline.
+ *
+ * \section group_flow_monitor_more_information More Information
+ *
+ * \ref SelfTest_PROGRAM_FLOW checks only the library's own functions. The flow monitor extends
+ * the same idea to application code:
+ *      1) Each monitored sequence is described by a \ref stl_flow_task_t with the expected
+ *         signature and a deadline. The expected signature is calculated by the compiler from the
+ *         list of checkpoint IDs with the STL_FLOW_SIG_* macros, so no run-time learning phase is
+ *         needed.
+ *      2) \ref SelfTest_Flow_Begin starts a sequence. Each \ref STL_FLOW_CHECKPOINT folds its ID
+ *         into the signature of the task with one XOR and one multiplication, so the checkpoints
+ *         can stay in production code. A missing, repeated, or swapped checkpoint changes the
+ *         signature.
+ *      3) \ref SelfTest_Flow_End compares the signature with the expected value and records the
+ *         time of the completed sequence.
+ *      4) \ref SelfTest_Flow_Verify is called periodically, for example from the main loop or a
+ *         timer, and fails if a sequence had a wrong signature or if a task did not complete a
+ *         sequence within its deadline.
+ *
+ * A branch in a monitored sequence either uses the same checkpoint ID on both paths, or is
+ * monitored as a task of its own.
+ *
+ * \code
+ * #define TASK_CTRL_SIG    STL_FLOW_SIG_3(1u, 2u, 3u)
+ *
+ * static stl_flow_task_t flowTasks[] =
+ * {
+ *     STL_FLOW_TASK(TASK_CTRL_SIG, 10u)    // Control loop, at least every 10 ms
+ * };
+ *
+ * void ControlLoop(void)
+ * {
+ *     SelfTest_Flow_Begin(&flowTasks[0u]);
+ *     ReadInputs();
+ *     STL_FLOW_CHECKPOINT(&flowTasks[0u], 1u);
+ *     Compute();
+ *     STL_FLOW_CHECKPOINT(&flowTasks[0u], 2u);
+ *     WriteOutputs();
+ *     STL_FLOW_CHECKPOINT(&flowTasks[0u], 3u);
+ *     SelfTest_Flow_End(&flowTasks[0u], GetTimeMs());
+ * }
+ *
+ * // Once at start-up
+ * SelfTest_Flow_Init(flowTasks, sizeof(flowTasks) / sizeof(flowTasks[0u]), GetTimeMs());
+ *
+ * // Periodically
+ * if (SelfTest_Flow_Verify(GetTimeMs()) != OK_STATUS)
+ * {
+ *     // Process error, SelfTest_Flow_GetFailedTask() returns the failed task
+ * }
+ * \endcode
+ *
+ * \defgroup group_flow_monitor_macros Macros
+ * \defgroup group_flow_monitor_data_structures Data Structures
+ * \defgroup group_flow_monitor_functions Functions
+ */
+
+#if !defined(SELFTEST_FLOW_MONITOR_H)
+    #define SELFTEST_FLOW_MONITOR_H
+
+#include "cy_pdl.h"
+#include "SelfTest_common.h"
+
+/** \addtogroup group_flow_monitor_macros
+ * \{
+ */
+
+/** Signature of a task after \ref SelfTest_Flow_Begin */
+#define STL_FLOW_SEED               (0x811C9DC5UL)
+
+/** Multiplier of the signature step */
+#define STL_FLOW_PRIME              (0x01000193UL)
+
+/** \ref SelfTest_Flow_GetFailedTask value when no task failed */
+#define STL_FLOW_NO_FAILED_TASK     (0xFFFFFFFFUL)
+
+/** Signature after folding checkpoint "id" into signature "sig". A constant expression for
+ *  constant arguments. */
+#define STL_FLOW_STEP(sig, id)      \
+                                ((uint32_t)(((uint32_t)(sig) ^ (uint32_t)(id)) * STL_FLOW_PRIME))
+
+/** Expected signature of a sequence of one checkpoint */
+#define STL_FLOW_SIG_1(a)                       STL_FLOW_STEP(STL_FLOW_SEED, (a))
+/** Expected signature of a sequence of two checkpoints */
+#define STL_FLOW_SIG_2(a, b)                    STL_FLOW_STEP(STL_FLOW_SIG_1(a), (b))
+/** Expected signature of a sequence of three checkpoints */
+#define STL_FLOW_SIG_3(a, b, c)                 STL_FLOW_STEP(STL_FLOW_SIG_2(a, b), (c))
+/** Expected signature of a sequence of four checkpoints */
+#define STL_FLOW_SIG_4(a, b, c, d)              STL_FLOW_STEP(STL_FLOW_SIG_3(a, b, c), (d))
+/** Expected signature of a sequence of five checkpoints */
+#define STL_FLOW_SIG_5(a, b, c, d, e)           STL_FLOW_STEP(STL_FLOW_SIG_4(a, b, c, d), (e))
+/** Expected signature of a sequence of six checkpoints */
+#define STL_FLOW_SIG_6(a, b, c, d, e, f)        STL_FLOW_STEP(STL_FLOW_SIG_5(a, b, c, d, e), (f))
+/** Expected signature of a sequence of seven checkpoints */
+#define STL_FLOW_SIG_7(a, b, c, d, e, f, g)     STL_FLOW_STEP(STL_FLOW_SIG_6(a, b, c, d, e, f), (g))
+/** Expected signature of a sequence of eight checkpoints. Longer sequences continue with
+ *  \ref STL_FLOW_STEP on the signature of the first part. */
+#define STL_FLOW_SIG_8(a, b, c, d, e, f, g, h)  \
+                                        STL_FLOW_STEP(STL_FLOW_SIG_7(a, b, c, d, e, f, g), (h))
+
+/** Folds checkpoint "id" into the signature of "task", a pointer to \ref stl_flow_task_t */
+#define STL_FLOW_CHECKPOINT(task, id)   ((task)->sig = STL_FLOW_STEP((task)->sig, (id)))
+
+/** Initializer of \ref stl_flow_task_t with the expected signature and the deadline in ms */
+#define STL_FLOW_TASK(expected, deadlineMs)     { (expected), (deadlineMs), STL_FLOW_SEED, 0UL, \
+                                                  STL_FLOW_STATE_IDLE }
+
+/** Task state: no sequence is running */
+#define STL_FLOW_STATE_IDLE         (0u)
+/** Task state: \ref SelfTest_Flow_Begin was called, \ref SelfTest_Flow_End was not */
+#define STL_FLOW_STATE_RUNNING      (1u)
+/** Task state: a sequence had a wrong signature or was not started and ended in pairs */
+#define STL_FLOW_STATE_ERROR        (2u)
+
+/** \} group_flow_monitor_macros */
+
+/**
+ * \addtogroup group_flow_monitor_data_structures
+ * \{
+ */
+
+/** Monitored task, initialized with \ref STL_FLOW_TASK */
+typedef struct
+{
+    uint32_t expected;          /**< Expected signature at \ref SelfTest_Flow_End */
+    uint32_t deadlineMs;        /**< Maximum time between two completed sequences in ms */
+    volatile uint32_t sig;      /**< Signature of the running sequence */
+    volatile uint32_t lastEndMs; /**< Time stamp of the last completed sequence */
+    volatile uint8_t state;     /**< STL_FLOW_STATE_* */
+} stl_flow_task_t;
+
+/** \} group_flow_monitor_data_structures */
+
+/**
+ * \addtogroup group_flow_monitor_functions
+ * \{
+ */
+
+/*******************************************************************************
+* Function Name: SelfTest_Flow_Init
+****************************************************************************//**
+*
+* This function registers the task table checked by \ref SelfTest_Flow_Verify and starts the
+* deadline of every task.
+*
+* \param tasks
+* The task table. It is referenced by the monitor and must stay valid.
+*
+* \param count
+* The number of tasks in the table.
+*
+* \param timeStampMs
+* A free-running millisecond time stamp, for example the SysTick count. Wrap-around is handled.
+*
+*
+*******************************************************************************/
+void SelfTest_Flow_Init(stl_flow_task_t* tasks, uint32_t count, uint32_t timeStampMs);
+
+/*******************************************************************************
+* Function Name: SelfTest_Flow_Begin
+****************************************************************************//**
+*
+* This function starts a sequence of the task. If the previous sequence was not ended, the task
+* is set to the error state.
+*
+* \param task
+* The task.
+*
+*
+*******************************************************************************/
+void SelfTest_Flow_Begin(stl_flow_task_t* task);
+
+/*******************************************************************************
+* Function Name: SelfTest_Flow_End
+****************************************************************************//**
+*
+* This function ends the sequence of the task and compares its signature with the expected
+* value.
+*
+* \param task
+* The task.
+*
+* \param timeStampMs
+* A free-running millisecond time stamp, the same time base as for \ref SelfTest_Flow_Verify.
+*
+* \return
+*  OK_STATUS    - The sequence executed as expected. <br>
+*  ERROR_STATUS - The signature differs, or no sequence was started.
+*
+*
+*******************************************************************************/
+uint8_t SelfTest_Flow_End(stl_flow_task_t* task, uint32_t timeStampMs);
+
+/*******************************************************************************
+* Function Name: SelfTest_Flow_Verify
+****************************************************************************//**
+*
+* This function checks all tasks registered by \ref SelfTest_Flow_Init.
+*
+* \param timeStampMs
+* A free-running millisecond time stamp, the same time base as for \ref SelfTest_Flow_End.
+* A task that ended after this time stamp was taken, for example in an interrupt, is treated
+* as just ended.
+*
+* \return
+*  OK_STATUS    - All tasks completed their sequences as expected and within the deadline. <br>
+*  ERROR_STATUS - A task is in the error state or missed its deadline, or no table is registered.
+*
+*
+*******************************************************************************/
+uint8_t SelfTest_Flow_Verify(uint32_t timeStampMs);
+
+/*******************************************************************************
+* Function Name: SelfTest_Flow_GetFailedTask
+****************************************************************************//**
+*
+* This function returns the index of the task that failed the last \ref SelfTest_Flow_Verify.
+*
+* \return
+* The index in the task table, or \ref STL_FLOW_NO_FAILED_TASK.
+*
+*
+*******************************************************************************/
+uint32_t SelfTest_Flow_GetFailedTask(void);
+
+/** \} group_flow_monitor_functions */
+
+/** \} group_flow_monitor */
+
+#endif /* SELFTEST_FLOW_MONITOR_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,360 @@
+/*******************************************************************************
+* File Name: SelfTest_MultiCore.c
+*
+* Description:
+*  This file provides the source code of the multi-core CPU self-test with
+*  the verdict exchange through an IPC channel.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#include "cy_pdl.h"
+#include "SelfTest_CPU.h"
+#include "SelfTest_FPU_Regs.h"
+#include "SelfTest_MultiCore.h"
+#include "SelfTest_ErrorInjection.h"
+
+#if (defined (CY_IP_M4CPUSS) || defined (CY_IP_M7CPUSS))
+
+static stl_multicore_core_t mcCore = STL_MULTICORE_PRIMARY;
+static uint8_t mcLocalFailed = 0u;
+static uint8_t mcPeerFailed = STL_MULTICORE_NO_VERDICT;
+static uint32_t mcStartMs = 0UL;
+static uint32_t mcTimeoutMs = 0UL;
+static bool mcStarted = false;
+static bool mcPublished = false;
+
+
+/*******************************************************************************
+ * Function Name: MultiCore_Write
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function updates the bits of the IPC DATA register selected by "mask"
+ *  while it holds the channel lock.
+ *
+ * Parameters:
+ *  mask - The bits to update.
+ *  value - The new value of the bits.
+ *
+ * Return:
+ *  true - The register is updated; false - The lock could not be acquired.
+ *
+ ******************************************************************************/
+static bool MultiCore_Write(uint32_t mask, uint32_t value)
+{
+    IPC_STRUCT_Type* ipcPtr = Cy_IPC_Drv_GetIpcBaseAddress(STL_MULTICORE_IPC_CHANNEL);
+    uint32_t retries = MULTICORE_LOCK_RETRIES;
+    bool done = false;
+
+    while ((done == false) && (retries > 0UL))
+    {
+        if (Cy_IPC_Drv_LockAcquire(ipcPtr) == CY_IPC_DRV_SUCCESS)
+        {
+            uint32_t data = Cy_IPC_Drv_ReadDataValue(ipcPtr);
+
+            Cy_IPC_Drv_WriteDataValue(ipcPtr, (data & ~mask) | (value & mask));
+            (void)Cy_IPC_Drv_LockRelease(ipcPtr, CY_IPC_NO_NOTIFICATION);
+            done = true;
+        }
+        retries--;
+    }
+
+    return done;
+}
+
+
+/*******************************************************************************
+ * Function Name: MultiCore_Publish
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function writes the verdict of the calling core with its complement.
+ *
+ * Parameters:
+ *  None.
+ *
+ * Return:
+ *  true - The verdict is published; false - The channel is locked.
+ *
+ ******************************************************************************/
+static bool MultiCore_Publish(void)
+{
+    uint32_t flags = (uint32_t)mcLocalFailed | MULTICORE_VERDICT_VALID;
+    uint32_t verdict = flags | (((~flags) & 0xFFUL) << 8u);
+
+    #if (ERROR_IN_MULTI_CORE == 1u)
+    /* The other core receives a corrupted verdict */
+    verdict ^= 0x0100UL;
+    #endif
+
+    return MultiCore_Write(MULTICORE_VERDICT_MASK << MULTICORE_VERDICT_SHIFT(mcCore),
+                           verdict << MULTICORE_VERDICT_SHIFT(mcCore));
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_MultiCore_Init
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function clears the verdicts of both cores in the IPC channel.
+ *
+ * Parameters:
+ *  None.
+ *
+ * Return:
+ *  OK_STATUS - The channel is cleared; ERROR_STATUS - The channel is locked.
+ *
+ ******************************************************************************/
+uint8_t SelfTest_MultiCore_Init(void)
+{
+    mcStarted = false;
+    mcPublished = false;
+    mcLocalFailed = 0u;
+    mcPeerFailed = STL_MULTICORE_NO_VERDICT;
+
+    return MultiCore_Write(0xFFFFFFFFUL, 0UL) ? OK_STATUS : ERROR_STATUS;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_MultiCore_RunLocal
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function runs the selected tests on the calling core.
+ *
+ * Parameters:
+ *  tests - The STL_MULTICORE_TEST_* flags of the tests to run.
+ *
+ * Return:
+ *  The STL_MULTICORE_TEST_* flags of the failed tests.
+ *
+ ******************************************************************************/
+uint8_t SelfTest_MultiCore_RunLocal(uint8_t tests)
+{
+    uint8_t failed = 0u;
+
+    if (((tests & STL_MULTICORE_TEST_CPU_REGS) != 0u) && (SelfTest_CPU_Registers() != OK_STATUS))
+    {
+        failed |= STL_MULTICORE_TEST_CPU_REGS;
+    }
+    if (((tests & STL_MULTICORE_TEST_PC) != 0u) && (SelfTest_PC() != OK_STATUS))
+    {
+        failed |= STL_MULTICORE_TEST_PC;
+    }
+    if (((tests & STL_MULTICORE_TEST_FLOW) != 0u) && (SelfTest_PROGRAM_FLOW() != OK_STATUS))
+    {
+        failed |= STL_MULTICORE_TEST_FLOW;
+    }
+    #if (defined (__FPU_PRESENT) && (__FPU_PRESENT == 1U))
+    if (((tests & STL_MULTICORE_TEST_FPU_REGS) != 0u) && (SelfTest_FPU_Registers() != OK_STATUS))
+    {
+        failed |= STL_MULTICORE_TEST_FPU_REGS;
+    }
+    #endif
+    if (((tests & STL_MULTICORE_TEST_CPU_INSTR) != 0u) &&
+        (SelfTest_CPU_Instructions() != OK_STATUS))
+    {
+        failed |= STL_MULTICORE_TEST_CPU_INSTR;
+    }
+
+    return failed;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_MultiCore_Start
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function runs the selected tests on the calling core, publishes the
+ *  verdict, and starts the timeout for the verdict of the other core.
+ *
+ * Parameters:
+ *  core - The calling core.
+ *  tests - The STL_MULTICORE_TEST_* flags of the tests to run.
+ *  timeoutMs - The time the other core has to publish its verdict.
+ *  timeStampMs - The millisecond time stamp.
+ *
+ * Return:
+ *  OK_STATUS - The local tests passed; ERROR_STATUS - A local test failed.
+ *
+ ******************************************************************************/
+uint8_t SelfTest_MultiCore_Start(stl_multicore_core_t core, uint8_t tests, uint32_t timeoutMs,
+                                 uint32_t timeStampMs)
+{
+    mcCore = core;
+    mcStartMs = timeStampMs;
+    mcTimeoutMs = timeoutMs;
+    mcPeerFailed = STL_MULTICORE_NO_VERDICT;
+    mcLocalFailed = SelfTest_MultiCore_RunLocal(tests);
+
+    /* A locked channel is retried by SelfTest_MultiCore_Check() */
+    mcPublished = MultiCore_Publish();
+    mcStarted = true;
+
+    return (mcLocalFailed == 0u) ? OK_STATUS : ERROR_STATUS;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_MultiCore_Check
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function checks the verdict of the other core.
+ *
+ * Parameters:
+ *  timeStampMs - The millisecond time stamp.
+ *
+ * Return:
+ *  PASS_STILL_TESTING_STATUS - Waiting for the other core;
+ *  PASS_COMPLETE_STATUS - The tests passed on both cores;
+ *  ERROR_STATUS - A test failed or the other core timed out.
+ *
+ ******************************************************************************/
+uint8_t SelfTest_MultiCore_Check(uint32_t timeStampMs)
+{
+    uint8_t ret = ERROR_STATUS;
+
+    if (mcStarted)
+    {
+        stl_multicore_core_t peer = (mcCore == STL_MULTICORE_PRIMARY) ?
+                                    STL_MULTICORE_SECONDARY : STL_MULTICORE_PRIMARY;
+        uint32_t verdict;
+        uint32_t flags;
+
+        if (!mcPublished)
+        {
+            mcPublished = MultiCore_Publish();
+        }
+
+        verdict = (Cy_IPC_Drv_ReadDataValue(Cy_IPC_Drv_GetIpcBaseAddress(
+                       STL_MULTICORE_IPC_CHANNEL)) >> MULTICORE_VERDICT_SHIFT(peer)) &
+                  MULTICORE_VERDICT_MASK;
+        flags = verdict & 0xFFUL;
+
+        if (verdict == 0UL)
+        {
+            mcPeerFailed = STL_MULTICORE_NO_VERDICT;
+        }
+        else if (((((~verdict) >> 8u) & 0xFFUL) != flags) ||
+                 ((flags & MULTICORE_VERDICT_VALID) == 0UL))
+        {
+            /* Corrupted verdict */
+            mcPeerFailed = STL_MULTICORE_NO_VERDICT;
+        }
+        else
+        {
+            mcPeerFailed = (uint8_t)(flags & ~MULTICORE_VERDICT_VALID);
+        }
+
+        if ((mcLocalFailed != 0u) || ((verdict != 0UL) && (mcPeerFailed != 0u)))
+        {
+            ret = ERROR_STATUS;
+        }
+        else if ((verdict != 0UL) && mcPublished)
+        {
+            ret = PASS_COMPLETE_STATUS;
+        }
+        else if ((timeStampMs - mcStartMs) > mcTimeoutMs)
+        {
+            ret = ERROR_STATUS;
+        }
+        else
+        {
+            ret = PASS_STILL_TESTING_STATUS;
+        }
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_MultiCore
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function runs the local tests and waits for the verdict of the other
+ *  core.
+ *
+ * Parameters:
+ *  core - The calling core.
+ *  tests - The STL_MULTICORE_TEST_* flags of the tests to run.
+ *  timeoutMs - The time the other core has to publish its verdict.
+ *
+ * Return:
+ *  OK_STATUS - The tests passed on both cores; ERROR_STATUS - Otherwise.
+ *
+ ******************************************************************************/
+uint8_t SelfTest_MultiCore(stl_multicore_core_t core, uint8_t tests, uint32_t timeoutMs)
+{
+    uint32_t elapsedMs = 0UL;
+    uint8_t ret;
+
+    (void)SelfTest_MultiCore_Start(core, tests, timeoutMs, elapsedMs);
+    ret = SelfTest_MultiCore_Check(elapsedMs);
+    while (ret == PASS_STILL_TESTING_STATUS)
+    {
+        Cy_SysLib_Delay(1u);
+        elapsedMs++;
+        ret = SelfTest_MultiCore_Check(elapsedMs);
+    }
+
+    return (ret == PASS_COMPLETE_STATUS) ? OK_STATUS : ERROR_STATUS;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_MultiCore_GetFailedTests
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function returns the failed tests of a core from the last check.
+ *
+ * Parameters:
+ *  core - The core.
+ *
+ * Return:
+ *  The STL_MULTICORE_TEST_* flags, or STL_MULTICORE_NO_VERDICT.
+ *
+ ******************************************************************************/
+uint8_t SelfTest_MultiCore_GetFailedTests(stl_multicore_core_t core)
+{
+    return (core == mcCore) ? mcLocalFailed : mcPeerFailed;
+}
+
+
+#endif /* if (defined (CY_IP_M4CPUSS) || defined (CY_IP_M7CPUSS)) */
+
+/* [] END OF FILE */
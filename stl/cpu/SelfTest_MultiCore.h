@@ -0,0 +1,277 @@
+/*******************************************************************************
+* File Name: SelfTest_MultiCore.h
+*
+* Description:
+*  This file provides function prototypes, constants, and parameter values
+*  used for the multi-core CPU self-test.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+/**
+ * \addtogroup group_multicore
+ * \{
+ *
+ * The multi-core self-test runs the CPU tests on the primary core (CM0+) and on the secondary
+ * core (CM4 on PSOC 6, CM7 on XMC7) at the same time and exchanges the verdicts through a
+ * reserved IPC channel, so that the start-up diagnostics take the time of the slowest core.
+ *
+ * \section group_multicore_more_information More Information
+ *
+ *      1) The primary core calls \ref SelfTest_MultiCore_Init before it enables the secondary
+ *         core. This clears the verdicts of a previous run from the IPC channel.
+ *      2) Each core calls \ref SelfTest_MultiCore_Start with the tests to run. The selected
+ *         tests of \ref SelfTest_MultiCore_RunLocal run on the calling core, and the verdict is
+ *         written to the half of the IPC DATA register that belongs to the core. The verdict is
+ *         stored with its complement, so a corrupted verdict is detected.
+ *      3) Each core calls \ref SelfTest_MultiCore_Check until it no longer returns
+ *         PASS_STILL_TESTING_STATUS. The check fails if a test failed on either core, or if the
+ *         other core did not publish a valid verdict within the timeout.
+ *
+ * The IPC channel is selected with \ref STL_MULTICORE_IPC_CHANNEL. By default it is the last
+ * channel checked by \ref SelfTest_IPC, so \ref SelfTest_IPC must not run while the verdicts are
+ * exchanged. The channel lock only protects the update of the DATA register, no IPC interrupt is
+ * used.
+ *
+ * \code
+ * // CM0+
+ * SelfTest_MultiCore_Init();
+ * Cy_SysEnableCM4(CY_CORTEX_M4_APPL_ADDR);
+ * if (SelfTest_MultiCore(STL_MULTICORE_PRIMARY, STL_MULTICORE_TEST_ALL, 100u) != OK_STATUS)
+ * {
+ *     // Process error, SelfTest_MultiCore_GetFailedTests() returns the failed tests per core
+ * }
+ *
+ * // CM4
+ * if (SelfTest_MultiCore(STL_MULTICORE_SECONDARY, STL_MULTICORE_TEST_ALL, 100u) != OK_STATUS)
+ * {
+ *     // Process error
+ * }
+ * \endcode
+ *
+ * \defgroup group_multicore_macros Macros
+ * \defgroup group_multicore_enums Enumerated Types
+ * \defgroup group_multicore_functions Functions
+ */
+
+#if !defined(SELFTEST_MULTICORE_H)
+    #define SELFTEST_MULTICORE_H
+
+#include "cy_pdl.h"
+#include "SelfTest_common.h"
+
+#if (defined (CY_IP_M4CPUSS) || defined (CY_IP_M7CPUSS) || defined (CY_DOXYGEN))
+
+/** \addtogroup group_multicore_macros
+ * \{
+ */
+
+#if !defined(STL_MULTICORE_IPC_CHANNEL)
+#if (defined (CY_IP_M7CPUSS) || defined (CY_M4CPUSS_V2_IRQ_MUXING))
+/** IPC channel that carries the verdicts, may be defined by the application */
+#define STL_MULTICORE_IPC_CHANNEL       (7u)
+#else
+#define STL_MULTICORE_IPC_CHANNEL       (15u)
+#endif
+#endif /* if !defined(STL_MULTICORE_IPC_CHANNEL) */
+
+/** \ref SelfTest_CPU_Registers */
+#define STL_MULTICORE_TEST_CPU_REGS     (0x01u)
+/** \ref SelfTest_PC */
+#define STL_MULTICORE_TEST_PC           (0x02u)
+/** \ref SelfTest_PROGRAM_FLOW */
+#define STL_MULTICORE_TEST_FLOW         (0x04u)
+/** SelfTest_FPU_Registers, ignored on cores without FPU */
+#define STL_MULTICORE_TEST_FPU_REGS     (0x08u)
+/** \ref SelfTest_CPU_Instructions */
+#define STL_MULTICORE_TEST_CPU_INSTR    (0x10u)
+/** All tests */
+#define STL_MULTICORE_TEST_ALL          (0x1Fu)
+/** \ref SelfTest_MultiCore_GetFailedTests flag: the core did not publish a valid verdict */
+#define STL_MULTICORE_NO_VERDICT        (0x80u)
+
+/** \} group_multicore_macros */
+
+/**
+ * \addtogroup group_multicore_enums
+ * \{
+ */
+
+/** Core of the multi-core self-test */
+typedef enum
+{
+    STL_MULTICORE_PRIMARY   = 0u,   /**< CM0+, uses DATA bits 0-15 */
+    STL_MULTICORE_SECONDARY = 1u    /**< CM4 or CM7, uses DATA bits 16-31 */
+} stl_multicore_core_t;
+
+/** \} group_multicore_enums */
+
+/**
+ * \addtogroup group_multicore_functions
+ * \{
+ */
+
+/*******************************************************************************
+* Function Name: SelfTest_MultiCore_Init
+****************************************************************************//**
+*
+* This function clears the verdicts of both cores in the IPC channel. It is called by the
+* primary core before the secondary core is enabled.
+*
+* \return
+*  OK_STATUS    - The channel is cleared. <br>
+*  ERROR_STATUS - The channel lock could not be acquired.
+*
+*
+*******************************************************************************/
+uint8_t SelfTest_MultiCore_Init(void);
+
+/*******************************************************************************
+* Function Name: SelfTest_MultiCore_RunLocal
+****************************************************************************//**
+*
+* This function runs the selected tests on the calling core.
+*
+* \param tests
+* The STL_MULTICORE_TEST_* flags of the tests to run.
+*
+* \return
+* The STL_MULTICORE_TEST_* flags of the failed tests, 0 if all tests passed.
+*
+*
+*******************************************************************************/
+uint8_t SelfTest_MultiCore_RunLocal(uint8_t tests);
+
+/*******************************************************************************
+* Function Name: SelfTest_MultiCore_Start
+****************************************************************************//**
+*
+* This function runs the selected tests on the calling core, publishes the verdict in the IPC
+* channel, and starts the timeout for the verdict of the other core.
+*
+* \param core
+* The calling core.
+*
+* \param tests
+* The STL_MULTICORE_TEST_* flags of the tests to run.
+*
+* \param timeoutMs
+* The time the other core has to publish its verdict, counted from this call.
+*
+* \param timeStampMs
+* A free-running millisecond time stamp, for example the SysTick count. Wrap-around is handled.
+*
+* \return
+*  OK_STATUS    - The tests passed on the calling core. <br>
+*  ERROR_STATUS - A test failed on the calling core.
+*
+*
+*******************************************************************************/
+uint8_t SelfTest_MultiCore_Start(stl_multicore_core_t core, uint8_t tests, uint32_t timeoutMs,
+                                 uint32_t timeStampMs);
+
+/*******************************************************************************
+* Function Name: SelfTest_MultiCore_Check
+****************************************************************************//**
+*
+* This function checks the verdict of the other core. If the IPC channel was locked by the
+* other core at \ref SelfTest_MultiCore_Start, the own verdict is published first.
+*
+* \param timeStampMs
+* A free-running millisecond time stamp with the same base as in \ref SelfTest_MultiCore_Start.
+*
+* \return
+*  PASS_STILL_TESTING_STATUS - The verdict of the other core is not available yet. <br>
+*  PASS_COMPLETE_STATUS      - The tests passed on both cores. <br>
+*  ERROR_STATUS              - A test failed, \ref SelfTest_MultiCore_Start was not called, or
+*                              the other core did not publish a valid verdict in time.
+*
+*
+*******************************************************************************/
+uint8_t SelfTest_MultiCore_Check(uint32_t timeStampMs);
+
+/*******************************************************************************
+* Function Name: SelfTest_MultiCore
+****************************************************************************//**
+*
+* This function runs \ref SelfTest_MultiCore_Start and waits for \ref SelfTest_MultiCore_Check,
+* counting the time with Cy_SysLib_Delay().
+*
+* \param core
+* The calling core.
+*
+* \param tests
+* The STL_MULTICORE_TEST_* flags of the tests to run.
+*
+* \param timeoutMs
+* The time the other core has to publish its verdict after the local tests.
+*
+* \return
+*  OK_STATUS    - The tests passed on both cores. <br>
+*  ERROR_STATUS - A test failed, or the other core did not publish a valid verdict in time.
+*
+*
+*******************************************************************************/
+uint8_t SelfTest_MultiCore(stl_multicore_core_t core, uint8_t tests, uint32_t timeoutMs);
+
+/*******************************************************************************
+* Function Name: SelfTest_MultiCore_GetFailedTests
+****************************************************************************//**
+*
+* This function returns the failed tests of a core from the last check.
+*
+* \param core
+* The core.
+*
+* \return
+* The STL_MULTICORE_TEST_* flags of the failed tests, or \ref STL_MULTICORE_NO_VERDICT if the
+* core did not publish a valid verdict.
+*
+*
+*******************************************************************************/
+uint8_t SelfTest_MultiCore_GetFailedTests(stl_multicore_core_t core);
+
+/** \} group_multicore_functions */
+
+/** \cond INTERNAL */
+/* Verdict of one core in its half of the DATA register: flags in bits 0-7, complement in 8-15 */
+#define MULTICORE_VERDICT_VALID         (0x40u)
+#define MULTICORE_VERDICT_MASK          (0xFFFFUL)
+#define MULTICORE_VERDICT_SHIFT(core)   (16UL * (uint32_t)(core))
+#define MULTICORE_LOCK_RETRIES          (100UL)
+/** \endcond */
+
+#endif /* if (defined (CY_IP_M4CPUSS) || defined (CY_IP_M7CPUSS) || defined (CY_DOXYGEN)) */
+
+/** \} group_multicore */
+
+#endif /* SELFTEST_MULTICORE_H */
+
+
+/* [] END OF FILE */
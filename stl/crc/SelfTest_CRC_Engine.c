@@ -0,0 +1,356 @@
+/*******************************************************************************
+* File Name: SelfTest_CRC_Engine.c
+*
+* Description:
+*  This file provides the source code of the generic CRC engine with
+*  configurable width, polynomial, reflection, init, and final XOR value.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#include "cy_pdl.h"
+#include "SelfTest_CRC_Engine.h"
+
+/* Check string for the known-answer test */
+static const uint8_t crcEngineCheckData[STL_CRC_CHECK_LEN] =
+{
+    (uint8_t)'1', (uint8_t)'2', (uint8_t)'3', (uint8_t)'4', (uint8_t)'5',
+    (uint8_t)'6', (uint8_t)'7', (uint8_t)'8', (uint8_t)'9'
+};
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC_Reflect
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function reverses the order of the lower "width" bits of "val".
+ *
+ ******************************************************************************/
+static uint32_t SelfTests_CRC_Reflect(uint32_t val, uint32_t width)
+{
+    uint32_t res = 0UL;
+    uint32_t v = val;
+
+    for (uint32_t i = 0UL; i < width; i++)
+    {
+        res = (res << 1u) | (v & 1UL);
+        v >>= 1u;
+    }
+    return res;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC_Width_Mask
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function returns a mask of the lower "width" bits.
+ *
+ ******************************************************************************/
+static uint32_t SelfTests_CRC_Width_Mask(uint32_t width)
+{
+    return (width >= 32UL) ? 0xFFFFFFFFUL : (((uint32_t)1UL << width) - 1UL);
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC_Engine_Bits
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function shifts "bits" message bits, already XORed into the register,
+ *  through the CRC register one by one.
+ *
+ * Note:
+ *  The register form depends on the input reflection: a reflected register is
+ *  shifted right and kept in the lower bits, a normal register is shifted left
+ *  and kept in the upper bits, so that one implementation serves all widths.
+ *
+ ******************************************************************************/
+static uint32_t SelfTests_CRC_Engine_Bits(const stl_crc_engine_t* engine, uint32_t reg,
+                                          uint32_t bits)
+{
+    uint32_t calc_reg = reg;
+
+    for (uint32_t i = 0UL; i < bits; i++)
+    {
+        if (engine->cfg->refIn)
+        {
+            calc_reg = ((calc_reg & 1UL) != 0UL) ? ((calc_reg >> 1u) ^ engine->poly) :
+                       (calc_reg >> 1u);
+        }
+        else
+        {
+            calc_reg = ((calc_reg & 0x80000000UL) != 0UL) ? ((calc_reg << 1u) ^ engine->poly) :
+                       (calc_reg << 1u);
+        }
+    }
+    return calc_reg;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC_Engine_Init
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function checks the CRC definition, converts the polynomial and the
+ *  init value into the register form, and generates the lookup table.
+ *
+ * Parameters:
+ *  stl_crc_engine_t* engine - The engine to initialize.
+ *  const stl_crc_cfg_t* cfg - The CRC definition.
+ *  stl_crc_table_mode_t mode - The lookup table size.
+ *  uint32_t* table - The table buffer with "mode" entries.
+ *
+ * Return:
+ *  OK_STATUS - The engine is ready.
+ *  ERROR_STATUS - Invalid width or missing table buffer.
+ *
+ ******************************************************************************/
+uint8_t SelfTests_CRC_Engine_Init(stl_crc_engine_t* engine, const stl_crc_cfg_t* cfg,
+                                  stl_crc_table_mode_t mode, uint32_t* table)
+{
+    uint32_t width;
+    uint32_t idxBits;
+
+    if ((cfg == NULL) || (cfg->width == 0u) || (cfg->width > 32u) ||
+        ((mode != STL_CRC_TABLE_NONE) && (mode != STL_CRC_TABLE_NIBBLE) &&
+         (mode != STL_CRC_TABLE_BYTE)) ||
+        ((mode != STL_CRC_TABLE_NONE) && (table == NULL)))
+    {
+        return ERROR_STATUS;
+    }
+
+    width = cfg->width;
+    engine->cfg = cfg;
+    engine->mode = mode;
+    engine->table = table;
+
+    if (cfg->refIn)
+    {
+        engine->poly = SelfTests_CRC_Reflect(cfg->poly, width);
+        engine->init = SelfTests_CRC_Reflect(cfg->init, width);
+    }
+    else
+    {
+        engine->poly = (cfg->poly & SelfTests_CRC_Width_Mask(width)) << (32UL - width);
+        engine->init = (cfg->init & SelfTests_CRC_Width_Mask(width)) << (32UL - width);
+    }
+
+    if (mode != STL_CRC_TABLE_NONE)
+    {
+        /* Entry i is the register after shifting in the index bits from a zero register */
+        idxBits = (mode == STL_CRC_TABLE_BYTE) ? 8UL : 4UL;
+        for (uint32_t i = 0UL; i < (uint32_t)mode; i++)
+        {
+            table[i] = SelfTests_CRC_Engine_Bits(engine, cfg->refIn ? i : (i << (32UL - idxBits)),
+                                                 idxBits);
+        }
+    }
+
+    return OK_STATUS;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC_Engine_Start
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function returns the CRC register at the start of a calculation.
+ *
+ * Parameters:
+ *  const stl_crc_engine_t* engine - The engine.
+ *
+ * Return:
+ *  uint32_t - The CRC register.
+ *
+ ******************************************************************************/
+uint32_t SelfTests_CRC_Engine_Start(const stl_crc_engine_t* engine)
+{
+    return engine->init;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC_Engine_Update
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function feeds the area defined in the parameters "BaseAdress" and
+ *  "len" into the CRC register, using the table selected at init.
+ *
+ * Parameters:
+ *  const stl_crc_engine_t* engine - The engine.
+ *  uint32_t reg - The CRC register.
+ *  uint32_t BaseAdress - The address from which to calculate the CRC.
+ *  uint32_t len - The length of the area for CRC calculation.
+ *
+ * Return:
+ *  uint32_t - The updated CRC register.
+ *
+ ******************************************************************************/
+uint32_t SelfTests_CRC_Engine_Update(const stl_crc_engine_t* engine, uint32_t reg,
+                                     uint32_t BaseAdress, uint32_t len)
+{
+    const uint8_t* regPointer = (const uint8_t*)BaseAdress;
+    const uint32_t* tab = engine->table;
+    uint32_t calc_reg = reg;
+    uint32_t val;
+
+    for (uint32_t i = 0UL; i < len; i++)
+    {
+        val = regPointer[i];
+
+        if (engine->cfg->refIn)
+        {
+            if (engine->mode == STL_CRC_TABLE_BYTE)
+            {
+                calc_reg = tab[(calc_reg ^ val) & 0xFFUL] ^ (calc_reg >> 8u);
+            }
+            else if (engine->mode == STL_CRC_TABLE_NIBBLE)
+            {
+                calc_reg = tab[(calc_reg ^ val) & 0x0FUL] ^ (calc_reg >> 4u);
+                calc_reg = tab[(calc_reg ^ (val >> 4u)) & 0x0FUL] ^ (calc_reg >> 4u);
+            }
+            else
+            {
+                calc_reg = SelfTests_CRC_Engine_Bits(engine, calc_reg ^ val, 8UL);
+            }
+        }
+        else
+        {
+            if (engine->mode == STL_CRC_TABLE_BYTE)
+            {
+                calc_reg = tab[(calc_reg >> 24u) ^ val] ^ (calc_reg << 8u);
+            }
+            else if (engine->mode == STL_CRC_TABLE_NIBBLE)
+            {
+                calc_reg = tab[(calc_reg >> 28u) ^ (val >> 4u)] ^ (calc_reg << 4u);
+                calc_reg = tab[(calc_reg >> 28u) ^ (val & 0x0FUL)] ^ (calc_reg << 4u);
+            }
+            else
+            {
+                calc_reg = SelfTests_CRC_Engine_Bits(engine, calc_reg ^ (val << 24u), 8UL);
+            }
+        }
+    }
+
+    return calc_reg;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC_Engine_Final
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function converts the CRC register into the CRC value: output
+ *  reflection and final XOR.
+ *
+ * Parameters:
+ *  const stl_crc_engine_t* engine - The engine.
+ *  uint32_t reg - The CRC register.
+ *
+ * Return:
+ *  uint32_t - The CRC value.
+ *
+ ******************************************************************************/
+uint32_t SelfTests_CRC_Engine_Final(const stl_crc_engine_t* engine, uint32_t reg)
+{
+    uint32_t width = engine->cfg->width;
+    uint32_t val = engine->cfg->refIn ? reg : (reg >> (32UL - width));
+
+    if (engine->cfg->refIn != engine->cfg->refOut)
+    {
+        val = SelfTests_CRC_Reflect(val, width);
+    }
+
+    return (val ^ engine->cfg->xorOut) & SelfTests_CRC_Width_Mask(width);
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC_Engine_Calc
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function calculates the CRC of the area defined in the parameters
+ *  "BaseAdress" and "len".
+ *
+ * Parameters:
+ *  const stl_crc_engine_t* engine - The engine.
+ *  uint32_t BaseAdress - The address from which to calculate the CRC.
+ *  uint32_t len - The length of the area for CRC calculation.
+ *
+ * Return:
+ *  uint32_t - The CRC value.
+ *
+ ******************************************************************************/
+uint32_t SelfTests_CRC_Engine_Calc(const stl_crc_engine_t* engine, uint32_t BaseAdress,
+                                   uint32_t len)
+{
+    uint32_t reg = SelfTests_CRC_Engine_Start(engine);
+
+    reg = SelfTests_CRC_Engine_Update(engine, reg, BaseAdress, len);
+    return SelfTests_CRC_Engine_Final(engine, reg);
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC_Engine_KAT
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function calculates the CRC of "123456789" and compares it with the
+ *  check value of the configuration.
+ *
+ * Parameters:
+ *  const stl_crc_engine_t* engine - The engine.
+ *
+ * Return:
+ *  OK_STATUS - The test passed.
+ *  ERROR_STATUS - The result differs from the check value.
+ *
+ ******************************************************************************/
+uint8_t SelfTests_CRC_Engine_KAT(const stl_crc_engine_t* engine)
+{
+    uint32_t crc = SelfTests_CRC_Engine_Calc(engine, (uint32_t)crcEngineCheckData,
+                                             STL_CRC_CHECK_LEN);
+
+    return (crc == (engine->cfg->check & SelfTests_CRC_Width_Mask(engine->cfg->width))) ?
+           OK_STATUS : ERROR_STATUS;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,310 @@
+/*******************************************************************************
+* File Name: SelfTest_CRC_Engine.h
+*
+* Description:
+*  This file provides function prototypes, constants, and parameter values
+*  used for the generic CRC engine with configurable polynomial.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+/**
+ * \addtogroup group_crc_engine
+ * \{
+ *
+ * The generic CRC engine calculates any CRC of width 1 to 32 bits that is described by the
+ * usual parameter set: polynomial, input and output reflection, init value, and final XOR
+ * value. It is used for protocol CRCs that are not covered by the fixed functions in
+ * \ref group_crc, for example CRC-8 for CAN-based protocols, CRC-16/MODBUS, CRC-24, or
+ * CRC-32/AUTOSAR.
+ *
+ * \section group_crc_engine_more_information More Information
+ *
+ * The lookup table is generated by \ref SelfTests_CRC_Engine_Init into a buffer provided by the
+ * caller, so only the CRCs that are used take memory. The table size is selected per engine:
+ *      1) \ref STL_CRC_TABLE_BYTE - 256 entries, one lookup per byte.
+ *      2) \ref STL_CRC_TABLE_NIBBLE - 16 entries, two lookups per byte, for parts with little
+ *         memory such as PSOC 4.
+ *      3) \ref STL_CRC_TABLE_NONE - no table, eight shift steps per byte.
+ *
+ * Each configuration carries its check value, the CRC of the ASCII string "123456789".
+ * \ref SelfTests_CRC_Engine_KAT runs this known-answer test on the engine, which checks the
+ * configuration and the generated table together.
+ *
+ * The STL_CRC_CFG_* macros initialize \ref stl_crc_cfg_t with common CRC definitions:
+ * \code
+ * static const stl_crc_cfg_t modbusCfg = STL_CRC_CFG_CRC16_MODBUS;
+ * static uint32_t modbusTable[STL_CRC_TABLE_BYTE];
+ * static stl_crc_engine_t modbusCrc;
+ *
+ * if ((SelfTests_CRC_Engine_Init(&modbusCrc, &modbusCfg, STL_CRC_TABLE_BYTE,
+ *                                modbusTable) != OK_STATUS) ||
+ *     (SelfTests_CRC_Engine_KAT(&modbusCrc) != OK_STATUS))
+ * {
+ *     // Process error
+ * }
+ * crc = SelfTests_CRC_Engine_Calc(&modbusCrc, (uint32_t)frame, frameLen);
+ * \endcode
+ *
+ * \defgroup group_crc_engine_macros Macros
+ * \defgroup group_crc_engine_enums Enumerated Types
+ * \defgroup group_crc_engine_data_structures Data Structures
+ * \defgroup group_crc_engine_functions Functions
+ */
+
+#if !defined(SELFTEST_CRC_ENGINE_H)
+    #define SELFTEST_CRC_ENGINE_H
+
+#include "cy_pdl.h"
+#include "SelfTest_common.h"
+
+/** \addtogroup group_crc_engine_macros
+ * \{
+ */
+
+/** Length of the check string "123456789" used by the known-answer test */
+#define STL_CRC_CHECK_LEN           (9u)
+
+/* Initializers for stl_crc_cfg_t:
+   {width, poly, init, refIn, refOut, xorOut, check} */
+
+/** CRC-8/SAE-J1850 (CAN-based protocols) */
+#define STL_CRC_CFG_CRC8_SAE_J1850  { 8u, 0x1DUL, 0xFFUL, false, false, 0xFFUL, 0x4BUL }
+
+/** CRC-8/AUTOSAR */
+#define STL_CRC_CFG_CRC8_AUTOSAR    { 8u, 0x2FUL, 0xFFUL, false, false, 0xFFUL, 0xDFUL }
+
+/** CRC-16/MODBUS (Modbus RTU) */
+#define STL_CRC_CFG_CRC16_MODBUS    { 16u, 0x8005UL, 0xFFFFUL, true, true, 0x0000UL, 0x4B37UL }
+
+/** CRC-16/XMODEM, equal to \ref SelfTests_CRC16_CCITT */
+#define STL_CRC_CFG_CRC16_XMODEM    { 16u, 0x1021UL, 0x0000UL, false, false, 0x0000UL, 0x31C3UL }
+
+/** CRC-24/OPENPGP */
+#define STL_CRC_CFG_CRC24_OPENPGP   { 24u, 0x864CFBUL, 0xB704CEUL, false, false, 0x000000UL, \
+                                      0x21CF02UL }
+
+/** CRC-32/ISO-HDLC, equal to \ref SelfTests_CRC32_IEEE */
+#define STL_CRC_CFG_CRC32_IEEE      { 32u, 0x04C11DB7UL, 0xFFFFFFFFUL, true, true, 0xFFFFFFFFUL, \
+                                      0xCBF43926UL }
+
+/** CRC-32/AUTOSAR */
+#define STL_CRC_CFG_CRC32_AUTOSAR   { 32u, 0xF4ACFB13UL, 0xFFFFFFFFUL, true, true, 0xFFFFFFFFUL, \
+                                      0x1697D06AUL }
+
+/** \} group_crc_engine_macros */
+
+/**
+ * \addtogroup group_crc_engine_enums
+ * \{
+ */
+
+/** Lookup table size, equal to the number of uint32_t entries of the table buffer */
+typedef enum
+{
+    STL_CRC_TABLE_NONE   = 0u,      /**< Bit by bit, no table */
+    STL_CRC_TABLE_NIBBLE = 16u,     /**< 16 entries, 4 bits per lookup */
+    STL_CRC_TABLE_BYTE   = 256u     /**< 256 entries, 8 bits per lookup */
+} stl_crc_table_mode_t;
+
+/** \} group_crc_engine_enums */
+
+/**
+ * \addtogroup group_crc_engine_data_structures
+ * \{
+ */
+
+/** CRC definition */
+typedef struct
+{
+    uint8_t width;      /**< CRC width in bits, 1 to 32 */
+    uint32_t poly;      /**< Polynomial, not reflected, without the x^width term */
+    uint32_t init;      /**< Init value, not reflected */
+    bool refIn;         /**< Input bytes are processed LSB first */
+    bool refOut;        /**< The result is reflected before the final XOR */
+    uint32_t xorOut;    /**< Final XOR value */
+    uint32_t check;     /**< CRC of the ASCII string "123456789" */
+} stl_crc_cfg_t;
+
+/** CRC engine, initialized by \ref SelfTests_CRC_Engine_Init */
+typedef struct
+{
+    const stl_crc_cfg_t* cfg;       /**< CRC definition */
+    const uint32_t* table;          /**< Lookup table in the caller buffer */
+    stl_crc_table_mode_t mode;      /**< Lookup table size */
+    uint32_t poly;                  /**< Polynomial in register form */
+    uint32_t init;                  /**< Init value in register form */
+} stl_crc_engine_t;
+
+/** \} group_crc_engine_data_structures */
+
+/**
+ * \addtogroup group_crc_engine_functions
+ * \{
+ */
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC_Engine_Init
+****************************************************************************//**
+*
+* This function checks the CRC definition and generates the lookup table into "table".
+*
+* \param engine
+* The engine to initialize.
+*
+* \param cfg
+* The CRC definition. It is referenced by the engine and must stay valid.
+*
+* \param mode
+* The lookup table size.
+*
+* \param table
+* The buffer for "mode" uint32_t entries, may be NULL for \ref STL_CRC_TABLE_NONE.
+*
+* \return
+*  OK_STATUS    - The engine is ready. <br>
+*  ERROR_STATUS - The width is not 1 to 32, or the table buffer is missing.
+*
+*
+*******************************************************************************/
+uint8_t SelfTests_CRC_Engine_Init(stl_crc_engine_t* engine, const stl_crc_cfg_t* cfg,
+                                  stl_crc_table_mode_t mode, uint32_t* table);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC_Engine_Start
+****************************************************************************//**
+*
+* This function returns the CRC register at the start of a calculation.
+*
+* \param engine
+* The engine.
+*
+* \return
+* The CRC register.
+*
+*
+*******************************************************************************/
+uint32_t SelfTests_CRC_Engine_Start(const stl_crc_engine_t* engine);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC_Engine_Update
+****************************************************************************//**
+*
+* This function feeds the memory area defined in parameters "BaseAdress" and "len" into the
+* CRC register.
+*
+* \param engine
+* The engine.
+*
+* \param reg
+* The CRC register from \ref SelfTests_CRC_Engine_Start or a previous update.
+*
+* \param BaseAdress
+* The address from which to calculate the CRC.
+*
+* \param len
+* The length of the area for CRC calculation.
+*
+* \return
+* The updated CRC register.
+*
+*
+*******************************************************************************/
+uint32_t SelfTests_CRC_Engine_Update(const stl_crc_engine_t* engine, uint32_t reg,
+                                     uint32_t BaseAdress, uint32_t len);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC_Engine_Final
+****************************************************************************//**
+*
+* This function applies the output reflection and the final XOR to the CRC register.
+*
+* \param engine
+* The engine.
+*
+* \param reg
+* The CRC register.
+*
+* \return
+* The CRC value.
+*
+*
+*******************************************************************************/
+uint32_t SelfTests_CRC_Engine_Final(const stl_crc_engine_t* engine, uint32_t reg);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC_Engine_Calc
+****************************************************************************//**
+*
+* This function calculates the CRC of the memory area defined in parameters "BaseAdress" and
+* "len".
+*
+* \param engine
+* The engine.
+*
+* \param BaseAdress
+* The address from which to calculate the CRC.
+*
+* \param len
+* The length of the area for CRC calculation.
+*
+* \return
+* The CRC value.
+*
+*
+*******************************************************************************/
+uint32_t SelfTests_CRC_Engine_Calc(const stl_crc_engine_t* engine, uint32_t BaseAdress,
+                                   uint32_t len);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC_Engine_KAT
+****************************************************************************//**
+*
+* This function runs the known-answer test: the CRC of "123456789" must equal the check value
+* of the configuration.
+*
+* \param engine
+* The engine.
+*
+* \return
+*  OK_STATUS    - The test passed. <br>
+*  ERROR_STATUS - The result differs from the check value.
+*
+*
+*******************************************************************************/
+uint8_t SelfTests_CRC_Engine_KAT(const stl_crc_engine_t* engine);
+
+/** \} group_crc_engine_functions */
+
+/** \} group_crc_engine */
+
+#endif /* SELFTEST_CRC_ENGINE_H */
+
+
+/* [] END OF FILE */
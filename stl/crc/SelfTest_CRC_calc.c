@@ -35,6 +35,8 @@
 *******************************************************************************/
 
 #include "SelfTest_CRC_calc.h"
+#include "SelfTest_CRC_Engine.h"
+#include "SelfTest_ErrorInjection.h"
 
 
 /*******************************************************************************
@@ -111,6 +113,392 @@ static const uint32_t CRC_32_Tab[256] =
     0x07678580uL, 0xeadf06a0uL
 };
 
+/*******************************************************************************
+ * Slice-by-4 tables for the standard CRC-32 (IEEE 802.3) calculation
+ ********************************************************************************
+ * Poly (reflected):
+ *  0xEDB88320
+ * Table [k][i] is the CRC of byte i followed by k zero bytes.
+ ********************************************************************************/
+static const uint32_t CRC_32_IEEE_Tab[CRC32_SLICES][256] =
+{
+    {
+        0x00000000uL, 0x77073096uL, 0xee0e612cuL, 0x990951bauL, 0x076dc419uL, 0x706af48fuL,
+        0xe963a535uL, 0x9e6495a3uL, 0x0edb8832uL, 0x79dcb8a4uL, 0xe0d5e91euL, 0x97d2d988uL,
+        0x09b64c2buL, 0x7eb17cbduL, 0xe7b82d07uL, 0x90bf1d91uL, 0x1db71064uL, 0x6ab020f2uL,
+        0xf3b97148uL, 0x84be41deuL, 0x1adad47duL, 0x6ddde4ebuL, 0xf4d4b551uL, 0x83d385c7uL,
+        0x136c9856uL, 0x646ba8c0uL, 0xfd62f97auL, 0x8a65c9ecuL, 0x14015c4fuL, 0x63066cd9uL,
+        0xfa0f3d63uL, 0x8d080df5uL, 0x3b6e20c8uL, 0x4c69105euL, 0xd56041e4uL, 0xa2677172uL,
+        0x3c03e4d1uL, 0x4b04d447uL, 0xd20d85fduL, 0xa50ab56buL, 0x35b5a8fauL, 0x42b2986cuL,
+        0xdbbbc9d6uL, 0xacbcf940uL, 0x32d86ce3uL, 0x45df5c75uL, 0xdcd60dcfuL, 0xabd13d59uL,
+        0x26d930acuL, 0x51de003auL, 0xc8d75180uL, 0xbfd06116uL, 0x21b4f4b5uL, 0x56b3c423uL,
+        0xcfba9599uL, 0xb8bda50fuL, 0x2802b89euL, 0x5f058808uL, 0xc60cd9b2uL, 0xb10be924uL,
+        0x2f6f7c87uL, 0x58684c11uL, 0xc1611dabuL, 0xb6662d3duL, 0x76dc4190uL, 0x01db7106uL,
+        0x98d220bcuL, 0xefd5102auL, 0x71b18589uL, 0x06b6b51fuL, 0x9fbfe4a5uL, 0xe8b8d433uL,
+        0x7807c9a2uL, 0x0f00f934uL, 0x9609a88euL, 0xe10e9818uL, 0x7f6a0dbbuL, 0x086d3d2duL,
+        0x91646c97uL, 0xe6635c01uL, 0x6b6b51f4uL, 0x1c6c6162uL, 0x856530d8uL, 0xf262004euL,
+        0x6c0695eduL, 0x1b01a57buL, 0x8208f4c1uL, 0xf50fc457uL, 0x65b0d9c6uL, 0x12b7e950uL,
+        0x8bbeb8eauL, 0xfcb9887cuL, 0x62dd1ddfuL, 0x15da2d49uL, 0x8cd37cf3uL, 0xfbd44c65uL,
+        0x4db26158uL, 0x3ab551ceuL, 0xa3bc0074uL, 0xd4bb30e2uL, 0x4adfa541uL, 0x3dd895d7uL,
+        0xa4d1c46duL, 0xd3d6f4fbuL, 0x4369e96auL, 0x346ed9fcuL, 0xad678846uL, 0xda60b8d0uL,
+        0x44042d73uL, 0x33031de5uL, 0xaa0a4c5fuL, 0xdd0d7cc9uL, 0x5005713cuL, 0x270241aauL,
+        0xbe0b1010uL, 0xc90c2086uL, 0x5768b525uL, 0x206f85b3uL, 0xb966d409uL, 0xce61e49fuL,
+        0x5edef90euL, 0x29d9c998uL, 0xb0d09822uL, 0xc7d7a8b4uL, 0x59b33d17uL, 0x2eb40d81uL,
+        0xb7bd5c3buL, 0xc0ba6caduL, 0xedb88320uL, 0x9abfb3b6uL, 0x03b6e20cuL, 0x74b1d29auL,
+        0xead54739uL, 0x9dd277afuL, 0x04db2615uL, 0x73dc1683uL, 0xe3630b12uL, 0x94643b84uL,
+        0x0d6d6a3euL, 0x7a6a5aa8uL, 0xe40ecf0buL, 0x9309ff9duL, 0x0a00ae27uL, 0x7d079eb1uL,
+        0xf00f9344uL, 0x8708a3d2uL, 0x1e01f268uL, 0x6906c2feuL, 0xf762575duL, 0x806567cbuL,
+        0x196c3671uL, 0x6e6b06e7uL, 0xfed41b76uL, 0x89d32be0uL, 0x10da7a5auL, 0x67dd4accuL,
+        0xf9b9df6fuL, 0x8ebeeff9uL, 0x17b7be43uL, 0x60b08ed5uL, 0xd6d6a3e8uL, 0xa1d1937euL,
+        0x38d8c2c4uL, 0x4fdff252uL, 0xd1bb67f1uL, 0xa6bc5767uL, 0x3fb506dduL, 0x48b2364buL,
+        0xd80d2bdauL, 0xaf0a1b4cuL, 0x36034af6uL, 0x41047a60uL, 0xdf60efc3uL, 0xa867df55uL,
+        0x316e8eefuL, 0x4669be79uL, 0xcb61b38cuL, 0xbc66831auL, 0x256fd2a0uL, 0x5268e236uL,
+        0xcc0c7795uL, 0xbb0b4703uL, 0x220216b9uL, 0x5505262fuL, 0xc5ba3bbeuL, 0xb2bd0b28uL,
+        0x2bb45a92uL, 0x5cb36a04uL, 0xc2d7ffa7uL, 0xb5d0cf31uL, 0x2cd99e8buL, 0x5bdeae1duL,
+        0x9b64c2b0uL, 0xec63f226uL, 0x756aa39cuL, 0x026d930auL, 0x9c0906a9uL, 0xeb0e363fuL,
+        0x72076785uL, 0x05005713uL, 0x95bf4a82uL, 0xe2b87a14uL, 0x7bb12baeuL, 0x0cb61b38uL,
+        0x92d28e9buL, 0xe5d5be0duL, 0x7cdcefb7uL, 0x0bdbdf21uL, 0x86d3d2d4uL, 0xf1d4e242uL,
+        0x68ddb3f8uL, 0x1fda836euL, 0x81be16cduL, 0xf6b9265buL, 0x6fb077e1uL, 0x18b74777uL,
+        0x88085ae6uL, 0xff0f6a70uL, 0x66063bcauL, 0x11010b5cuL, 0x8f659effuL, 0xf862ae69uL,
+        0x616bffd3uL, 0x166ccf45uL, 0xa00ae278uL, 0xd70dd2eeuL, 0x4e048354uL, 0x3903b3c2uL,
+        0xa7672661uL, 0xd06016f7uL, 0x4969474duL, 0x3e6e77dbuL, 0xaed16a4auL, 0xd9d65adcuL,
+        0x40df0b66uL, 0x37d83bf0uL, 0xa9bcae53uL, 0xdebb9ec5uL, 0x47b2cf7fuL, 0x30b5ffe9uL,
+        0xbdbdf21cuL, 0xcabac28auL, 0x53b39330uL, 0x24b4a3a6uL, 0xbad03605uL, 0xcdd70693uL,
+        0x54de5729uL, 0x23d967bfuL, 0xb3667a2euL, 0xc4614ab8uL, 0x5d681b02uL, 0x2a6f2b94uL,
+        0xb40bbe37uL, 0xc30c8ea1uL, 0x5a05df1buL, 0x2d02ef8duL
+    },
+    #if (CRC32_SLICES == 4u)
+    {
+        0x00000000uL, 0x191b3141uL, 0x32366282uL, 0x2b2d53c3uL, 0x646cc504uL, 0x7d77f445uL,
+        0x565aa786uL, 0x4f4196c7uL, 0xc8d98a08uL, 0xd1c2bb49uL, 0xfaefe88auL, 0xe3f4d9cbuL,
+        0xacb54f0cuL, 0xb5ae7e4duL, 0x9e832d8euL, 0x87981ccfuL, 0x4ac21251uL, 0x53d92310uL,
+        0x78f470d3uL, 0x61ef4192uL, 0x2eaed755uL, 0x37b5e614uL, 0x1c98b5d7uL, 0x05838496uL,
+        0x821b9859uL, 0x9b00a918uL, 0xb02dfadbuL, 0xa936cb9auL, 0xe6775d5duL, 0xff6c6c1cuL,
+        0xd4413fdfuL, 0xcd5a0e9euL, 0x958424a2uL, 0x8c9f15e3uL, 0xa7b24620uL, 0xbea97761uL,
+        0xf1e8e1a6uL, 0xe8f3d0e7uL, 0xc3de8324uL, 0xdac5b265uL, 0x5d5daeaauL, 0x44469febuL,
+        0x6f6bcc28uL, 0x7670fd69uL, 0x39316baeuL, 0x202a5aefuL, 0x0b07092cuL, 0x121c386duL,
+        0xdf4636f3uL, 0xc65d07b2uL, 0xed705471uL, 0xf46b6530uL, 0xbb2af3f7uL, 0xa231c2b6uL,
+        0x891c9175uL, 0x9007a034uL, 0x179fbcfbuL, 0x0e848dbauL, 0x25a9de79uL, 0x3cb2ef38uL,
+        0x73f379ffuL, 0x6ae848beuL, 0x41c51b7duL, 0x58de2a3cuL, 0xf0794f05uL, 0xe9627e44uL,
+        0xc24f2d87uL, 0xdb541cc6uL, 0x94158a01uL, 0x8d0ebb40uL, 0xa623e883uL, 0xbf38d9c2uL,
+        0x38a0c50duL, 0x21bbf44cuL, 0x0a96a78fuL, 0x138d96ceuL, 0x5ccc0009uL, 0x45d73148uL,
+        0x6efa628buL, 0x77e153cauL, 0xbabb5d54uL, 0xa3a06c15uL, 0x888d3fd6uL, 0x91960e97uL,
+        0xded79850uL, 0xc7cca911uL, 0xece1fad2uL, 0xf5facb93uL, 0x7262d75cuL, 0x6b79e61duL,
+        0x4054b5deuL, 0x594f849fuL, 0x160e1258uL, 0x0f152319uL, 0x243870dauL, 0x3d23419buL,
+        0x65fd6ba7uL, 0x7ce65ae6uL, 0x57cb0925uL, 0x4ed03864uL, 0x0191aea3uL, 0x188a9fe2uL,
+        0x33a7cc21uL, 0x2abcfd60uL, 0xad24e1afuL, 0xb43fd0eeuL, 0x9f12832duL, 0x8609b26cuL,
+        0xc94824abuL, 0xd05315eauL, 0xfb7e4629uL, 0xe2657768uL, 0x2f3f79f6uL, 0x362448b7uL,
+        0x1d091b74uL, 0x04122a35uL, 0x4b53bcf2uL, 0x52488db3uL, 0x7965de70uL, 0x607eef31uL,
+        0xe7e6f3feuL, 0xfefdc2bfuL, 0xd5d0917cuL, 0xcccba03duL, 0x838a36fauL, 0x9a9107bbuL,
+        0xb1bc5478uL, 0xa8a76539uL, 0x3b83984buL, 0x2298a90auL, 0x09b5fac9uL, 0x10aecb88uL,
+        0x5fef5d4fuL, 0x46f46c0euL, 0x6dd93fcduL, 0x74c20e8cuL, 0xf35a1243uL, 0xea412302uL,
+        0xc16c70c1uL, 0xd8774180uL, 0x9736d747uL, 0x8e2de606uL, 0xa500b5c5uL, 0xbc1b8484uL,
+        0x71418a1auL, 0x685abb5buL, 0x4377e898uL, 0x5a6cd9d9uL, 0x152d4f1euL, 0x0c367e5fuL,
+        0x271b2d9cuL, 0x3e001cdduL, 0xb9980012uL, 0xa0833153uL, 0x8bae6290uL, 0x92b553d1uL,
+        0xddf4c516uL, 0xc4eff457uL, 0xefc2a794uL, 0xf6d996d5uL, 0xae07bce9uL, 0xb71c8da8uL,
+        0x9c31de6buL, 0x852aef2auL, 0xca6b79eduL, 0xd37048acuL, 0xf85d1b6fuL, 0xe1462a2euL,
+        0x66de36e1uL, 0x7fc507a0uL, 0x54e85463uL, 0x4df36522uL, 0x02b2f3e5uL, 0x1ba9c2a4uL,
+        0x30849167uL, 0x299fa026uL, 0xe4c5aeb8uL, 0xfdde9ff9uL, 0xd6f3cc3auL, 0xcfe8fd7buL,
+        0x80a96bbcuL, 0x99b25afduL, 0xb29f093euL, 0xab84387fuL, 0x2c1c24b0uL, 0x350715f1uL,
+        0x1e2a4632uL, 0x07317773uL, 0x4870e1b4uL, 0x516bd0f5uL, 0x7a468336uL, 0x635db277uL,
+        0xcbfad74euL, 0xd2e1e60fuL, 0xf9ccb5ccuL, 0xe0d7848duL, 0xaf96124auL, 0xb68d230buL,
+        0x9da070c8uL, 0x84bb4189uL, 0x03235d46uL, 0x1a386c07uL, 0x31153fc4uL, 0x280e0e85uL,
+        0x674f9842uL, 0x7e54a903uL, 0x5579fac0uL, 0x4c62cb81uL, 0x8138c51fuL, 0x9823f45euL,
+        0xb30ea79duL, 0xaa1596dcuL, 0xe554001buL, 0xfc4f315auL, 0xd7626299uL, 0xce7953d8uL,
+        0x49e14f17uL, 0x50fa7e56uL, 0x7bd72d95uL, 0x62cc1cd4uL, 0x2d8d8a13uL, 0x3496bb52uL,
+        0x1fbbe891uL, 0x06a0d9d0uL, 0x5e7ef3ecuL, 0x4765c2aduL, 0x6c48916euL, 0x7553a02fuL,
+        0x3a1236e8uL, 0x230907a9uL, 0x0824546auL, 0x113f652buL, 0x96a779e4uL, 0x8fbc48a5uL,
+        0xa4911b66uL, 0xbd8a2a27uL, 0xf2cbbce0uL, 0xebd08da1uL, 0xc0fdde62uL, 0xd9e6ef23uL,
+        0x14bce1bduL, 0x0da7d0fcuL, 0x268a833fuL, 0x3f91b27euL, 0x70d024b9uL, 0x69cb15f8uL,
+        0x42e6463buL, 0x5bfd777auL, 0xdc656bb5uL, 0xc57e5af4uL, 0xee530937uL, 0xf7483876uL,
+        0xb809aeb1uL, 0xa1129ff0uL, 0x8a3fcc33uL, 0x9324fd72uL
+    },
+    {
+        0x00000000uL, 0x01c26a37uL, 0x0384d46euL, 0x0246be59uL, 0x0709a8dcuL, 0x06cbc2ebuL,
+        0x048d7cb2uL, 0x054f1685uL, 0x0e1351b8uL, 0x0fd13b8fuL, 0x0d9785d6uL, 0x0c55efe1uL,
+        0x091af964uL, 0x08d89353uL, 0x0a9e2d0auL, 0x0b5c473duL, 0x1c26a370uL, 0x1de4c947uL,
+        0x1fa2771euL, 0x1e601d29uL, 0x1b2f0bacuL, 0x1aed619buL, 0x18abdfc2uL, 0x1969b5f5uL,
+        0x1235f2c8uL, 0x13f798ffuL, 0x11b126a6uL, 0x10734c91uL, 0x153c5a14uL, 0x14fe3023uL,
+        0x16b88e7auL, 0x177ae44duL, 0x384d46e0uL, 0x398f2cd7uL, 0x3bc9928euL, 0x3a0bf8b9uL,
+        0x3f44ee3cuL, 0x3e86840buL, 0x3cc03a52uL, 0x3d025065uL, 0x365e1758uL, 0x379c7d6fuL,
+        0x35dac336uL, 0x3418a901uL, 0x3157bf84uL, 0x3095d5b3uL, 0x32d36beauL, 0x331101dduL,
+        0x246be590uL, 0x25a98fa7uL, 0x27ef31feuL, 0x262d5bc9uL, 0x23624d4cuL, 0x22a0277buL,
+        0x20e69922uL, 0x2124f315uL, 0x2a78b428uL, 0x2bbade1fuL, 0x29fc6046uL, 0x283e0a71uL,
+        0x2d711cf4uL, 0x2cb376c3uL, 0x2ef5c89auL, 0x2f37a2aduL, 0x709a8dc0uL, 0x7158e7f7uL,
+        0x731e59aeuL, 0x72dc3399uL, 0x7793251cuL, 0x76514f2buL, 0x7417f172uL, 0x75d59b45uL,
+        0x7e89dc78uL, 0x7f4bb64fuL, 0x7d0d0816uL, 0x7ccf6221uL, 0x798074a4uL, 0x78421e93uL,
+        0x7a04a0cauL, 0x7bc6cafduL, 0x6cbc2eb0uL, 0x6d7e4487uL, 0x6f38fadeuL, 0x6efa90e9uL,
+        0x6bb5866cuL, 0x6a77ec5buL, 0x68315202uL, 0x69f33835uL, 0x62af7f08uL, 0x636d153fuL,
+        0x612bab66uL, 0x60e9c151uL, 0x65a6d7d4uL, 0x6464bde3uL, 0x662203bauL, 0x67e0698duL,
+        0x48d7cb20uL, 0x4915a117uL, 0x4b531f4euL, 0x4a917579uL, 0x4fde63fcuL, 0x4e1c09cbuL,
+        0x4c5ab792uL, 0x4d98dda5uL, 0x46c49a98uL, 0x4706f0afuL, 0x45404ef6uL, 0x448224c1uL,
+        0x41cd3244uL, 0x400f5873uL, 0x4249e62auL, 0x438b8c1duL, 0x54f16850uL, 0x55330267uL,
+        0x5775bc3euL, 0x56b7d609uL, 0x53f8c08cuL, 0x523aaabbuL, 0x507c14e2uL, 0x51be7ed5uL,
+        0x5ae239e8uL, 0x5b2053dfuL, 0x5966ed86uL, 0x58a487b1uL, 0x5deb9134uL, 0x5c29fb03uL,
+        0x5e6f455auL, 0x5fad2f6duL, 0xe1351b80uL, 0xe0f771b7uL, 0xe2b1cfeeuL, 0xe373a5d9uL,
+        0xe63cb35cuL, 0xe7fed96buL, 0xe5b86732uL, 0xe47a0d05uL, 0xef264a38uL, 0xeee4200fuL,
+        0xeca29e56uL, 0xed60f461uL, 0xe82fe2e4uL, 0xe9ed88d3uL, 0xebab368auL, 0xea695cbduL,
+        0xfd13b8f0uL, 0xfcd1d2c7uL, 0xfe976c9euL, 0xff5506a9uL, 0xfa1a102cuL, 0xfbd87a1buL,
+        0xf99ec442uL, 0xf85cae75uL, 0xf300e948uL, 0xf2c2837fuL, 0xf0843d26uL, 0xf1465711uL,
+        0xf4094194uL, 0xf5cb2ba3uL, 0xf78d95fauL, 0xf64fffcduL, 0xd9785d60uL, 0xd8ba3757uL,
+        0xdafc890euL, 0xdb3ee339uL, 0xde71f5bcuL, 0xdfb39f8buL, 0xddf521d2uL, 0xdc374be5uL,
+        0xd76b0cd8uL, 0xd6a966efuL, 0xd4efd8b6uL, 0xd52db281uL, 0xd062a404uL, 0xd1a0ce33uL,
+        0xd3e6706auL, 0xd2241a5duL, 0xc55efe10uL, 0xc49c9427uL, 0xc6da2a7euL, 0xc7184049uL,
+        0xc25756ccuL, 0xc3953cfbuL, 0xc1d382a2uL, 0xc011e895uL, 0xcb4dafa8uL, 0xca8fc59fuL,
+        0xc8c97bc6uL, 0xc90b11f1uL, 0xcc440774uL, 0xcd866d43uL, 0xcfc0d31auL, 0xce02b92duL,
+        0x91af9640uL, 0x906dfc77uL, 0x922b422euL, 0x93e92819uL, 0x96a63e9cuL, 0x976454abuL,
+        0x9522eaf2uL, 0x94e080c5uL, 0x9fbcc7f8uL, 0x9e7eadcfuL, 0x9c381396uL, 0x9dfa79a1uL,
+        0x98b56f24uL, 0x99770513uL, 0x9b31bb4auL, 0x9af3d17duL, 0x8d893530uL, 0x8c4b5f07uL,
+        0x8e0de15euL, 0x8fcf8b69uL, 0x8a809decuL, 0x8b42f7dbuL, 0x89044982uL, 0x88c623b5uL,
+        0x839a6488uL, 0x82580ebfuL, 0x801eb0e6uL, 0x81dcdad1uL, 0x8493cc54uL, 0x8551a663uL,
+        0x8717183auL, 0x86d5720duL, 0xa9e2d0a0uL, 0xa820ba97uL, 0xaa6604ceuL, 0xaba46ef9uL,
+        0xaeeb787cuL, 0xaf29124buL, 0xad6fac12uL, 0xacadc625uL, 0xa7f18118uL, 0xa633eb2fuL,
+        0xa4755576uL, 0xa5b73f41uL, 0xa0f829c4uL, 0xa13a43f3uL, 0xa37cfdaauL, 0xa2be979duL,
+        0xb5c473d0uL, 0xb40619e7uL, 0xb640a7beuL, 0xb782cd89uL, 0xb2cddb0cuL, 0xb30fb13buL,
+        0xb1490f62uL, 0xb08b6555uL, 0xbbd72268uL, 0xba15485fuL, 0xb853f606uL, 0xb9919c31uL,
+        0xbcde8ab4uL, 0xbd1ce083uL, 0xbf5a5edauL, 0xbe9834eduL
+    },
+    {
+        0x00000000uL, 0xb8bc6765uL, 0xaa09c88buL, 0x12b5afeeuL, 0x8f629757uL, 0x37def032uL,
+        0x256b5fdcuL, 0x9dd738b9uL, 0xc5b428efuL, 0x7d084f8auL, 0x6fbde064uL, 0xd7018701uL,
+        0x4ad6bfb8uL, 0xf26ad8dduL, 0xe0df7733uL, 0x58631056uL, 0x5019579fuL, 0xe8a530fauL,
+        0xfa109f14uL, 0x42acf871uL, 0xdf7bc0c8uL, 0x67c7a7aduL, 0x75720843uL, 0xcdce6f26uL,
+        0x95ad7f70uL, 0x2d111815uL, 0x3fa4b7fbuL, 0x8718d09euL, 0x1acfe827uL, 0xa2738f42uL,
+        0xb0c620acuL, 0x087a47c9uL, 0xa032af3euL, 0x188ec85buL, 0x0a3b67b5uL, 0xb28700d0uL,
+        0x2f503869uL, 0x97ec5f0cuL, 0x8559f0e2uL, 0x3de59787uL, 0x658687d1uL, 0xdd3ae0b4uL,
+        0xcf8f4f5auL, 0x7733283fuL, 0xeae41086uL, 0x525877e3uL, 0x40edd80duL, 0xf851bf68uL,
+        0xf02bf8a1uL, 0x48979fc4uL, 0x5a22302auL, 0xe29e574fuL, 0x7f496ff6uL, 0xc7f50893uL,
+        0xd540a77duL, 0x6dfcc018uL, 0x359fd04euL, 0x8d23b72buL, 0x9f9618c5uL, 0x272a7fa0uL,
+        0xbafd4719uL, 0x0241207cuL, 0x10f48f92uL, 0xa848e8f7uL, 0x9b14583duL, 0x23a83f58uL,
+        0x311d90b6uL, 0x89a1f7d3uL, 0x1476cf6auL, 0xaccaa80fuL, 0xbe7f07e1uL, 0x06c36084uL,
+        0x5ea070d2uL, 0xe61c17b7uL, 0xf4a9b859uL, 0x4c15df3cuL, 0xd1c2e785uL, 0x697e80e0uL,
+        0x7bcb2f0euL, 0xc377486buL, 0xcb0d0fa2uL, 0x73b168c7uL, 0x6104c729uL, 0xd9b8a04cuL,
+        0x446f98f5uL, 0xfcd3ff90uL, 0xee66507euL, 0x56da371buL, 0x0eb9274duL, 0xb6054028uL,
+        0xa4b0efc6uL, 0x1c0c88a3uL, 0x81dbb01auL, 0x3967d77fuL, 0x2bd27891uL, 0x936e1ff4uL,
+        0x3b26f703uL, 0x839a9066uL, 0x912f3f88uL, 0x299358eduL, 0xb4446054uL, 0x0cf80731uL,
+        0x1e4da8dfuL, 0xa6f1cfbauL, 0xfe92dfecuL, 0x462eb889uL, 0x549b1767uL, 0xec277002uL,
+        0x71f048bbuL, 0xc94c2fdeuL, 0xdbf98030uL, 0x6345e755uL, 0x6b3fa09cuL, 0xd383c7f9uL,
+        0xc1366817uL, 0x798a0f72uL, 0xe45d37cbuL, 0x5ce150aeuL, 0x4e54ff40uL, 0xf6e89825uL,
+        0xae8b8873uL, 0x1637ef16uL, 0x048240f8uL, 0xbc3e279duL, 0x21e91f24uL, 0x99557841uL,
+        0x8be0d7afuL, 0x335cb0cauL, 0xed59b63buL, 0x55e5d15euL, 0x47507eb0uL, 0xffec19d5uL,
+        0x623b216cuL, 0xda874609uL, 0xc832e9e7uL, 0x708e8e82uL, 0x28ed9ed4uL, 0x9051f9b1uL,
+        0x82e4565fuL, 0x3a58313auL, 0xa78f0983uL, 0x1f336ee6uL, 0x0d86c108uL, 0xb53aa66duL,
+        0xbd40e1a4uL, 0x05fc86c1uL, 0x1749292fuL, 0xaff54e4auL, 0x322276f3uL, 0x8a9e1196uL,
+        0x982bbe78uL, 0x2097d91duL, 0x78f4c94buL, 0xc048ae2euL, 0xd2fd01c0uL, 0x6a4166a5uL,
+        0xf7965e1cuL, 0x4f2a3979uL, 0x5d9f9697uL, 0xe523f1f2uL, 0x4d6b1905uL, 0xf5d77e60uL,
+        0xe762d18euL, 0x5fdeb6ebuL, 0xc2098e52uL, 0x7ab5e937uL, 0x680046d9uL, 0xd0bc21bcuL,
+        0x88df31eauL, 0x3063568fuL, 0x22d6f961uL, 0x9a6a9e04uL, 0x07bda6bduL, 0xbf01c1d8uL,
+        0xadb46e36uL, 0x15080953uL, 0x1d724e9auL, 0xa5ce29ffuL, 0xb77b8611uL, 0x0fc7e174uL,
+        0x9210d9cduL, 0x2aacbea8uL, 0x38191146uL, 0x80a57623uL, 0xd8c66675uL, 0x607a0110uL,
+        0x72cfaefeuL, 0xca73c99buL, 0x57a4f122uL, 0xef189647uL, 0xfdad39a9uL, 0x45115eccuL,
+        0x764dee06uL, 0xcef18963uL, 0xdc44268duL, 0x64f841e8uL, 0xf92f7951uL, 0x41931e34uL,
+        0x5326b1dauL, 0xeb9ad6bfuL, 0xb3f9c6e9uL, 0x0b45a18cuL, 0x19f00e62uL, 0xa14c6907uL,
+        0x3c9b51beuL, 0x842736dbuL, 0x96929935uL, 0x2e2efe50uL, 0x2654b999uL, 0x9ee8defcuL,
+        0x8c5d7112uL, 0x34e11677uL, 0xa9362eceuL, 0x118a49abuL, 0x033fe645uL, 0xbb838120uL,
+        0xe3e09176uL, 0x5b5cf613uL, 0x49e959fduL, 0xf1553e98uL, 0x6c820621uL, 0xd43e6144uL,
+        0xc68bceaauL, 0x7e37a9cfuL, 0xd67f4138uL, 0x6ec3265duL, 0x7c7689b3uL, 0xc4caeed6uL,
+        0x591dd66fuL, 0xe1a1b10auL, 0xf3141ee4uL, 0x4ba87981uL, 0x13cb69d7uL, 0xab770eb2uL,
+        0xb9c2a15cuL, 0x017ec639uL, 0x9ca9fe80uL, 0x241599e5uL, 0x36a0360buL, 0x8e1c516euL,
+        0x866616a7uL, 0x3eda71c2uL, 0x2c6fde2cuL, 0x94d3b949uL, 0x090481f0uL, 0xb1b8e695uL,
+        0xa30d497buL, 0x1bb12e1euL, 0x43d23e48uL, 0xfb6e592duL, 0xe9dbf6c3uL, 0x516791a6uL,
+        0xccb0a91fuL, 0x740cce7auL, 0x66b96194uL, 0xde0506f1uL
+    }
+    #endif /* (CRC32_SLICES == 4u) */
+};
+
+/*******************************************************************************
+ * Slice-by-4 tables for CRC-32C (Castagnoli) calculation
+ ********************************************************************************
+ * Poly (reflected):
+ *  0x82F63B78
+ * Table [k][i] is the CRC of byte i followed by k zero bytes.
+ ********************************************************************************/
+static const uint32_t CRC_32C_Tab[CRC32_SLICES][256] =
+{
+    {
+        0x00000000uL, 0xf26b8303uL, 0xe13b70f7uL, 0x1350f3f4uL, 0xc79a971fuL, 0x35f1141cuL,
+        0x26a1e7e8uL, 0xd4ca64ebuL, 0x8ad958cfuL, 0x78b2dbccuL, 0x6be22838uL, 0x9989ab3buL,
+        0x4d43cfd0uL, 0xbf284cd3uL, 0xac78bf27uL, 0x5e133c24uL, 0x105ec76fuL, 0xe235446cuL,
+        0xf165b798uL, 0x030e349buL, 0xd7c45070uL, 0x25afd373uL, 0x36ff2087uL, 0xc494a384uL,
+        0x9a879fa0uL, 0x68ec1ca3uL, 0x7bbcef57uL, 0x89d76c54uL, 0x5d1d08bfuL, 0xaf768bbcuL,
+        0xbc267848uL, 0x4e4dfb4buL, 0x20bd8edeuL, 0xd2d60ddduL, 0xc186fe29uL, 0x33ed7d2auL,
+        0xe72719c1uL, 0x154c9ac2uL, 0x061c6936uL, 0xf477ea35uL, 0xaa64d611uL, 0x580f5512uL,
+        0x4b5fa6e6uL, 0xb93425e5uL, 0x6dfe410euL, 0x9f95c20duL, 0x8cc531f9uL, 0x7eaeb2fauL,
+        0x30e349b1uL, 0xc288cab2uL, 0xd1d83946uL, 0x23b3ba45uL, 0xf779deaeuL, 0x05125daduL,
+        0x1642ae59uL, 0xe4292d5auL, 0xba3a117euL, 0x4851927duL, 0x5b016189uL, 0xa96ae28auL,
+        0x7da08661uL, 0x8fcb0562uL, 0x9c9bf696uL, 0x6ef07595uL, 0x417b1dbcuL, 0xb3109ebfuL,
+        0xa0406d4buL, 0x522bee48uL, 0x86e18aa3uL, 0x748a09a0uL, 0x67dafa54uL, 0x95b17957uL,
+        0xcba24573uL, 0x39c9c670uL, 0x2a993584uL, 0xd8f2b687uL, 0x0c38d26cuL, 0xfe53516fuL,
+        0xed03a29buL, 0x1f682198uL, 0x5125dad3uL, 0xa34e59d0uL, 0xb01eaa24uL, 0x42752927uL,
+        0x96bf4dccuL, 0x64d4cecfuL, 0x77843d3buL, 0x85efbe38uL, 0xdbfc821cuL, 0x2997011fuL,
+        0x3ac7f2ebuL, 0xc8ac71e8uL, 0x1c661503uL, 0xee0d9600uL, 0xfd5d65f4uL, 0x0f36e6f7uL,
+        0x61c69362uL, 0x93ad1061uL, 0x80fde395uL, 0x72966096uL, 0xa65c047duL, 0x5437877euL,
+        0x4767748auL, 0xb50cf789uL, 0xeb1fcbaduL, 0x197448aeuL, 0x0a24bb5auL, 0xf84f3859uL,
+        0x2c855cb2uL, 0xdeeedfb1uL, 0xcdbe2c45uL, 0x3fd5af46uL, 0x7198540duL, 0x83f3d70euL,
+        0x90a324fauL, 0x62c8a7f9uL, 0xb602c312uL, 0x44694011uL, 0x5739b3e5uL, 0xa55230e6uL,
+        0xfb410cc2uL, 0x092a8fc1uL, 0x1a7a7c35uL, 0xe811ff36uL, 0x3cdb9bdduL, 0xceb018deuL,
+        0xdde0eb2auL, 0x2f8b6829uL, 0x82f63b78uL, 0x709db87buL, 0x63cd4b8fuL, 0x91a6c88cuL,
+        0x456cac67uL, 0xb7072f64uL, 0xa457dc90uL, 0x563c5f93uL, 0x082f63b7uL, 0xfa44e0b4uL,
+        0xe9141340uL, 0x1b7f9043uL, 0xcfb5f4a8uL, 0x3dde77abuL, 0x2e8e845fuL, 0xdce5075cuL,
+        0x92a8fc17uL, 0x60c37f14uL, 0x73938ce0uL, 0x81f80fe3uL, 0x55326b08uL, 0xa759e80buL,
+        0xb4091bffuL, 0x466298fcuL, 0x1871a4d8uL, 0xea1a27dbuL, 0xf94ad42fuL, 0x0b21572cuL,
+        0xdfeb33c7uL, 0x2d80b0c4uL, 0x3ed04330uL, 0xccbbc033uL, 0xa24bb5a6uL, 0x502036a5uL,
+        0x4370c551uL, 0xb11b4652uL, 0x65d122b9uL, 0x97baa1bauL, 0x84ea524euL, 0x7681d14duL,
+        0x2892ed69uL, 0xdaf96e6auL, 0xc9a99d9euL, 0x3bc21e9duL, 0xef087a76uL, 0x1d63f975uL,
+        0x0e330a81uL, 0xfc588982uL, 0xb21572c9uL, 0x407ef1cauL, 0x532e023euL, 0xa145813duL,
+        0x758fe5d6uL, 0x87e466d5uL, 0x94b49521uL, 0x66df1622uL, 0x38cc2a06uL, 0xcaa7a905uL,
+        0xd9f75af1uL, 0x2b9cd9f2uL, 0xff56bd19uL, 0x0d3d3e1auL, 0x1e6dcdeeuL, 0xec064eeduL,
+        0xc38d26c4uL, 0x31e6a5c7uL, 0x22b65633uL, 0xd0ddd530uL, 0x0417b1dbuL, 0xf67c32d8uL,
+        0xe52cc12cuL, 0x1747422fuL, 0x49547e0buL, 0xbb3ffd08uL, 0xa86f0efcuL, 0x5a048dffuL,
+        0x8ecee914uL, 0x7ca56a17uL, 0x6ff599e3uL, 0x9d9e1ae0uL, 0xd3d3e1abuL, 0x21b862a8uL,
+        0x32e8915cuL, 0xc083125fuL, 0x144976b4uL, 0xe622f5b7uL, 0xf5720643uL, 0x07198540uL,
+        0x590ab964uL, 0xab613a67uL, 0xb831c993uL, 0x4a5a4a90uL, 0x9e902e7buL, 0x6cfbad78uL,
+        0x7fab5e8cuL, 0x8dc0dd8fuL, 0xe330a81auL, 0x115b2b19uL, 0x020bd8eduL, 0xf0605beeuL,
+        0x24aa3f05uL, 0xd6c1bc06uL, 0xc5914ff2uL, 0x37faccf1uL, 0x69e9f0d5uL, 0x9b8273d6uL,
+        0x88d28022uL, 0x7ab90321uL, 0xae7367cauL, 0x5c18e4c9uL, 0x4f48173duL, 0xbd23943euL,
+        0xf36e6f75uL, 0x0105ec76uL, 0x12551f82uL, 0xe03e9c81uL, 0x34f4f86auL, 0xc69f7b69uL,
+        0xd5cf889duL, 0x27a40b9euL, 0x79b737bauL, 0x8bdcb4b9uL, 0x988c474duL, 0x6ae7c44euL,
+        0xbe2da0a5uL, 0x4c4623a6uL, 0x5f16d052uL, 0xad7d5351uL
+    },
+    #if (CRC32_SLICES == 4u)
+    {
+        0x00000000uL, 0x13a29877uL, 0x274530eeuL, 0x34e7a899uL, 0x4e8a61dcuL, 0x5d28f9abuL,
+        0x69cf5132uL, 0x7a6dc945uL, 0x9d14c3b8uL, 0x8eb65bcfuL, 0xba51f356uL, 0xa9f36b21uL,
+        0xd39ea264uL, 0xc03c3a13uL, 0xf4db928auL, 0xe7790afduL, 0x3fc5f181uL, 0x2c6769f6uL,
+        0x1880c16fuL, 0x0b225918uL, 0x714f905duL, 0x62ed082auL, 0x560aa0b3uL, 0x45a838c4uL,
+        0xa2d13239uL, 0xb173aa4euL, 0x859402d7uL, 0x96369aa0uL, 0xec5b53e5uL, 0xfff9cb92uL,
+        0xcb1e630buL, 0xd8bcfb7cuL, 0x7f8be302uL, 0x6c297b75uL, 0x58ced3ecuL, 0x4b6c4b9buL,
+        0x310182deuL, 0x22a31aa9uL, 0x1644b230uL, 0x05e62a47uL, 0xe29f20bauL, 0xf13db8cduL,
+        0xc5da1054uL, 0xd6788823uL, 0xac154166uL, 0xbfb7d911uL, 0x8b507188uL, 0x98f2e9ffuL,
+        0x404e1283uL, 0x53ec8af4uL, 0x670b226duL, 0x74a9ba1auL, 0x0ec4735fuL, 0x1d66eb28uL,
+        0x298143b1uL, 0x3a23dbc6uL, 0xdd5ad13buL, 0xcef8494cuL, 0xfa1fe1d5uL, 0xe9bd79a2uL,
+        0x93d0b0e7uL, 0x80722890uL, 0xb4958009uL, 0xa737187euL, 0xff17c604uL, 0xecb55e73uL,
+        0xd852f6eauL, 0xcbf06e9duL, 0xb19da7d8uL, 0xa23f3fafuL, 0x96d89736uL, 0x857a0f41uL,
+        0x620305bcuL, 0x71a19dcbuL, 0x45463552uL, 0x56e4ad25uL, 0x2c896460uL, 0x3f2bfc17uL,
+        0x0bcc548euL, 0x186eccf9uL, 0xc0d23785uL, 0xd370aff2uL, 0xe797076buL, 0xf4359f1cuL,
+        0x8e585659uL, 0x9dface2euL, 0xa91d66b7uL, 0xbabffec0uL, 0x5dc6f43duL, 0x4e646c4auL,
+        0x7a83c4d3uL, 0x69215ca4uL, 0x134c95e1uL, 0x00ee0d96uL, 0x3409a50fuL, 0x27ab3d78uL,
+        0x809c2506uL, 0x933ebd71uL, 0xa7d915e8uL, 0xb47b8d9fuL, 0xce1644dauL, 0xddb4dcaduL,
+        0xe9537434uL, 0xfaf1ec43uL, 0x1d88e6beuL, 0x0e2a7ec9uL, 0x3acdd650uL, 0x296f4e27uL,
+        0x53028762uL, 0x40a01f15uL, 0x7447b78cuL, 0x67e52ffbuL, 0xbf59d487uL, 0xacfb4cf0uL,
+        0x981ce469uL, 0x8bbe7c1euL, 0xf1d3b55buL, 0xe2712d2cuL, 0xd69685b5uL, 0xc5341dc2uL,
+        0x224d173fuL, 0x31ef8f48uL, 0x050827d1uL, 0x16aabfa6uL, 0x6cc776e3uL, 0x7f65ee94uL,
+        0x4b82460duL, 0x5820de7auL, 0xfbc3faf9uL, 0xe861628euL, 0xdc86ca17uL, 0xcf245260uL,
+        0xb5499b25uL, 0xa6eb0352uL, 0x920cabcbuL, 0x81ae33bcuL, 0x66d73941uL, 0x7575a136uL,
+        0x419209afuL, 0x523091d8uL, 0x285d589duL, 0x3bffc0eauL, 0x0f186873uL, 0x1cbaf004uL,
+        0xc4060b78uL, 0xd7a4930fuL, 0xe3433b96uL, 0xf0e1a3e1uL, 0x8a8c6aa4uL, 0x992ef2d3uL,
+        0xadc95a4auL, 0xbe6bc23duL, 0x5912c8c0uL, 0x4ab050b7uL, 0x7e57f82euL, 0x6df56059uL,
+        0x1798a91cuL, 0x043a316buL, 0x30dd99f2uL, 0x237f0185uL, 0x844819fbuL, 0x97ea818cuL,
+        0xa30d2915uL, 0xb0afb162uL, 0xcac27827uL, 0xd960e050uL, 0xed8748c9uL, 0xfe25d0beuL,
+        0x195cda43uL, 0x0afe4234uL, 0x3e19eaaduL, 0x2dbb72dauL, 0x57d6bb9fuL, 0x447423e8uL,
+        0x70938b71uL, 0x63311306uL, 0xbb8de87auL, 0xa82f700duL, 0x9cc8d894uL, 0x8f6a40e3uL,
+        0xf50789a6uL, 0xe6a511d1uL, 0xd242b948uL, 0xc1e0213fuL, 0x26992bc2uL, 0x353bb3b5uL,
+        0x01dc1b2cuL, 0x127e835buL, 0x68134a1euL, 0x7bb1d269uL, 0x4f567af0uL, 0x5cf4e287uL,
+        0x04d43cfduL, 0x1776a48auL, 0x23910c13uL, 0x30339464uL, 0x4a5e5d21uL, 0x59fcc556uL,
+        0x6d1b6dcfuL, 0x7eb9f5b8uL, 0x99c0ff45uL, 0x8a626732uL, 0xbe85cfabuL, 0xad2757dcuL,
+        0xd74a9e99uL, 0xc4e806eeuL, 0xf00fae77uL, 0xe3ad3600uL, 0x3b11cd7cuL, 0x28b3550buL,
+        0x1c54fd92uL, 0x0ff665e5uL, 0x759baca0uL, 0x663934d7uL, 0x52de9c4euL, 0x417c0439uL,
+        0xa6050ec4uL, 0xb5a796b3uL, 0x81403e2auL, 0x92e2a65duL, 0xe88f6f18uL, 0xfb2df76fuL,
+        0xcfca5ff6uL, 0xdc68c781uL, 0x7b5fdfffuL, 0x68fd4788uL, 0x5c1aef11uL, 0x4fb87766uL,
+        0x35d5be23uL, 0x26772654uL, 0x12908ecduL, 0x013216bauL, 0xe64b1c47uL, 0xf5e98430uL,
+        0xc10e2ca9uL, 0xd2acb4deuL, 0xa8c17d9buL, 0xbb63e5ecuL, 0x8f844d75uL, 0x9c26d502uL,
+        0x449a2e7euL, 0x5738b609uL, 0x63df1e90uL, 0x707d86e7uL, 0x0a104fa2uL, 0x19b2d7d5uL,
+        0x2d557f4cuL, 0x3ef7e73buL, 0xd98eedc6uL, 0xca2c75b1uL, 0xfecbdd28uL, 0xed69455fuL,
+        0x97048c1auL, 0x84a6146duL, 0xb041bcf4uL, 0xa3e32483uL
+    },
+    {
+        0x00000000uL, 0xa541927euL, 0x4f6f520duL, 0xea2ec073uL, 0x9edea41auL, 0x3b9f3664uL,
+        0xd1b1f617uL, 0x74f06469uL, 0x38513ec5uL, 0x9d10acbbuL, 0x773e6cc8uL, 0xd27ffeb6uL,
+        0xa68f9adfuL, 0x03ce08a1uL, 0xe9e0c8d2uL, 0x4ca15aacuL, 0x70a27d8auL, 0xd5e3eff4uL,
+        0x3fcd2f87uL, 0x9a8cbdf9uL, 0xee7cd990uL, 0x4b3d4beeuL, 0xa1138b9duL, 0x045219e3uL,
+        0x48f3434fuL, 0xedb2d131uL, 0x079c1142uL, 0xa2dd833cuL, 0xd62de755uL, 0x736c752buL,
+        0x9942b558uL, 0x3c032726uL, 0xe144fb14uL, 0x4405696auL, 0xae2ba919uL, 0x0b6a3b67uL,
+        0x7f9a5f0euL, 0xdadbcd70uL, 0x30f50d03uL, 0x95b49f7duL, 0xd915c5d1uL, 0x7c5457afuL,
+        0x967a97dcuL, 0x333b05a2uL, 0x47cb61cbuL, 0xe28af3b5uL, 0x08a433c6uL, 0xade5a1b8uL,
+        0x91e6869euL, 0x34a714e0uL, 0xde89d493uL, 0x7bc846eduL, 0x0f382284uL, 0xaa79b0fauL,
+        0x40577089uL, 0xe516e2f7uL, 0xa9b7b85buL, 0x0cf62a25uL, 0xe6d8ea56uL, 0x43997828uL,
+        0x37691c41uL, 0x92288e3fuL, 0x78064e4cuL, 0xdd47dc32uL, 0xc76580d9uL, 0x622412a7uL,
+        0x880ad2d4uL, 0x2d4b40aauL, 0x59bb24c3uL, 0xfcfab6bduL, 0x16d476ceuL, 0xb395e4b0uL,
+        0xff34be1cuL, 0x5a752c62uL, 0xb05bec11uL, 0x151a7e6fuL, 0x61ea1a06uL, 0xc4ab8878uL,
+        0x2e85480buL, 0x8bc4da75uL, 0xb7c7fd53uL, 0x12866f2duL, 0xf8a8af5euL, 0x5de93d20uL,
+        0x29195949uL, 0x8c58cb37uL, 0x66760b44uL, 0xc337993auL, 0x8f96c396uL, 0x2ad751e8uL,
+        0xc0f9919buL, 0x65b803e5uL, 0x1148678cuL, 0xb409f5f2uL, 0x5e273581uL, 0xfb66a7ffuL,
+        0x26217bcduL, 0x8360e9b3uL, 0x694e29c0uL, 0xcc0fbbbeuL, 0xb8ffdfd7uL, 0x1dbe4da9uL,
+        0xf7908ddauL, 0x52d11fa4uL, 0x1e704508uL, 0xbb31d776uL, 0x511f1705uL, 0xf45e857buL,
+        0x80aee112uL, 0x25ef736cuL, 0xcfc1b31fuL, 0x6a802161uL, 0x56830647uL, 0xf3c29439uL,
+        0x19ec544auL, 0xbcadc634uL, 0xc85da25duL, 0x6d1c3023uL, 0x8732f050uL, 0x2273622euL,
+        0x6ed23882uL, 0xcb93aafcuL, 0x21bd6a8fuL, 0x84fcf8f1uL, 0xf00c9c98uL, 0x554d0ee6uL,
+        0xbf63ce95uL, 0x1a225cebuL, 0x8b277743uL, 0x2e66e53duL, 0xc448254euL, 0x6109b730uL,
+        0x15f9d359uL, 0xb0b84127uL, 0x5a968154uL, 0xffd7132auL, 0xb3764986uL, 0x1637dbf8uL,
+        0xfc191b8buL, 0x595889f5uL, 0x2da8ed9cuL, 0x88e97fe2uL, 0x62c7bf91uL, 0xc7862defuL,
+        0xfb850ac9uL, 0x5ec498b7uL, 0xb4ea58c4uL, 0x11abcabauL, 0x655baed3uL, 0xc01a3caduL,
+        0x2a34fcdeuL, 0x8f756ea0uL, 0xc3d4340cuL, 0x6695a672uL, 0x8cbb6601uL, 0x29faf47fuL,
+        0x5d0a9016uL, 0xf84b0268uL, 0x1265c21buL, 0xb7245065uL, 0x6a638c57uL, 0xcf221e29uL,
+        0x250cde5auL, 0x804d4c24uL, 0xf4bd284duL, 0x51fcba33uL, 0xbbd27a40uL, 0x1e93e83euL,
+        0x5232b292uL, 0xf77320ecuL, 0x1d5de09fuL, 0xb81c72e1uL, 0xccec1688uL, 0x69ad84f6uL,
+        0x83834485uL, 0x26c2d6fbuL, 0x1ac1f1dduL, 0xbf8063a3uL, 0x55aea3d0uL, 0xf0ef31aeuL,
+        0x841f55c7uL, 0x215ec7b9uL, 0xcb7007cauL, 0x6e3195b4uL, 0x2290cf18uL, 0x87d15d66uL,
+        0x6dff9d15uL, 0xc8be0f6buL, 0xbc4e6b02uL, 0x190ff97cuL, 0xf321390fuL, 0x5660ab71uL,
+        0x4c42f79auL, 0xe90365e4uL, 0x032da597uL, 0xa66c37e9uL, 0xd29c5380uL, 0x77ddc1feuL,
+        0x9df3018duL, 0x38b293f3uL, 0x7413c95fuL, 0xd1525b21uL, 0x3b7c9b52uL, 0x9e3d092cuL,
+        0xeacd6d45uL, 0x4f8cff3buL, 0xa5a23f48uL, 0x00e3ad36uL, 0x3ce08a10uL, 0x99a1186euL,
+        0x738fd81duL, 0xd6ce4a63uL, 0xa23e2e0auL, 0x077fbc74uL, 0xed517c07uL, 0x4810ee79uL,
+        0x04b1b4d5uL, 0xa1f026abuL, 0x4bdee6d8uL, 0xee9f74a6uL, 0x9a6f10cfuL, 0x3f2e82b1uL,
+        0xd50042c2uL, 0x7041d0bcuL, 0xad060c8euL, 0x08479ef0uL, 0xe2695e83uL, 0x4728ccfduL,
+        0x33d8a894uL, 0x96993aeauL, 0x7cb7fa99uL, 0xd9f668e7uL, 0x9557324buL, 0x3016a035uL,
+        0xda386046uL, 0x7f79f238uL, 0x0b899651uL, 0xaec8042fuL, 0x44e6c45cuL, 0xe1a75622uL,
+        0xdda47104uL, 0x78e5e37auL, 0x92cb2309uL, 0x378ab177uL, 0x437ad51euL, 0xe63b4760uL,
+        0x0c158713uL, 0xa954156duL, 0xe5f54fc1uL, 0x40b4ddbfuL, 0xaa9a1dccuL, 0x0fdb8fb2uL,
+        0x7b2bebdbuL, 0xde6a79a5uL, 0x3444b9d6uL, 0x91052ba8uL
+    },
+    {
+        0x00000000uL, 0xdd45aab8uL, 0xbf672381uL, 0x62228939uL, 0x7b2231f3uL, 0xa6679b4buL,
+        0xc4451272uL, 0x1900b8cauL, 0xf64463e6uL, 0x2b01c95euL, 0x49234067uL, 0x9466eadfuL,
+        0x8d665215uL, 0x5023f8aduL, 0x32017194uL, 0xef44db2cuL, 0xe964b13duL, 0x34211b85uL,
+        0x560392bcuL, 0x8b463804uL, 0x924680ceuL, 0x4f032a76uL, 0x2d21a34fuL, 0xf06409f7uL,
+        0x1f20d2dbuL, 0xc2657863uL, 0xa047f15auL, 0x7d025be2uL, 0x6402e328uL, 0xb9474990uL,
+        0xdb65c0a9uL, 0x06206a11uL, 0xd725148buL, 0x0a60be33uL, 0x6842370auL, 0xb5079db2uL,
+        0xac072578uL, 0x71428fc0uL, 0x136006f9uL, 0xce25ac41uL, 0x2161776duL, 0xfc24ddd5uL,
+        0x9e0654ecuL, 0x4343fe54uL, 0x5a43469euL, 0x8706ec26uL, 0xe524651fuL, 0x3861cfa7uL,
+        0x3e41a5b6uL, 0xe3040f0euL, 0x81268637uL, 0x5c632c8fuL, 0x45639445uL, 0x98263efduL,
+        0xfa04b7c4uL, 0x27411d7cuL, 0xc805c650uL, 0x15406ce8uL, 0x7762e5d1uL, 0xaa274f69uL,
+        0xb327f7a3uL, 0x6e625d1buL, 0x0c40d422uL, 0xd1057e9auL, 0xaba65fe7uL, 0x76e3f55fuL,
+        0x14c17c66uL, 0xc984d6deuL, 0xd0846e14uL, 0x0dc1c4acuL, 0x6fe34d95uL, 0xb2a6e72duL,
+        0x5de23c01uL, 0x80a796b9uL, 0xe2851f80uL, 0x3fc0b538uL, 0x26c00df2uL, 0xfb85a74auL,
+        0x99a72e73uL, 0x44e284cbuL, 0x42c2eedauL, 0x9f874462uL, 0xfda5cd5buL, 0x20e067e3uL,
+        0x39e0df29uL, 0xe4a57591uL, 0x8687fca8uL, 0x5bc25610uL, 0xb4868d3cuL, 0x69c32784uL,
+        0x0be1aebduL, 0xd6a40405uL, 0xcfa4bccfuL, 0x12e11677uL, 0x70c39f4euL, 0xad8635f6uL,
+        0x7c834b6cuL, 0xa1c6e1d4uL, 0xc3e468eduL, 0x1ea1c255uL, 0x07a17a9fuL, 0xdae4d027uL,
+        0xb8c6591euL, 0x6583f3a6uL, 0x8ac7288auL, 0x57828232uL, 0x35a00b0buL, 0xe8e5a1b3uL,
+        0xf1e51979uL, 0x2ca0b3c1uL, 0x4e823af8uL, 0x93c79040uL, 0x95e7fa51uL, 0x48a250e9uL,
+        0x2a80d9d0uL, 0xf7c57368uL, 0xeec5cba2uL, 0x3380611auL, 0x51a2e823uL, 0x8ce7429buL,
+        0x63a399b7uL, 0xbee6330fuL, 0xdcc4ba36uL, 0x0181108euL, 0x1881a844uL, 0xc5c402fcuL,
+        0xa7e68bc5uL, 0x7aa3217duL, 0x52a0c93fuL, 0x8fe56387uL, 0xedc7eabeuL, 0x30824006uL,
+        0x2982f8ccuL, 0xf4c75274uL, 0x96e5db4duL, 0x4ba071f5uL, 0xa4e4aad9uL, 0x79a10061uL,
+        0x1b838958uL, 0xc6c623e0uL, 0xdfc69b2auL, 0x02833192uL, 0x60a1b8abuL, 0xbde41213uL,
+        0xbbc47802uL, 0x6681d2bauL, 0x04a35b83uL, 0xd9e6f13buL, 0xc0e649f1uL, 0x1da3e349uL,
+        0x7f816a70uL, 0xa2c4c0c8uL, 0x4d801be4uL, 0x90c5b15cuL, 0xf2e73865uL, 0x2fa292dduL,
+        0x36a22a17uL, 0xebe780afuL, 0x89c50996uL, 0x5480a32euL, 0x8585ddb4uL, 0x58c0770cuL,
+        0x3ae2fe35uL, 0xe7a7548duL, 0xfea7ec47uL, 0x23e246ffuL, 0x41c0cfc6uL, 0x9c85657euL,
+        0x73c1be52uL, 0xae8414eauL, 0xcca69dd3uL, 0x11e3376buL, 0x08e38fa1uL, 0xd5a62519uL,
+        0xb784ac20uL, 0x6ac10698uL, 0x6ce16c89uL, 0xb1a4c631uL, 0xd3864f08uL, 0x0ec3e5b0uL,
+        0x17c35d7auL, 0xca86f7c2uL, 0xa8a47efbuL, 0x75e1d443uL, 0x9aa50f6fuL, 0x47e0a5d7uL,
+        0x25c22ceeuL, 0xf8878656uL, 0xe1873e9cuL, 0x3cc29424uL, 0x5ee01d1duL, 0x83a5b7a5uL,
+        0xf90696d8uL, 0x24433c60uL, 0x4661b559uL, 0x9b241fe1uL, 0x8224a72buL, 0x5f610d93uL,
+        0x3d4384aauL, 0xe0062e12uL, 0x0f42f53euL, 0xd2075f86uL, 0xb025d6bfuL, 0x6d607c07uL,
+        0x7460c4cduL, 0xa9256e75uL, 0xcb07e74cuL, 0x16424df4uL, 0x106227e5uL, 0xcd278d5duL,
+        0xaf050464uL, 0x7240aedcuL, 0x6b401616uL, 0xb605bcaeuL, 0xd4273597uL, 0x09629f2fuL,
+        0xe6264403uL, 0x3b63eebbuL, 0x59416782uL, 0x8404cd3auL, 0x9d0475f0uL, 0x4041df48uL,
+        0x22635671uL, 0xff26fcc9uL, 0x2e238253uL, 0xf36628ebuL, 0x9144a1d2uL, 0x4c010b6auL,
+        0x5501b3a0uL, 0x88441918uL, 0xea669021uL, 0x37233a99uL, 0xd867e1b5uL, 0x05224b0duL,
+        0x6700c234uL, 0xba45688cuL, 0xa345d046uL, 0x7e007afeuL, 0x1c22f3c7uL, 0xc167597fuL,
+        0xc747336euL, 0x1a0299d6uL, 0x782010efuL, 0xa565ba57uL, 0xbc65029duL, 0x6120a825uL,
+        0x0302211cuL, 0xde478ba4uL, 0x31035088uL, 0xec46fa30uL, 0x8e647309uL, 0x5321d9b1uL,
+        0x4a21617buL, 0x9764cbc3uL, 0xf54642fauL, 0x2803e842uL
+    }
+    #endif /* (CRC32_SLICES == 4u) */
+};
+
 /*******************************************************************************
 * Table for CRC16 CCITT calculation
 *******************************************************************************/
@@ -150,6 +538,168 @@ static const uint16_t CRC_16_Tab[256] =
     0x6e17u, 0x7e36u, 0x4e55u, 0x5e74u, 0x2e93u, 0x3eb2u, 0x0ed1u, 0x1ef0u
 };
 
+/*******************************************************************************
+* Additional tables for slice-by-4 CRC16 CCITT calculation, table [k - 1][i] is
+* the CRC of byte i followed by k zero bytes (CRC_16_Tab is the table for k = 0)
+*******************************************************************************/
+#if (CRC16_SLICES == 4u)
+static const uint16_t CRC_16_Slice_Tab[3][256] =
+{
+    {
+        0x0000u, 0x3331u, 0x6662u, 0x5553u, 0xccc4u, 0xfff5u, 0xaaa6u, 0x9997u,
+        0x89a9u, 0xba98u, 0xefcbu, 0xdcfau, 0x456du, 0x765cu, 0x230fu, 0x103eu,
+        0x0373u, 0x3042u, 0x6511u, 0x5620u, 0xcfb7u, 0xfc86u, 0xa9d5u, 0x9ae4u,
+        0x8adau, 0xb9ebu, 0xecb8u, 0xdf89u, 0x461eu, 0x752fu, 0x207cu, 0x134du,
+        0x06e6u, 0x35d7u, 0x6084u, 0x53b5u, 0xca22u, 0xf913u, 0xac40u, 0x9f71u,
+        0x8f4fu, 0xbc7eu, 0xe92du, 0xda1cu, 0x438bu, 0x70bau, 0x25e9u, 0x16d8u,
+        0x0595u, 0x36a4u, 0x63f7u, 0x50c6u, 0xc951u, 0xfa60u, 0xaf33u, 0x9c02u,
+        0x8c3cu, 0xbf0du, 0xea5eu, 0xd96fu, 0x40f8u, 0x73c9u, 0x269au, 0x15abu,
+        0x0dccu, 0x3efdu, 0x6baeu, 0x589fu, 0xc108u, 0xf239u, 0xa76au, 0x945bu,
+        0x8465u, 0xb754u, 0xe207u, 0xd136u, 0x48a1u, 0x7b90u, 0x2ec3u, 0x1df2u,
+        0x0ebfu, 0x3d8eu, 0x68ddu, 0x5becu, 0xc27bu, 0xf14au, 0xa419u, 0x9728u,
+        0x8716u, 0xb427u, 0xe174u, 0xd245u, 0x4bd2u, 0x78e3u, 0x2db0u, 0x1e81u,
+        0x0b2au, 0x381bu, 0x6d48u, 0x5e79u, 0xc7eeu, 0xf4dfu, 0xa18cu, 0x92bdu,
+        0x8283u, 0xb1b2u, 0xe4e1u, 0xd7d0u, 0x4e47u, 0x7d76u, 0x2825u, 0x1b14u,
+        0x0859u, 0x3b68u, 0x6e3bu, 0x5d0au, 0xc49du, 0xf7acu, 0xa2ffu, 0x91ceu,
+        0x81f0u, 0xb2c1u, 0xe792u, 0xd4a3u, 0x4d34u, 0x7e05u, 0x2b56u, 0x1867u,
+        0x1b98u, 0x28a9u, 0x7dfau, 0x4ecbu, 0xd75cu, 0xe46du, 0xb13eu, 0x820fu,
+        0x9231u, 0xa100u, 0xf453u, 0xc762u, 0x5ef5u, 0x6dc4u, 0x3897u, 0x0ba6u,
+        0x18ebu, 0x2bdau, 0x7e89u, 0x4db8u, 0xd42fu, 0xe71eu, 0xb24du, 0x817cu,
+        0x9142u, 0xa273u, 0xf720u, 0xc411u, 0x5d86u, 0x6eb7u, 0x3be4u, 0x08d5u,
+        0x1d7eu, 0x2e4fu, 0x7b1cu, 0x482du, 0xd1bau, 0xe28bu, 0xb7d8u, 0x84e9u,
+        0x94d7u, 0xa7e6u, 0xf2b5u, 0xc184u, 0x5813u, 0x6b22u, 0x3e71u, 0x0d40u,
+        0x1e0du, 0x2d3cu, 0x786fu, 0x4b5eu, 0xd2c9u, 0xe1f8u, 0xb4abu, 0x879au,
+        0x97a4u, 0xa495u, 0xf1c6u, 0xc2f7u, 0x5b60u, 0x6851u, 0x3d02u, 0x0e33u,
+        0x1654u, 0x2565u, 0x7036u, 0x4307u, 0xda90u, 0xe9a1u, 0xbcf2u, 0x8fc3u,
+        0x9ffdu, 0xacccu, 0xf99fu, 0xcaaeu, 0x5339u, 0x6008u, 0x355bu, 0x066au,
+        0x1527u, 0x2616u, 0x7345u, 0x4074u, 0xd9e3u, 0xead2u, 0xbf81u, 0x8cb0u,
+        0x9c8eu, 0xafbfu, 0xfaecu, 0xc9ddu, 0x504au, 0x637bu, 0x3628u, 0x0519u,
+        0x10b2u, 0x2383u, 0x76d0u, 0x45e1u, 0xdc76u, 0xef47u, 0xba14u, 0x8925u,
+        0x991bu, 0xaa2au, 0xff79u, 0xcc48u, 0x55dfu, 0x66eeu, 0x33bdu, 0x008cu,
+        0x13c1u, 0x20f0u, 0x75a3u, 0x4692u, 0xdf05u, 0xec34u, 0xb967u, 0x8a56u,
+        0x9a68u, 0xa959u, 0xfc0au, 0xcf3bu, 0x56acu, 0x659du, 0x30ceu, 0x03ffu
+    },
+    {
+        0x0000u, 0x3730u, 0x6e60u, 0x5950u, 0xdcc0u, 0xebf0u, 0xb2a0u, 0x8590u,
+        0xa9a1u, 0x9e91u, 0xc7c1u, 0xf0f1u, 0x7561u, 0x4251u, 0x1b01u, 0x2c31u,
+        0x4363u, 0x7453u, 0x2d03u, 0x1a33u, 0x9fa3u, 0xa893u, 0xf1c3u, 0xc6f3u,
+        0xeac2u, 0xddf2u, 0x84a2u, 0xb392u, 0x3602u, 0x0132u, 0x5862u, 0x6f52u,
+        0x86c6u, 0xb1f6u, 0xe8a6u, 0xdf96u, 0x5a06u, 0x6d36u, 0x3466u, 0x0356u,
+        0x2f67u, 0x1857u, 0x4107u, 0x7637u, 0xf3a7u, 0xc497u, 0x9dc7u, 0xaaf7u,
+        0xc5a5u, 0xf295u, 0xabc5u, 0x9cf5u, 0x1965u, 0x2e55u, 0x7705u, 0x4035u,
+        0x6c04u, 0x5b34u, 0x0264u, 0x3554u, 0xb0c4u, 0x87f4u, 0xdea4u, 0xe994u,
+        0x1dadu, 0x2a9du, 0x73cdu, 0x44fdu, 0xc16du, 0xf65du, 0xaf0du, 0x983du,
+        0xb40cu, 0x833cu, 0xda6cu, 0xed5cu, 0x68ccu, 0x5ffcu, 0x06acu, 0x319cu,
+        0x5eceu, 0x69feu, 0x30aeu, 0x079eu, 0x820eu, 0xb53eu, 0xec6eu, 0xdb5eu,
+        0xf76fu, 0xc05fu, 0x990fu, 0xae3fu, 0x2bafu, 0x1c9fu, 0x45cfu, 0x72ffu,
+        0x9b6bu, 0xac5bu, 0xf50bu, 0xc23bu, 0x47abu, 0x709bu, 0x29cbu, 0x1efbu,
+        0x32cau, 0x05fau, 0x5caau, 0x6b9au, 0xee0au, 0xd93au, 0x806au, 0xb75au,
+        0xd808u, 0xef38u, 0xb668u, 0x8158u, 0x04c8u, 0x33f8u, 0x6aa8u, 0x5d98u,
+        0x71a9u, 0x4699u, 0x1fc9u, 0x28f9u, 0xad69u, 0x9a59u, 0xc309u, 0xf439u,
+        0x3b5au, 0x0c6au, 0x553au, 0x620au, 0xe79au, 0xd0aau, 0x89fau, 0xbecau,
+        0x92fbu, 0xa5cbu, 0xfc9bu, 0xcbabu, 0x4e3bu, 0x790bu, 0x205bu, 0x176bu,
+        0x7839u, 0x4f09u, 0x1659u, 0x2169u, 0xa4f9u, 0x93c9u, 0xca99u, 0xfda9u,
+        0xd198u, 0xe6a8u, 0xbff8u, 0x88c8u, 0x0d58u, 0x3a68u, 0x6338u, 0x5408u,
+        0xbd9cu, 0x8aacu, 0xd3fcu, 0xe4ccu, 0x615cu, 0x566cu, 0x0f3cu, 0x380cu,
+        0x143du, 0x230du, 0x7a5du, 0x4d6du, 0xc8fdu, 0xffcdu, 0xa69du, 0x91adu,
+        0xfeffu, 0xc9cfu, 0x909fu, 0xa7afu, 0x223fu, 0x150fu, 0x4c5fu, 0x7b6fu,
+        0x575eu, 0x606eu, 0x393eu, 0x0e0eu, 0x8b9eu, 0xbcaeu, 0xe5feu, 0xd2ceu,
+        0x26f7u, 0x11c7u, 0x4897u, 0x7fa7u, 0xfa37u, 0xcd07u, 0x9457u, 0xa367u,
+        0x8f56u, 0xb866u, 0xe136u, 0xd606u, 0x5396u, 0x64a6u, 0x3df6u, 0x0ac6u,
+        0x6594u, 0x52a4u, 0x0bf4u, 0x3cc4u, 0xb954u, 0x8e64u, 0xd734u, 0xe004u,
+        0xcc35u, 0xfb05u, 0xa255u, 0x9565u, 0x10f5u, 0x27c5u, 0x7e95u, 0x49a5u,
+        0xa031u, 0x9701u, 0xce51u, 0xf961u, 0x7cf1u, 0x4bc1u, 0x1291u, 0x25a1u,
+        0x0990u, 0x3ea0u, 0x67f0u, 0x50c0u, 0xd550u, 0xe260u, 0xbb30u, 0x8c00u,
+        0xe352u, 0xd462u, 0x8d32u, 0xba02u, 0x3f92u, 0x08a2u, 0x51f2u, 0x66c2u,
+        0x4af3u, 0x7dc3u, 0x2493u, 0x13a3u, 0x9633u, 0xa103u, 0xf853u, 0xcf63u
+    },
+    {
+        0x0000u, 0x76b4u, 0xed68u, 0x9bdcu, 0xcaf1u, 0xbc45u, 0x2799u, 0x512du,
+        0x85c3u, 0xf377u, 0x68abu, 0x1e1fu, 0x4f32u, 0x3986u, 0xa25au, 0xd4eeu,
+        0x1ba7u, 0x6d13u, 0xf6cfu, 0x807bu, 0xd156u, 0xa7e2u, 0x3c3eu, 0x4a8au,
+        0x9e64u, 0xe8d0u, 0x730cu, 0x05b8u, 0x5495u, 0x2221u, 0xb9fdu, 0xcf49u,
+        0x374eu, 0x41fau, 0xda26u, 0xac92u, 0xfdbfu, 0x8b0bu, 0x10d7u, 0x6663u,
+        0xb28du, 0xc439u, 0x5fe5u, 0x2951u, 0x787cu, 0x0ec8u, 0x9514u, 0xe3a0u,
+        0x2ce9u, 0x5a5du, 0xc181u, 0xb735u, 0xe618u, 0x90acu, 0x0b70u, 0x7dc4u,
+        0xa92au, 0xdf9eu, 0x4442u, 0x32f6u, 0x63dbu, 0x156fu, 0x8eb3u, 0xf807u,
+        0x6e9cu, 0x1828u, 0x83f4u, 0xf540u, 0xa46du, 0xd2d9u, 0x4905u, 0x3fb1u,
+        0xeb5fu, 0x9debu, 0x0637u, 0x7083u, 0x21aeu, 0x571au, 0xccc6u, 0xba72u,
+        0x753bu, 0x038fu, 0x9853u, 0xeee7u, 0xbfcau, 0xc97eu, 0x52a2u, 0x2416u,
+        0xf0f8u, 0x864cu, 0x1d90u, 0x6b24u, 0x3a09u, 0x4cbdu, 0xd761u, 0xa1d5u,
+        0x59d2u, 0x2f66u, 0xb4bau, 0xc20eu, 0x9323u, 0xe597u, 0x7e4bu, 0x08ffu,
+        0xdc11u, 0xaaa5u, 0x3179u, 0x47cdu, 0x16e0u, 0x6054u, 0xfb88u, 0x8d3cu,
+        0x4275u, 0x34c1u, 0xaf1du, 0xd9a9u, 0x8884u, 0xfe30u, 0x65ecu, 0x1358u,
+        0xc7b6u, 0xb102u, 0x2adeu, 0x5c6au, 0x0d47u, 0x7bf3u, 0xe02fu, 0x969bu,
+        0xdd38u, 0xab8cu, 0x3050u, 0x46e4u, 0x17c9u, 0x617du, 0xfaa1u, 0x8c15u,
+        0x58fbu, 0x2e4fu, 0xb593u, 0xc327u, 0x920au, 0xe4beu, 0x7f62u, 0x09d6u,
+        0xc69fu, 0xb02bu, 0x2bf7u, 0x5d43u, 0x0c6eu, 0x7adau, 0xe106u, 0x97b2u,
+        0x435cu, 0x35e8u, 0xae34u, 0xd880u, 0x89adu, 0xff19u, 0x64c5u, 0x1271u,
+        0xea76u, 0x9cc2u, 0x071eu, 0x71aau, 0x2087u, 0x5633u, 0xcdefu, 0xbb5bu,
+        0x6fb5u, 0x1901u, 0x82ddu, 0xf469u, 0xa544u, 0xd3f0u, 0x482cu, 0x3e98u,
+        0xf1d1u, 0x8765u, 0x1cb9u, 0x6a0du, 0x3b20u, 0x4d94u, 0xd648u, 0xa0fcu,
+        0x7412u, 0x02a6u, 0x997au, 0xefceu, 0xbee3u, 0xc857u, 0x538bu, 0x253fu,
+        0xb3a4u, 0xc510u, 0x5eccu, 0x2878u, 0x7955u, 0x0fe1u, 0x943du, 0xe289u,
+        0x3667u, 0x40d3u, 0xdb0fu, 0xadbbu, 0xfc96u, 0x8a22u, 0x11feu, 0x674au,
+        0xa803u, 0xdeb7u, 0x456bu, 0x33dfu, 0x62f2u, 0x1446u, 0x8f9au, 0xf92eu,
+        0x2dc0u, 0x5b74u, 0xc0a8u, 0xb61cu, 0xe731u, 0x9185u, 0x0a59u, 0x7cedu,
+        0x84eau, 0xf25eu, 0x6982u, 0x1f36u, 0x4e1bu, 0x38afu, 0xa373u, 0xd5c7u,
+        0x0129u, 0x779du, 0xec41u, 0x9af5u, 0xcbd8u, 0xbd6cu, 0x26b0u, 0x5004u,
+        0x9f4du, 0xe9f9u, 0x7225u, 0x0491u, 0x55bcu, 0x2308u, 0xb8d4u, 0xce60u,
+        0x1a8eu, 0x6c3au, 0xf7e6u, 0x8152u, 0xd07fu, 0xa6cbu, 0x3d17u, 0x4ba3u
+    }
+};
+#endif /* (CRC16_SLICES == 4u) */
+
+/*******************************************************************************
+* Known-answer test data
+*******************************************************************************/
+/* Check string "123456789", word aligned so that the slice-by-4 paths are used */
+CY_ALIGN(4) static const uint8_t CRC_Check_Data[CRC_CHECK_LEN] =
+{
+    0x31u, 0x32u, 0x33u, 0x34u, 0x35u, 0x36u, 0x37u, 0x38u, 0x39u
+};
+
+/* Configurations of the generic CRC engine, each with the check value of "123456789" */
+static const stl_crc_cfg_t CRC_Engine_Cfg[] =
+{
+    STL_CRC_CFG_CRC8_SAE_J1850,
+    STL_CRC_CFG_CRC8_AUTOSAR,
+    STL_CRC_CFG_CRC16_MODBUS,
+    STL_CRC_CFG_CRC16_XMODEM,
+    STL_CRC_CFG_CRC24_OPENPGP,
+    STL_CRC_CFG_CRC32_IEEE,
+    STL_CRC_CFG_CRC32_AUTOSAR
+};
+
+#define CRC_ENGINE_CFG_COUNT    (sizeof(CRC_Engine_Cfg) / sizeof(CRC_Engine_Cfg[0]))
+
+/* CRC-32C of each 256-entry table, entries taken as little-endian bytes */
+#define CRC_32_TAB_HASH         (0xEA0FF5CDUL)
+#define CRC_16_TAB_HASH         (0x0BBF0270UL)
+
+static const uint32_t CRC_32_IEEE_Tab_Hash[CRC32_SLICES] =
+{
+    0x3835105FUL,
+    #if (CRC32_SLICES == 4u)
+    0x9A8C2C1DUL, 0xA5AF7015UL, 0xF288D67EUL
+    #endif /* (CRC32_SLICES == 4u) */
+};
+
+static const uint32_t CRC_32C_Tab_Hash[CRC32_SLICES] =
+{
+    0xB15EBB37UL,
+    #if (CRC32_SLICES == 4u)
+    0x3603989EUL, 0xEC7DABD7UL, 0xD56E1394UL
+    #endif /* (CRC32_SLICES == 4u) */
+};
+
+#if (CRC16_SLICES == 4u)
+static const uint32_t CRC_16_Slice_Tab_Hash[3] =
+{
+    0x0EAE2D4DUL, 0x22685B41UL, 0x5EA9E213UL
+};
+#endif /* (CRC16_SLICES == 4u) */
+
 /*******************************************************************************
  * Function Name: SelfTests_CRC32_Byte
  *******************************************************************************
@@ -236,85 +786,1010 @@ uint32_t SelfTests_CRC32(uint32_t BaseAdress, uint32_t len)
 
 
 /*******************************************************************************
- * Function Name: SelfTests_CRC16_CCITT_Byte
+ * Function Name: SelfTests_CRC32_Reflected
  *******************************************************************************
  *
  * Summary:
- *  This function calculates CRC of one byte "val"
+ *  This function calculates a reflected CRC-32 with final XOR, as defined by the
+ *  standard CRC-32 and CRC-32C, using the slice-by-4 tables "tab". Single bytes
+ *  are processed until the pointer is word aligned, then one 32-bit word per
+ *  iteration with four table lookups.
  *
  * Parameters:
- *  uint16 crc - The current CRC.
- *  uint8 val - The value to calculate the CRC for.
+ *  const uint32 (*tab)[256] - The slice tables.
+ *  uint32 crc - The CRC of the preceding data, 0 for the first block.
+ *  uint32 BaseAdress - The address from which to calculate the CRC.
+ *  uint32 len - The length of the area for CRC calculation.
  *
  * Return:
- *  uint16 crc - The calculated CRC value.
+ *  uint32 calc_crc - The calculated CRC value.
  *
  * Note:
+ *  The word access assumes little-endian byte order, as on all supported cores.
  *
  ******************************************************************************/
-uint16_t SelfTests_CRC16_CCITT_Byte(uint16_t crc, uint8_t val)
+static uint32_t SelfTests_CRC32_Reflected(const uint32_t (*tab)[256], uint32_t crc,
+                                          uint32_t BaseAdress, uint32_t len)
 {
-    return (uint16_t)(crc << 8u) ^ CRC_16_Tab[((crc >> 8u) ^ val)];
+    uint32_t calc_crc = ~crc;
+    const uint8_t* regPointer = (const uint8_t*)BaseAdress;
+    uint32_t n = len;
+
+    #if (CRC32_SLICES == 4u)
+    while ((n != 0UL) && (((uint32_t)regPointer & 3UL) != 0UL))
+    {
+        calc_crc = tab[0][(calc_crc ^ *regPointer) & CRC_MASK] ^ (calc_crc >> 8u);
+        regPointer++;
+        n--;
+    }
+
+    while (n >= 4UL)
+    {
+        calc_crc ^= *(const uint32_t*)regPointer;
+        calc_crc = tab[3][calc_crc & CRC_MASK] ^
+                   tab[2][(calc_crc >> 8u) & CRC_MASK] ^
+                   tab[1][(calc_crc >> 16u) & CRC_MASK] ^
+                   tab[0][calc_crc >> 24u];
+        regPointer += 4u;
+        n -= 4UL;
+    }
+    #endif /* (CRC32_SLICES == 4u) */
+
+    while (n != 0UL)
+    {
+        calc_crc = tab[0][(calc_crc ^ *regPointer) & CRC_MASK] ^ (calc_crc >> 8u);
+        regPointer++;
+        n--;
+    }
+
+    return ~calc_crc;
 }
 
 
 /*******************************************************************************
- * Function Name: SelfTests_CRC16_CCITT_ACC
+ * Function Name: SelfTests_CRC32_IEEE_ACC
  *******************************************************************************
  *
  * Summary:
- *  This function calculates the CRC of the area defined in the parameters "BaseAdress"
- *  and "len".
+ *  This function continues the standard CRC-32 over the area defined in the
+ *  parameters "BaseAdress" and "len".
  *
  * Parameters:
- *  uint16 crc - The current CRC.
+ *  uint32 crc - The CRC of the preceding data, 0 for the first block.
  *  uint32 BaseAdress - The address from which to calculate the CRC.
- *  uint16 len - The length of area for CRC calculation.
+ *  uint32 len - The length of the area for CRC calculation.
  *
  * Return:
- *  uint16 crc - calculated CRC value
+ *  uint32 calc_crc - The calculated CRC value.
  *
- * Note:
+ ******************************************************************************/
+uint32_t SelfTests_CRC32_IEEE_ACC(uint32_t crc, uint32_t BaseAdress, uint32_t len)
+{
+    return SelfTests_CRC32_Reflected(CRC_32_IEEE_Tab, crc, BaseAdress, len);
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC32_IEEE
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function calculates the standard CRC-32 of the memory area defined in
+ *  the parameters "BaseAdress" and "len".
+ *
+ * Parameters:
+ *  uint32 BaseAdress - The address from which to calculate the CRC.
+ *  uint32 len - The length of the area for CRC calculation.
+ *
+ * Return:
+ *  uint32 calc_crc - The calculated CRC value.
  *
  ******************************************************************************/
+uint32_t SelfTests_CRC32_IEEE(uint32_t BaseAdress, uint32_t len)
+{
+    return SelfTests_CRC32_Reflected(CRC_32_IEEE_Tab, 0UL, BaseAdress, len);
+}
 
-uint16_t SelfTests_CRC16_CCITT_ACC(uint16_t crc, uint32_t BaseAdress, uint16_t len)
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC32C_ACC
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function continues the CRC-32C over the area defined in the parameters
+ *  "BaseAdress" and "len".
+ *
+ * Parameters:
+ *  uint32 crc - The CRC of the preceding data, 0 for the first block.
+ *  uint32 BaseAdress - The address from which to calculate the CRC.
+ *  uint32 len - The length of the area for CRC calculation.
+ *
+ * Return:
+ *  uint32 calc_crc - The calculated CRC value.
+ *
+ ******************************************************************************/
+uint32_t SelfTests_CRC32C_ACC(uint32_t crc, uint32_t BaseAdress, uint32_t len)
 {
-    uint16_t calc_crc = crc;
-    uint8_t* regPointer;
-    regPointer = (uint8_t*)BaseAdress;
+    return SelfTests_CRC32_Reflected(CRC_32C_Tab, crc, BaseAdress, len);
+}
 
-    for (uint32_t i = 0UL; i < len; i++)
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC32C
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function calculates the CRC-32C of the memory area defined in the
+ *  parameters "BaseAdress" and "len".
+ *
+ * Parameters:
+ *  uint32 BaseAdress - The address from which to calculate the CRC.
+ *  uint32 len - The length of the area for CRC calculation.
+ *
+ * Return:
+ *  uint32 calc_crc - The calculated CRC value.
+ *
+ ******************************************************************************/
+uint32_t SelfTests_CRC32C(uint32_t BaseAdress, uint32_t len)
+{
+    return SelfTests_CRC32_Reflected(CRC_32C_Tab, 0UL, BaseAdress, len);
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_GF2_Matrix_Times
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function multiplies a 32x32 GF(2) matrix, stored as 32 columns, by a
+ *  32-bit vector.
+ *
+ * Parameters:
+ *  const uint32 *mat - The matrix columns, mat[i] is the image of bit i.
+ *  uint32 vec - The vector.
+ *
+ * Return:
+ *  uint32 sum - The product.
+ *
+ ******************************************************************************/
+static uint32_t SelfTests_GF2_Matrix_Times(const uint32_t* mat, uint32_t vec)
+{
+    uint32_t sum = 0UL;
+    uint32_t bits = vec;
+    uint32_t i = 0UL;
+
+    while (bits != 0UL)
     {
-        calc_crc = SelfTests_CRC16_CCITT_Byte(calc_crc, *regPointer);
-        regPointer++;
+        if ((bits & 1UL) != 0UL)
+        {
+            sum ^= mat[i];
+        }
+        bits >>= 1u;
+        i++;
+    }
+    return sum;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_GF2_Matrix_Square
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function squares a width x width GF(2) matrix: square = mat * mat.
+ *
+ ******************************************************************************/
+static void SelfTests_GF2_Matrix_Square(uint32_t* square, const uint32_t* mat, uint32_t width)
+{
+    for (uint32_t i = 0UL; i < width; i++)
+    {
+        square[i] = SelfTests_GF2_Matrix_Times(mat, mat[i]);
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC_Bit_Operator
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function builds the operator that feeds one zero bit into the CRC
+ *  register of "type" and returns the register width.
+ *
+ * Parameters:
+ *  uint32 *odd - The operator, 32 columns.
+ *  stl_crc_type_t type - The CRC variant.
+ *
+ * Return:
+ *  uint32 width - The CRC register width in bits.
+ *
+ ******************************************************************************/
+static uint32_t SelfTests_CRC_Bit_Operator(uint32_t* odd, stl_crc_type_t type)
+{
+    uint32_t width = 32UL;
+
+    if ((type == STL_CRC_32_IEEE) || (type == STL_CRC_32C))
+    {
+        /* Reflected: the register is shifted right, the bit shifted out of bit 0
+           feeds back the reflected polynomial */
+        odd[0] = (type == STL_CRC_32_IEEE) ? CRC_32_IEEE_Tab[0][128] : CRC_32C_Tab[0][128];
+        for (uint32_t i = 1UL; i < 32UL; i++)
+        {
+            odd[i] = (uint32_t)1UL << (i - 1UL);
+        }
+    }
+    else
+    {
+        /* MSB first: the register is shifted left, the bit shifted out of the top
+           feeds back the polynomial */
+        if (type == STL_CRC_16_CCITT)
+        {
+            width = 16UL;
+        }
+        odd[width - 1UL] = (type == STL_CRC_16_CCITT) ? (uint32_t)CRC_16_Tab[1] : CRC_32_Tab[1];
+        for (uint32_t i = 0UL; i < (width - 1UL); i++)
+        {
+            odd[i] = (uint32_t)1UL << (i + 1UL);
+        }
+    }
+    return width;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC_Shift
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function returns the CRC register after "len" zero bytes were fed into
+ *  it, in O(log(len)) matrix operations. The CRC update is linear in the
+ *  register, so shifting by len bytes is the len*8-th power of the one-bit
+ *  operator, which is built by repeated squaring.
+ *
+ * Parameters:
+ *  stl_crc_type_t type - The CRC variant.
+ *  uint32 crc - The CRC register.
+ *  uint32 len - The number of zero bytes.
+ *
+ * Return:
+ *  uint32 crc - The shifted CRC register.
+ *
+ ******************************************************************************/
+static uint32_t SelfTests_CRC_Shift(stl_crc_type_t type, uint32_t crc, uint32_t len)
+{
+    uint32_t even[32];  /* Operator for an even power of two zero bits */
+    uint32_t odd[32];   /* Operator for an odd power of two zero bits */
+    uint32_t calc_crc = crc;
+    uint32_t n = len;
+    uint32_t width;
+
+    if (n == 0UL)
+    {
+        return calc_crc;
     }
 
+    width = SelfTests_CRC_Bit_Operator(odd, type);
+
+    /* Operators for two and four zero bits */
+    SelfTests_GF2_Matrix_Square(even, odd, width);
+    SelfTests_GF2_Matrix_Square(odd, even, width);
+
+    /* Apply len zero bytes, starting with the one-byte operator */
+    do
+    {
+        SelfTests_GF2_Matrix_Square(even, odd, width);
+        if ((n & 1UL) != 0UL)
+        {
+            calc_crc = SelfTests_GF2_Matrix_Times(even, calc_crc);
+        }
+        n >>= 1u;
+
+        if (n == 0UL)
+        {
+            break;
+        }
+
+        SelfTests_GF2_Matrix_Square(odd, even, width);
+        if ((n & 1UL) != 0UL)
+        {
+            calc_crc = SelfTests_GF2_Matrix_Times(odd, calc_crc);
+        }
+        n >>= 1u;
+    } while (n != 0UL);
+
     return calc_crc;
 }
 
 
 /*******************************************************************************
- * Function Name: SelfTests_CRC16_CCITT
+ * Function Name: SelfTests_CRC_Combine_Offset
  *******************************************************************************
  *
  * Summary:
- *  This function calculates the CRC of the memory area defined in the parameters
- *  "BaseAdress" and "len".
+ *  This function returns the value that is removed from the first CRC before
+ *  the shift. The functions without final XOR start from a non-zero init value,
+ *  which contributes to the second CRC as well.
+ *
+ ******************************************************************************/
+static uint32_t SelfTests_CRC_Combine_Offset(stl_crc_type_t type)
+{
+    return (type == STL_CRC_32) ? CRC32_INIT_VALUE : 0UL;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC32_Combine
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function combines the CRCs of two adjacent areas into the CRC of the
+ *  concatenated area.
  *
  * Parameters:
- *  uint32 BaseAdress - The address from which to calcuate the CRC.
- *  uint16 len - The length of area for CRC calculation.
+ *  uint32 crc1 - The CRC of the first area.
+ *  uint32 crc2 - The CRC of the second area.
+ *  uint32 len2 - The length of the second area in bytes.
  *
  * Return:
- *  uint16 crc - The calculated CRC value.
+ *  uint32 crc - The CRC of both areas.
  *
  * Note:
+ *  Both CRCs start from CRC32_INIT_VALUE. The init value contributes to crc2
+ *  as well, so it is removed from crc1 before the shift:
+ *  CRC(A+B) = CRC(B) ^ Shift(CRC(A) ^ INIT, len(B)).
  *
  ******************************************************************************/
-uint16_t SelfTests_CRC16_CCITT(uint32_t BaseAdress, uint16_t len)
+uint32_t SelfTests_CRC32_Combine(uint32_t crc1, uint32_t crc2, uint32_t len2)
 {
-    return SelfTests_CRC16_CCITT_ACC(CRC16_CCITT_INIT_VALUE, BaseAdress, len);
+    return crc2 ^ SelfTests_CRC_Shift(STL_CRC_32, crc1 ^ CRC32_INIT_VALUE, len2);
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC32_IEEE_Combine
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function combines the standard CRC-32 of two adjacent areas into the
+ *  CRC of the concatenated area, as zlib crc32_combine().
+ *
+ * Parameters:
+ *  uint32 crc1 - The CRC of the first area.
+ *  uint32 crc2 - The CRC of the second area.
+ *  uint32 len2 - The length of the second area in bytes.
+ *
+ * Return:
+ *  uint32 crc - The CRC of both areas.
+ *
+ * Note:
+ *  The init value and the final XOR are equal and cancel out:
+ *  CRC(A+B) = CRC(B) ^ Shift(CRC(A), len(B)).
+ *
+ ******************************************************************************/
+uint32_t SelfTests_CRC32_IEEE_Combine(uint32_t crc1, uint32_t crc2, uint32_t len2)
+{
+    return crc2 ^ SelfTests_CRC_Shift(STL_CRC_32_IEEE, crc1, len2);
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC32C_Combine
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function combines the CRC-32C of two adjacent areas into the CRC of
+ *  the concatenated area.
+ *
+ * Parameters:
+ *  uint32 crc1 - The CRC of the first area.
+ *  uint32 crc2 - The CRC of the second area.
+ *  uint32 len2 - The length of the second area in bytes.
+ *
+ * Return:
+ *  uint32 crc - The CRC of both areas.
+ *
+ ******************************************************************************/
+uint32_t SelfTests_CRC32C_Combine(uint32_t crc1, uint32_t crc2, uint32_t len2)
+{
+    return crc2 ^ SelfTests_CRC_Shift(STL_CRC_32C, crc1, len2);
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC16_CCITT_Combine
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function combines the CRC16 of two adjacent areas into the CRC of the
+ *  concatenated area.
+ *
+ * Parameters:
+ *  uint16 crc1 - The CRC of the first area.
+ *  uint16 crc2 - The CRC of the second area.
+ *  uint32 len2 - The length of the second area in bytes.
+ *
+ * Return:
+ *  uint16 crc - The CRC of both areas.
+ *
+ * Note:
+ *  The init value is 0, so CRC(A+B) = CRC(B) ^ Shift(CRC(A), len(B)).
+ *
+ ******************************************************************************/
+uint16_t SelfTests_CRC16_CCITT_Combine(uint16_t crc1, uint16_t crc2, uint32_t len2)
+{
+    return (uint16_t)((uint32_t)crc2 ^ SelfTests_CRC_Shift(STL_CRC_16_CCITT, crc1, len2));
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC16_CCITT_Append
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function appends the data of context "next", calculated separately,
+ *  to context "ctx".
+ *
+ * Parameters:
+ *  stl_crc16_ctx_t* ctx - The context of the first part, updated.
+ *  const stl_crc16_ctx_t* next - The context of the following part.
+ *
+ * Return:
+ *  None
+ *
+ ******************************************************************************/
+void SelfTests_CRC16_CCITT_Append(stl_crc16_ctx_t* ctx, const stl_crc16_ctx_t* next)
+{
+    ctx->crc = SelfTests_CRC16_CCITT_Combine(ctx->crc, next->crc, next->length);
+    ctx->length += next->length;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC_CombineSegments
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function combines the CRCs of adjacent segments, calculated separately
+ *  (for example by different cores or DMA channels, or cached for unchanged
+ *  Flash sectors), into the CRC of the whole area.
+ *
+ * Parameters:
+ *  stl_crc_type_t type - The CRC variant used for all segments.
+ *  const stl_crc_segment_t* segments - The segments in address order.
+ *  uint32 count - The number of segments.
+ *
+ * Return:
+ *  uint32 crc - The CRC of the whole area.
+ *
+ ******************************************************************************/
+uint32_t SelfTests_CRC_CombineSegments(stl_crc_type_t type, const stl_crc_segment_t* segments,
+                                       uint32_t count)
+{
+    uint32_t offset = SelfTests_CRC_Combine_Offset(type);
+
+    /* CRC of an empty area */
+    uint32_t crc = offset;
+
+    for (uint32_t i = 0UL; i < count; i++)
+    {
+        crc = segments[i].crc ^ SelfTests_CRC_Shift(type, crc ^ offset, segments[i].length);
+    }
+    return crc;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC_ShiftOp_Init
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function calculates the operator that shifts a CRC register of "type"
+ *  over "len" zero bytes. Segments of equal length can then be combined with
+ *  one matrix-vector product each by SelfTests_CRC_Combine_Op().
+ *
+ * Parameters:
+ *  stl_crc_shift_op_t* op - The operator.
+ *  stl_crc_type_t type - The CRC variant.
+ *  uint32 len - The segment length in bytes.
+ *
+ * Return:
+ *  None
+ *
+ ******************************************************************************/
+void SelfTests_CRC_ShiftOp_Init(stl_crc_shift_op_t* op, stl_crc_type_t type, uint32_t len)
+{
+    uint32_t power[32];
+    uint32_t tmp[32];
+    uint32_t width;
+    uint32_t n = len;
+
+    op->type = type;
+    width = SelfTests_CRC_Bit_Operator(power, type);
+
+    /* One-byte operator */
+    SelfTests_GF2_Matrix_Square(tmp, power, width);
+    SelfTests_GF2_Matrix_Square(power, tmp, width);
+    SelfTests_GF2_Matrix_Square(tmp, power, width);
+    for (uint32_t i = 0UL; i < width; i++)
+    {
+        power[i] = tmp[i];
+        op->mat[i] = (uint32_t)1UL << i;
+    }
+
+    /* op = product of the power-of-two byte operators selected by len */
+    while (n != 0UL)
+    {
+        if ((n & 1UL) != 0UL)
+        {
+            for (uint32_t i = 0UL; i < width; i++)
+            {
+                op->mat[i] = SelfTests_GF2_Matrix_Times(power, op->mat[i]);
+            }
+        }
+        n >>= 1u;
+        if (n != 0UL)
+        {
+            SelfTests_GF2_Matrix_Square(tmp, power, width);
+            for (uint32_t i = 0UL; i < width; i++)
+            {
+                power[i] = tmp[i];
+            }
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC_Combine_Op
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function combines the CRC of an area with the CRC of the following
+ *  segment, whose length was passed to SelfTests_CRC_ShiftOp_Init().
+ *
+ * Parameters:
+ *  const stl_crc_shift_op_t* op - The operator for the segment length.
+ *  uint32 crc1 - The CRC of the first area.
+ *  uint32 crc2 - The CRC of the segment.
+ *
+ * Return:
+ *  uint32 crc - The CRC of both areas.
+ *
+ ******************************************************************************/
+uint32_t SelfTests_CRC_Combine_Op(const stl_crc_shift_op_t* op, uint32_t crc1, uint32_t crc2)
+{
+    uint32_t offset = SelfTests_CRC_Combine_Offset(op->type);
+
+    return crc2 ^ SelfTests_GF2_Matrix_Times(op->mat, crc1 ^ offset);
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC16_CCITT_Byte
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function calculates CRC of one byte "val"
+ *
+ * Parameters:
+ *  uint16 crc - The current CRC.
+ *  uint8 val - The value to calculate the CRC for.
+ *
+ * Return:
+ *  uint16 crc - The calculated CRC value.
+ *
+ * Note:
+ *
+ ******************************************************************************/
+uint16_t SelfTests_CRC16_CCITT_Byte(uint16_t crc, uint8_t val)
+{
+    return (uint16_t)(crc << 8u) ^ CRC_16_Tab[((crc >> 8u) ^ val)];
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC16_CCITT_ACC
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function calculates the CRC of the area defined in the parameters "BaseAdress"
+ *  and "len".
+ *
+ * Parameters:
+ *  uint16 crc - The current CRC.
+ *  uint32 BaseAdress - The address from which to calculate the CRC.
+ *  uint16 len - The length of area for CRC calculation.
+ *
+ * Return:
+ *  uint16 crc - calculated CRC value
+ *
+ * Note:
+ *
+ ******************************************************************************/
+
+uint16_t SelfTests_CRC16_CCITT_ACC(uint16_t crc, uint32_t BaseAdress, uint16_t len)
+{
+    return SelfTests_CRC16_CCITT_Block(crc, BaseAdress, (uint32_t)len);
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC16_CCITT_Block
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function calculates the CRC of the area defined in the parameters "BaseAdress"
+ *  and "len". Single bytes are processed until the pointer is word aligned, then one
+ *  32-bit word per iteration with four table lookups (slice-by-4).
+ *
+ * Parameters:
+ *  uint16 crc - The current CRC.
+ *  uint32 BaseAdress - The address from which to calculate the CRC.
+ *  uint32 len - The length of area for CRC calculation.
+ *
+ * Return:
+ *  uint16 crc - calculated CRC value
+ *
+ * Note:
+ *  The word access assumes little-endian byte order, as on all supported cores.
+ *
+ ******************************************************************************/
+uint16_t SelfTests_CRC16_CCITT_Block(uint16_t crc, uint32_t BaseAdress, uint32_t len)
+{
+    uint32_t calc_crc = crc;
+    const uint8_t* regPointer = (const uint8_t*)BaseAdress;
+    uint32_t n = len;
+
+    #if (CRC16_SLICES == 4u)
+    uint32_t word;
+
+    while ((n != 0UL) && (((uint32_t)regPointer & 3UL) != 0UL))
+    {
+        calc_crc = SelfTests_CRC16_CCITT_Byte((uint16_t)calc_crc, *regPointer);
+        regPointer++;
+        n--;
+    }
+
+    while (n >= 4UL)
+    {
+        /* The CRC is MSB first: its high byte meets the first byte of the word */
+        word = *(const uint32_t*)regPointer;
+        calc_crc = (uint32_t)CRC_16_Slice_Tab[2][((calc_crc >> 8u) ^ word) & CRC_MASK] ^
+                   (uint32_t)CRC_16_Slice_Tab[1][(calc_crc ^ (word >> 8u)) & CRC_MASK] ^
+                   (uint32_t)CRC_16_Slice_Tab[0][(word >> 16u) & CRC_MASK] ^
+                   (uint32_t)CRC_16_Tab[word >> 24u];
+        regPointer += 4u;
+        n -= 4UL;
+    }
+    #endif /* (CRC16_SLICES == 4u) */
+
+    while (n != 0UL)
+    {
+        calc_crc = SelfTests_CRC16_CCITT_Byte((uint16_t)calc_crc, *regPointer);
+        regPointer++;
+        n--;
+    }
+
+    return (uint16_t)calc_crc;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC16_CCITT_Init
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function starts an incremental CRC16 calculation.
+ *
+ * Parameters:
+ *  stl_crc16_ctx_t* ctx - The calculation context.
+ *
+ * Return:
+ *  None
+ *
+ ******************************************************************************/
+void SelfTests_CRC16_CCITT_Init(stl_crc16_ctx_t* ctx)
+{
+    ctx->crc = CRC16_CCITT_INIT_VALUE;
+    ctx->length = 0UL;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC16_CCITT_Update
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function adds the area defined in the parameters "BaseAdress" and "len" to
+ *  an incremental CRC16 calculation.
+ *
+ * Parameters:
+ *  stl_crc16_ctx_t* ctx - The calculation context.
+ *  uint32 BaseAdress - The address from which to calculate the CRC.
+ *  uint32 len - The length of area for CRC calculation.
+ *
+ * Return:
+ *  None
+ *
+ ******************************************************************************/
+void SelfTests_CRC16_CCITT_Update(stl_crc16_ctx_t* ctx, uint32_t BaseAdress, uint32_t len)
+{
+    ctx->crc = SelfTests_CRC16_CCITT_Block(ctx->crc, BaseAdress, len);
+    ctx->length += len;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC16_CCITT_UpdateByte
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function adds one byte "val" to an incremental CRC16 calculation.
+ *
+ * Parameters:
+ *  stl_crc16_ctx_t* ctx - The calculation context.
+ *  uint8 val - The value to add.
+ *
+ * Return:
+ *  None
+ *
+ ******************************************************************************/
+void SelfTests_CRC16_CCITT_UpdateByte(stl_crc16_ctx_t* ctx, uint8_t val)
+{
+    ctx->crc = SelfTests_CRC16_CCITT_Byte(ctx->crc, val);
+    ctx->length++;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC16_CCITT_UpdateEscaped
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function adds the memory area to an incremental CRC16 calculation as
+ *  it is sent with byte stuffing: "mark" and "esc" bytes are replaced by the
+ *  "esc", byte + 1 sequence.
+ *
+ * Parameters:
+ *  stl_crc16_ctx_t* ctx - The calculation context.
+ *  uint32 BaseAdress - The address from which to calculate the CRC.
+ *  uint32 len - The length of the area for CRC calculation.
+ *  uint8 mark - The frame marker byte.
+ *  uint8 esc - The escape byte.
+ *
+ * Return:
+ *  None
+ *
+ ******************************************************************************/
+void SelfTests_CRC16_CCITT_UpdateEscaped(stl_crc16_ctx_t* ctx, uint32_t BaseAdress, uint32_t len,
+                                         uint8_t mark, uint8_t esc)
+{
+    const uint8_t* data = (const uint8_t*)BaseAdress;
+    uint32_t runStart = 0UL;
+
+    for (uint32_t i = 0UL; i < len; i++)
+    {
+        if ((data[i] == mark) || (data[i] == esc))
+        {
+            /* The run without stuffed bytes is processed word-wise */
+            SelfTests_CRC16_CCITT_Update(ctx, BaseAdress + runStart, i - runStart);
+            SelfTests_CRC16_CCITT_UpdateByte(ctx, esc);
+            SelfTests_CRC16_CCITT_UpdateByte(ctx, (uint8_t)(data[i] + 1u));
+            runStart = i + 1UL;
+        }
+    }
+    SelfTests_CRC16_CCITT_Update(ctx, BaseAdress + runStart, len - runStart);
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC16_CCITT_Final
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function returns the CRC16 of all data added to the context.
+ *
+ * Parameters:
+ *  const stl_crc16_ctx_t* ctx - The calculation context.
+ *
+ * Return:
+ *  uint16 crc - calculated CRC value
+ *
+ ******************************************************************************/
+uint16_t SelfTests_CRC16_CCITT_Final(const stl_crc16_ctx_t* ctx)
+{
+    return ctx->crc;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC16_CCITT
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function calculates the CRC of the memory area defined in the parameters
+ *  "BaseAdress" and "len".
+ *
+ * Parameters:
+ *  uint32 BaseAdress - The address from which to calcuate the CRC.
+ *  uint16 len - The length of area for CRC calculation.
+ *
+ * Return:
+ *  uint16 crc - The calculated CRC value.
+ *
+ * Note:
+ *
+ ******************************************************************************/
+uint16_t SelfTests_CRC16_CCITT(uint32_t BaseAdress, uint16_t len)
+{
+    return SelfTests_CRC16_CCITT_ACC(CRC16_CCITT_INIT_VALUE, BaseAdress, len);
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC_Table_Hash
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function calculates the CRC-32C of a 256-entry table bit by bit, so
+ *  that the result does not depend on any lookup table.
+ *
+ * Parameters:
+ *  const void* table - The table.
+ *  uint32 entrySize - The entry size in bytes, 2 or 4.
+ *
+ * Return:
+ *  uint32 hash - The table hash.
+ *
+ ******************************************************************************/
+static uint32_t SelfTests_CRC_Table_Hash(const void* table, uint32_t entrySize)
+{
+    uint32_t hash = 0xFFFFFFFFUL;
+    uint32_t entry;
+
+    for (uint32_t i = 0UL; i < 256UL; i++)
+    {
+        entry = (entrySize == 4UL) ? ((const uint32_t*)table)[i] :
+                (uint32_t)((const uint16_t*)table)[i];
+
+        for (uint32_t bit = 0UL; bit < (entrySize * 8UL); bit++)
+        {
+            hash = (((hash ^ entry) & 1UL) != 0UL) ? ((hash >> 1u) ^ 0x82F63B78UL) : (hash >> 1u);
+            entry >>= 1u;
+        }
+    }
+
+    #if (ERROR_IN_CRC == 1)
+    hash ^= 1UL;
+    #endif /* End ERROR_IN_CRC */
+
+    return ~hash;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC_Check_Tables
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function compares the hash of every CRC table with the value
+ *  calculated when the tables were generated.
+ *
+ * Parameters:
+ *  None
+ *
+ * Return:
+ *  OK_STATUS - All tables are intact.
+ *  ERROR_STATUS - At least one table is corrupted.
+ *
+ ******************************************************************************/
+uint8_t SelfTests_CRC_Check_Tables(void)
+{
+    uint8_t ret = OK_STATUS;
+
+    if ((SelfTests_CRC_Table_Hash(CRC_32_Tab, 4UL) != CRC_32_TAB_HASH) ||
+        (SelfTests_CRC_Table_Hash(CRC_16_Tab, 2UL) != CRC_16_TAB_HASH))
+    {
+        ret = ERROR_STATUS;
+    }
+
+    for (uint32_t k = 0UL; k < CRC32_SLICES; k++)
+    {
+        if ((SelfTests_CRC_Table_Hash(CRC_32_IEEE_Tab[k], 4UL) != CRC_32_IEEE_Tab_Hash[k]) ||
+            (SelfTests_CRC_Table_Hash(CRC_32C_Tab[k], 4UL) != CRC_32C_Tab_Hash[k]))
+        {
+            ret = ERROR_STATUS;
+        }
+    }
+
+    #if (CRC16_SLICES == 4u)
+    for (uint32_t k = 0UL; k < 3UL; k++)
+    {
+        if (SelfTests_CRC_Table_Hash(CRC_16_Slice_Tab[k], 2UL) != CRC_16_Slice_Tab_Hash[k])
+        {
+            ret = ERROR_STATUS;
+        }
+    }
+    #endif /* (CRC16_SLICES == 4u) */
+
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_CRC_KAT
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function runs the check string "123456789" through every CRC variant,
+ *  both through the word-wise and the byte-wise paths, and through every
+ *  STL_CRC_CFG_* configuration of the CRC engine, bit by bit and with the
+ *  nibble table. It compares the results with the standard check values and
+ *  then checks the table hashes.
+ *
+ * Parameters:
+ *  None
+ *
+ * Return:
+ *  OK_STATUS - All CRC functions and tables passed.
+ *  ERROR_STATUS - A result or a table hash is wrong.
+ *
+ ******************************************************************************/
+uint8_t SelfTests_CRC_KAT(void)
+{
+    uint8_t ret = OK_STATUS;
+    uint32_t data = (uint32_t)CRC_Check_Data;
+    uint16_t crc16 = CRC16_CCITT_INIT_VALUE;
+    uint32_t crc32Ieee = 0UL;
+    uint32_t crc32c = 0UL;
+    uint32_t engineTable[STL_CRC_TABLE_NIBBLE];
+    stl_crc_engine_t engine;
+
+    /* Byte-wise paths */
+    for (uint32_t i = 0UL; i < CRC_CHECK_LEN; i++)
+    {
+        crc16 = SelfTests_CRC16_CCITT_Byte(crc16, CRC_Check_Data[i]);
+        crc32Ieee = SelfTests_CRC32_IEEE_ACC(crc32Ieee, data + i, 1UL);
+        crc32c = SelfTests_CRC32C_ACC(crc32c, data + i, 1UL);
+    }
+
+    if ((crc16 != CRC16_CCITT_CHECK) ||
+        (crc32Ieee != CRC32_IEEE_CHECK) ||
+        (crc32c != CRC32C_CHECK) ||
+        (SelfTests_CRC32(data, CRC_CHECK_LEN) != CRC32_CHECK))
+    {
+        ret = ERROR_STATUS;
+    }
+
+    /* Word-wise paths */
+    crc16 = SelfTests_CRC16_CCITT_Block(CRC16_CCITT_INIT_VALUE, data, CRC_CHECK_LEN);
+    if ((crc16 != CRC16_CCITT_CHECK) ||
+        (SelfTests_CRC32_IEEE(data, CRC_CHECK_LEN) != CRC32_IEEE_CHECK) ||
+        (SelfTests_CRC32C(data, CRC_CHECK_LEN) != CRC32C_CHECK))
+    {
+        ret = ERROR_STATUS;
+    }
+
+    /* Engine configurations, without a table and with the nibble table on the stack */
+    for (uint32_t i = 0UL; i < CRC_ENGINE_CFG_COUNT; i++)
+    {
+        if ((SelfTests_CRC_Engine_Init(&engine, &CRC_Engine_Cfg[i], STL_CRC_TABLE_NONE,
+                                       NULL) != OK_STATUS) ||
+            (SelfTests_CRC_Engine_KAT(&engine) != OK_STATUS) ||
+            (SelfTests_CRC_Engine_Init(&engine, &CRC_Engine_Cfg[i], STL_CRC_TABLE_NIBBLE,
+                                       engineTable) != OK_STATUS) ||
+            (SelfTests_CRC_Engine_KAT(&engine) != OK_STATUS))
+        {
+            ret = ERROR_STATUS;
+        }
+    }
+
+    if (SelfTests_CRC_Check_Tables() != OK_STATUS)
+    {
+        ret = ERROR_STATUS;
+    }
+
+    return ret;
 }
 
 
@@ -44,8 +44,37 @@
  *
  * These functions are used by the various modules for calculating the CRC.
  *
+ * \ref SelfTests_CRC32 uses an MSB-first shift with the 0xEDB88320 constant and is kept for
+ * compatibility with stored reference values. \ref SelfTests_CRC32_IEEE (IEEE 802.3, as zlib
+ * crc32) and \ref SelfTests_CRC32C (Castagnoli) are standard reflected CRC-32 variants that match
+ * host tools and CRC hardware.
+ *
+ *
+ * \ref SelfTests_CRC16_CCITT_Block takes a 32-bit length and processes one word per step. The
+ * context functions \ref SelfTests_CRC16_CCITT_Init, \ref SelfTests_CRC16_CCITT_Update and
+ * \ref SelfTests_CRC16_CCITT_Final calculate the CRC of data that arrives in parts, for example
+ * a message assembled from a header and a payload buffer. \ref SelfTests_CRC16_CCITT_UpdateEscaped
+ * adds data as it is sent by a byte-stuffing protocol such as the UART message protocol.
+ *
+ *
+ * The CRC of an area can also be calculated in segments, for example by several cores or DMA
+ * channels, or cached for unchanged Flash sectors. \ref SelfTests_CRC_CombineSegments merges the
+ * segment CRCs into the CRC of the whole area with GF(2) matrix exponentiation, in O(log(len))
+ * operations per segment; the result is equal to the sequential calculation.
+ *
+ *
+ * The CRC tables are the base of the Flash, configuration register, and UART protocol tests,
+ * but they are checked by the Flash test only if they are located in the scanned range.
+ * \ref SelfTests_CRC_KAT checks every CRC function and every STL_CRC_CFG_* configuration of
+ * the CRC engine with the check string "123456789" and compares a hash of every table with the
+ * value calculated when the tables were generated, so a corrupted table is detected before it
+ * hides other faults. Call it at startup and periodically before the tests that use the CRC
+ * functions.
+ *
  *
  * \defgroup group_crc_macros Macros
+ * \defgroup group_crc_enums Enumerated Types
+ * \defgroup group_crc_data_structures Data Structures
  * \defgroup group_crc_functions Functions
  */
 
@@ -53,6 +82,7 @@
     #define SELFTEST_CRC_CALC_H
 
 #include "cy_pdl.h"
+#include "SelfTest_common.h"
 
 /** \addtogroup group_crc_macros
  * \{
@@ -66,8 +96,75 @@
 
 /** Initial value for CRC-16 */
 #define CRC16_CCITT_INIT_VALUE    (0x0000U)
+
+/** Number of tables used by the standard CRC-32 and CRC-32C functions: 4 - slice-by-4,
+ *  one 32-bit word per step (4 KB of tables per variant); 1 - one byte per step (1 KB) */
+#define CRC32_SLICES            (4u)
+
+/** Number of tables used by \ref SelfTests_CRC16_CCITT_Block: 4 - slice-by-4 (2 KB of tables),
+ *  1 - one byte per step with the 512-byte table only */
+#define CRC16_SLICES            (4u)
+
+/** Length of the check string "123456789" */
+#define CRC_CHECK_LEN           (9u)
+
+/** \ref SelfTests_CRC16_CCITT of the check string */
+#define CRC16_CCITT_CHECK       (0x31C3U)
+
+/** \ref SelfTests_CRC32 of the check string */
+#define CRC32_CHECK             (0x8B120840UL)
+
+/** \ref SelfTests_CRC32_IEEE of the check string */
+#define CRC32_IEEE_CHECK        (0xCBF43926UL)
+
+/** \ref SelfTests_CRC32C of the check string */
+#define CRC32C_CHECK            (0xE3069283UL)
 /** \} group_crc_macros */
 
+/**
+ * \addtogroup group_crc_enums
+ * \{
+ */
+
+/** CRC variant for the combine functions */
+typedef enum
+{
+    STL_CRC_32       = 0u,  /**< \ref SelfTests_CRC32 */
+    STL_CRC_32_IEEE  = 1u,  /**< \ref SelfTests_CRC32_IEEE */
+    STL_CRC_32C      = 2u,  /**< \ref SelfTests_CRC32C */
+    STL_CRC_16_CCITT = 3u   /**< \ref SelfTests_CRC16_CCITT */
+} stl_crc_type_t;
+
+/** \} group_crc_enums */
+
+/**
+ * \addtogroup group_crc_data_structures
+ * \{
+ */
+
+/** Incremental CRC16 CCITT calculation context */
+typedef struct
+{
+    uint16_t crc;       /**< CRC of the data added so far */
+    uint32_t length;    /**< Number of bytes added so far */
+} stl_crc16_ctx_t;
+
+/** CRC of one segment for \ref SelfTests_CRC_CombineSegments */
+typedef struct
+{
+    uint32_t crc;       /**< CRC of the segment alone */
+    uint32_t length;    /**< Segment length in bytes */
+} stl_crc_segment_t;
+
+/** Operator that shifts a CRC over a fixed number of zero bytes, see \ref SelfTests_CRC_ShiftOp_Init */
+typedef struct
+{
+    stl_crc_type_t type;    /**< CRC variant */
+    uint32_t mat[32];       /**< GF(2) matrix, mat[i] is the image of register bit i */
+} stl_crc_shift_op_t;
+
+/** \} group_crc_data_structures */
+
 /**
  * \addtogroup group_crc_functions
  * \{
@@ -135,6 +232,124 @@ uint16_t SelfTests_CRC16_CCITT_ACC(uint16_t crc, uint32_t BaseAdress, uint16_t l
 *******************************************************************************/
 uint16_t SelfTests_CRC16_CCITT_Byte(uint16_t crc, uint8_t val);
 
+/*******************************************************************************
+* Function Name: SelfTests_CRC16_CCITT_Block
+****************************************************************************//**
+*
+* This function continues the CRC16 CCITT over the memory area defined in parameters
+* "BaseAdress" and "len". Unlike \ref SelfTests_CRC16_CCITT_ACC the length is not limited
+* to 64 KB, and aligned words are processed with slice-by-4 tables (see \ref CRC16_SLICES).
+*
+* \param crc
+* The current CRC, \ref CRC16_CCITT_INIT_VALUE for the first block.
+*
+* \param BaseAdress
+* The address from which to calculate the CRC.
+*
+* \param len
+* The length of the area for CRC calculation.
+*
+* \return
+* The calculated CRC value.
+*
+*
+*******************************************************************************/
+uint16_t SelfTests_CRC16_CCITT_Block(uint16_t crc, uint32_t BaseAdress, uint32_t len);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC16_CCITT_Init
+****************************************************************************//**
+*
+* This function starts an incremental CRC16 CCITT calculation.
+*
+* \param ctx
+* The calculation context.
+*
+*
+*******************************************************************************/
+void SelfTests_CRC16_CCITT_Init(stl_crc16_ctx_t* ctx);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC16_CCITT_Update
+****************************************************************************//**
+*
+* This function adds the memory area defined in parameters "BaseAdress" and "len" to an
+* incremental CRC16 CCITT calculation.
+*
+* \param ctx
+* The calculation context.
+*
+* \param BaseAdress
+* The address from which to calculate the CRC.
+*
+* \param len
+* The length of the area for CRC calculation.
+*
+*
+*******************************************************************************/
+void SelfTests_CRC16_CCITT_Update(stl_crc16_ctx_t* ctx, uint32_t BaseAdress, uint32_t len);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC16_CCITT_UpdateByte
+****************************************************************************//**
+*
+* This function adds one byte to an incremental CRC16 CCITT calculation.
+*
+* \param ctx
+* The calculation context.
+*
+* \param val
+* The value to add.
+*
+*
+*******************************************************************************/
+void SelfTests_CRC16_CCITT_UpdateByte(stl_crc16_ctx_t* ctx, uint8_t val);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC16_CCITT_UpdateEscaped
+****************************************************************************//**
+*
+* This function adds the memory area defined in parameters "BaseAdress" and "len" to an
+* incremental CRC16 CCITT calculation as it is sent with byte stuffing: each byte equal to
+* "mark" or "esc" is added as "esc" followed by the byte + 1. The runs between these bytes are
+* added with \ref SelfTests_CRC16_CCITT_Update.
+*
+* \param ctx
+* The calculation context.
+*
+* \param BaseAdress
+* The address from which to calculate the CRC.
+*
+* \param len
+* The length of the area for CRC calculation.
+*
+* \param mark
+* The frame marker byte, for example STX.
+*
+* \param esc
+* The escape byte.
+*
+*
+*******************************************************************************/
+void SelfTests_CRC16_CCITT_UpdateEscaped(stl_crc16_ctx_t* ctx, uint32_t BaseAdress, uint32_t len,
+                                         uint8_t mark, uint8_t esc);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC16_CCITT_Final
+****************************************************************************//**
+*
+* This function returns the CRC16 CCITT of all data added to the context.
+*
+* \param ctx
+* The calculation context.
+*
+* \return
+* The calculated CRC value.
+*
+*
+*******************************************************************************/
+uint16_t SelfTests_CRC16_CCITT_Final(const stl_crc16_ctx_t* ctx);
+
 /*******************************************************************************
 * Function Name: SelfTests_CRC32
 ****************************************************************************//**
@@ -197,6 +412,304 @@ uint32_t SelfTests_CRC32_ACC(uint32_t crc, uint32_t BaseAdress, uint32_t len);
 *******************************************************************************/
 uint32_t SelfTests_CRC32_Byte(uint32_t crc, uint8_t val);
 
+/*******************************************************************************
+* Function Name: SelfTests_CRC32_Combine
+****************************************************************************//**
+*
+* This function combines the CRCs of two adjacent memory areas A and B, each calculated by
+* \ref SelfTests_CRC32, into the CRC of the concatenated area A+B without reading the data again.
+*
+* \param crc1
+* The CRC of area A.
+*
+* \param crc2
+* The CRC of area B.
+*
+* \param len2
+* The length of area B in bytes.
+*
+* \return
+* The CRC of area A+B, equal to SelfTests_CRC32 over both areas.
+*
+*
+*******************************************************************************/
+uint32_t SelfTests_CRC32_Combine(uint32_t crc1, uint32_t crc2, uint32_t len2);
+
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC32_IEEE
+****************************************************************************//**
+*
+* This function calculates the standard CRC-32 (IEEE 802.3: reflected polynomial 0xEDB88320,
+* init and final XOR 0xFFFFFFFF) of the memory area defined in parameters "BaseAdress" and "len".
+* The result is equal to zlib crc32(0, data, len).
+*
+* \param BaseAdress
+* The address from which to calculate the CRC.
+*
+* \param len
+* The length of the area for CRC calculation.
+*
+* \return
+* The calculated CRC value.
+*
+*
+*******************************************************************************/
+uint32_t SelfTests_CRC32_IEEE(uint32_t BaseAdress, uint32_t len);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC32_IEEE_ACC
+****************************************************************************//**
+*
+* This function continues the standard CRC-32 over the memory area defined in parameters
+* "BaseAdress" and "len", as zlib crc32(crc, data, len).
+*
+* \param crc
+* The CRC of the preceding data, 0 for the first block.
+*
+* \param BaseAdress
+* The address from which to calculate the CRC.
+*
+* \param len
+* The length of the area for CRC calculation.
+*
+* \return
+* The calculated CRC value.
+*
+*
+*******************************************************************************/
+uint32_t SelfTests_CRC32_IEEE_ACC(uint32_t crc, uint32_t BaseAdress, uint32_t len);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC32C
+****************************************************************************//**
+*
+* This function calculates the CRC-32C (Castagnoli: reflected polynomial 0x82F63B78,
+* init and final XOR 0xFFFFFFFF) of the memory area defined in parameters "BaseAdress" and "len".
+*
+* \param BaseAdress
+* The address from which to calculate the CRC.
+*
+* \param len
+* The length of the area for CRC calculation.
+*
+* \return
+* The calculated CRC value.
+*
+*
+*******************************************************************************/
+uint32_t SelfTests_CRC32C(uint32_t BaseAdress, uint32_t len);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC32C_ACC
+****************************************************************************//**
+*
+* This function continues the CRC-32C over the memory area defined in parameters
+* "BaseAdress" and "len".
+*
+* \param crc
+* The CRC of the preceding data, 0 for the first block.
+*
+* \param BaseAdress
+* The address from which to calculate the CRC.
+*
+* \param len
+* The length of the area for CRC calculation.
+*
+* \return
+* The calculated CRC value.
+*
+*
+*******************************************************************************/
+uint32_t SelfTests_CRC32C_ACC(uint32_t crc, uint32_t BaseAdress, uint32_t len);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC32_IEEE_Combine
+****************************************************************************//**
+*
+* This function combines the standard CRC-32 of two adjacent memory areas A and B into the
+* CRC of the concatenated area A+B, as zlib crc32_combine().
+*
+* \param crc1
+* The CRC of area A.
+*
+* \param crc2
+* The CRC of area B.
+*
+* \param len2
+* The length of area B in bytes.
+*
+* \return
+* The CRC of area A+B, equal to \ref SelfTests_CRC32_IEEE over both areas.
+*
+*
+*******************************************************************************/
+uint32_t SelfTests_CRC32_IEEE_Combine(uint32_t crc1, uint32_t crc2, uint32_t len2);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC32C_Combine
+****************************************************************************//**
+*
+* This function combines the CRC-32C of two adjacent memory areas A and B into the CRC of the
+* concatenated area A+B.
+*
+* \param crc1
+* The CRC of area A.
+*
+* \param crc2
+* The CRC of area B.
+*
+* \param len2
+* The length of area B in bytes.
+*
+* \return
+* The CRC of area A+B, equal to \ref SelfTests_CRC32C over both areas.
+*
+*
+*******************************************************************************/
+uint32_t SelfTests_CRC32C_Combine(uint32_t crc1, uint32_t crc2, uint32_t len2);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC16_CCITT_Combine
+****************************************************************************//**
+*
+* This function combines the CRC16 CCITT of two adjacent memory areas A and B into the CRC of
+* the concatenated area A+B.
+*
+* \param crc1
+* The CRC of area A.
+*
+* \param crc2
+* The CRC of area B.
+*
+* \param len2
+* The length of area B in bytes.
+*
+* \return
+* The CRC of area A+B, equal to \ref SelfTests_CRC16_CCITT_Block over both areas.
+*
+*
+*******************************************************************************/
+uint16_t SelfTests_CRC16_CCITT_Combine(uint16_t crc1, uint16_t crc2, uint32_t len2);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC16_CCITT_Append
+****************************************************************************//**
+*
+* This function appends the data of context "next", calculated separately (both contexts
+* started by \ref SelfTests_CRC16_CCITT_Init), to context "ctx".
+*
+* \param ctx
+* The context of the first part, updated.
+*
+* \param next
+* The context of the following part.
+*
+*
+*******************************************************************************/
+void SelfTests_CRC16_CCITT_Append(stl_crc16_ctx_t* ctx, const stl_crc16_ctx_t* next);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC_CombineSegments
+****************************************************************************//**
+*
+* This function combines the CRCs of adjacent segments, each calculated separately from the
+* start value of the variant, into the CRC of the whole area.
+*
+* \param type
+* The CRC variant used for all segments.
+*
+* \param segments
+* The segments in address order.
+*
+* \param count
+* The number of segments.
+*
+* \return
+* The CRC of the whole area, equal to the sequential calculation.
+*
+*
+*******************************************************************************/
+uint32_t SelfTests_CRC_CombineSegments(stl_crc_type_t type, const stl_crc_segment_t* segments,
+                                       uint32_t count);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC_ShiftOp_Init
+****************************************************************************//**
+*
+* This function calculates the operator that shifts a CRC register over "len" zero bytes.
+* When many segments have the same length (for example Flash sectors), the operator is
+* calculated once and each segment is combined by \ref SelfTests_CRC_Combine_Op with one
+* matrix-vector product.
+*
+* \param op
+* The operator.
+*
+* \param type
+* The CRC variant.
+*
+* \param len
+* The segment length in bytes.
+*
+*
+*******************************************************************************/
+void SelfTests_CRC_ShiftOp_Init(stl_crc_shift_op_t* op, stl_crc_type_t type, uint32_t len);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC_Combine_Op
+****************************************************************************//**
+*
+* This function combines the CRC of an area A with the CRC of the following segment B, whose
+* length was passed to \ref SelfTests_CRC_ShiftOp_Init.
+*
+* \param op
+* The operator for the length of segment B.
+*
+* \param crc1
+* The CRC of area A.
+*
+* \param crc2
+* The CRC of segment B.
+*
+* \return
+* The CRC of area A+B.
+*
+*
+*******************************************************************************/
+uint32_t SelfTests_CRC_Combine_Op(const stl_crc_shift_op_t* op, uint32_t crc1, uint32_t crc2);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC_Check_Tables
+****************************************************************************//**
+*
+* This function compares a bitwise CRC-32C of every CRC lookup table with the value
+* calculated when the tables were generated.
+*
+* \return
+*  OK_STATUS    - All tables are intact. <br>
+*  ERROR_STATUS - At least one table is corrupted.
+*
+*
+*******************************************************************************/
+uint8_t SelfTests_CRC_Check_Tables(void);
+
+/*******************************************************************************
+* Function Name: SelfTests_CRC_KAT
+****************************************************************************//**
+*
+* This function runs the known-answer test of the CRC functions: the check string "123456789"
+* is processed by every CRC variant through the word-wise and byte-wise paths and compared with
+* the standard check values. Every STL_CRC_CFG_* configuration of the CRC engine is checked
+* the same way with \ref SelfTests_CRC_Engine_KAT, bit by bit and with a nibble table on the
+* stack. Then \ref SelfTests_CRC_Check_Tables is called.
+*
+* \return
+*  OK_STATUS    - The test passed. <br>
+*  ERROR_STATUS - A CRC result or a table hash is wrong.
+*
+*
+*******************************************************************************/
+uint8_t SelfTests_CRC_KAT(void);
 
 /** \} group_crc_functions */
 
@@ -37,11 +37,8 @@
 #include "cy_pdl.h"
 
 #include "SelfTest_Flash.h"
-#include "SelfTest_ErrorInjection.h"
-
-#if (FLASH_TEST_MODE == FLASH_TEST_CRC32)
 #include "SelfTest_CRC_calc.h"
-#endif
+#include "SelfTest_ErrorInjection.h"
 
 /***************************************
 * Initial Parameter Constants
@@ -63,38 +60,23 @@
 
 #endif /* if defined(CY_IP_M0S8CPUSSV3) */
 
-/* Check whether the init function was called or not*/
-static bool init_fxn_called = false;
-
-/* The pointer to the currently calculating Flash addr*/
-static uint32_t* flash_Pointer_FourBytes;
-
-/* Flash start addr*/
-static uint32_t flash_start_address;
-
-/* Flash end addr*/
-static uint32_t flash_end_address;
+/* Context used by SelfTest_Flash_init() and SelfTest_FlashCheckSum() */
+static stl_flash_context_t flash_DefaultContext;
 
 #if (FLASH_TEST_MODE == FLASH_TEST_FLETCHER64)
 /* Variable that stores the running checksum of the Flash */
 uint64_t flash_CheckSum = CHECKSUM_INIT_VALUE;
-static uint64_t sumA = CHECKSUM_INIT_VALUE;
-static uint32_t IterationCounter = ITER_COUNT_INIT_VALUE;
-/* Expected checksum*/
-static uint64_t expected_flash_shecksum = 0ULL;
-
-/***************************************
-* Local Function Prototypes
-***************************************/
-static void SelfTest_Fletcher64_CheckSum_Formula(uint32_t endAdress);
 
 #elif (FLASH_TEST_MODE == FLASH_TEST_CRC32)
 /* Variable that store the running CRC checksum of the Flash */
 uint32_t flash_CheckSum = CRC32_INIT_VALUE;
-/* Expected checksum*/
-static uint32_t expected_flash_shecksum = 0ULL;
 #endif /* FLASH_TEST_MODE == FLASH_TEST_CRC */
 
+/***************************************
+* Local Function Prototypes
+***************************************/
+static void SelfTest_Flash_Ctx_Restart(stl_flash_context_t* ctx);
+static void SelfTest_Fletcher64_CheckSum_Formula(stl_flash_context_t* ctx, uint32_t endAdress);
 
 
 /*******************************************************************************
@@ -120,16 +102,20 @@ static uint32_t expected_flash_shecksum = 0ULL;
 void SelfTest_Flash_init(uint32_t StartAddressOfFlash, uint32_t EndAddressOfFlash,
                          uint64_t flash_ExpectedCheckSum)
 {
-    flash_start_address = StartAddressOfFlash;
-    /* Set a pointer to access Flash memory to the start address */
-    flash_Pointer_FourBytes = (uint32_t*)flash_start_address;
-    flash_end_address = EndAddressOfFlash;
-    #if (FLASH_TEST_MODE == FLASH_TEST_FLETCHER64)
-    expected_flash_shecksum = flash_ExpectedCheckSum;
-    #elif (FLASH_TEST_MODE == FLASH_TEST_CRC32)
-    expected_flash_shecksum = (uint32_t)flash_ExpectedCheckSum;
-    #endif
-    init_fxn_called = true;
+    /* Keep the deadline configuration across re-initialization */
+    stl_flash_context_t* ctx = &flash_DefaultContext;
+    bool deadlineConfigured = ctx->deadlineConfigured;
+    uint32_t passTimeMs = ctx->deadlinePassTimeMs;
+    uint32_t callPeriodMs = ctx->deadlineCallPeriodMs;
+    uint32_t maxWordsPerCall = ctx->deadlineMaxWordsPerCall;
+
+    SelfTest_Flash_Ctx_Init(ctx, (stl_flash_algo_t)FLASH_TEST_MODE, StartAddressOfFlash,
+                            EndAddressOfFlash, flash_ExpectedCheckSum);
+
+    if (deadlineConfigured == true)
+    {
+        SelfTest_Flash_Ctx_SetDeadline(ctx, passTimeMs, callPeriodMs, maxWordsPerCall);
+    }
 }
 
 
@@ -153,7 +139,178 @@ void SelfTest_Flash_init(uint32_t StartAddressOfFlash, uint32_t EndAddressOfFlas
 
 uint8_t SelfTest_FlashCheckSum(uint32_t DoubleWordsToTest)
 {
-    if (init_fxn_called == false)
+    uint8_t ret = SelfTest_Flash_Ctx_CheckSum(&flash_DefaultContext, DoubleWordsToTest);
+
+    #if (FLASH_TEST_MODE == FLASH_TEST_FLETCHER64)
+    flash_CheckSum = flash_DefaultContext.checkSum;
+    #elif (FLASH_TEST_MODE == FLASH_TEST_CRC32)
+    flash_CheckSum = (uint32_t)flash_DefaultContext.checkSum;
+    #endif
+
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Flash_SetDeadline()
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function configures the deadline-driven mode of the Flash test.
+ *
+ * Parameters:
+ *  uint32_t passTimeMs - The time budget for one full pass over Flash in ms.
+ *  uint32_t callPeriodMs - The nominal call period in ms.
+ *  uint32_t maxWordsPerCall - The upper limit of words per call, 0 - default.
+ *
+ * Return:
+ *  None
+ *
+ ******************************************************************************/
+void SelfTest_Flash_SetDeadline(uint32_t passTimeMs, uint32_t callPeriodMs, uint32_t maxWordsPerCall)
+{
+    SelfTest_Flash_Ctx_SetDeadline(&flash_DefaultContext, passTimeMs, callPeriodMs, maxWordsPerCall);
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_FlashCheckSum_Deadline()
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function continues the deadline-driven Flash test.
+ *
+ * Parameters:
+ *  uint32_t timeStampMs - Free-running millisecond time stamp.
+ *
+ * Return:
+ *  Result of test:   "1" - fail test; "2" - Test in progress;
+ *   "3" - Test completed OK;
+ *
+ ******************************************************************************/
+uint8_t SelfTest_FlashCheckSum_Deadline(uint32_t timeStampMs)
+{
+    uint8_t ret = SelfTest_Flash_Ctx_CheckSum_Deadline(&flash_DefaultContext, timeStampMs);
+
+    #if (FLASH_TEST_MODE == FLASH_TEST_FLETCHER64)
+    flash_CheckSum = flash_DefaultContext.checkSum;
+    #elif (FLASH_TEST_MODE == FLASH_TEST_CRC32)
+    flash_CheckSum = (uint32_t)flash_DefaultContext.checkSum;
+    #endif
+
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Flash_GetDeadlineStatus()
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function returns the progress of the deadline-driven Flash test.
+ *
+ * Parameters:
+ *  stl_flash_deadline_status_t* status - The structure to fill.
+ *
+ * Return:
+ *  None
+ *
+ ******************************************************************************/
+void SelfTest_Flash_GetDeadlineStatus(stl_flash_deadline_status_t* status)
+{
+    *status = flash_DefaultContext.deadlineStatus;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Flash_Ctx_Init()
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function initializes a Flash test context.
+ *
+ * Parameters:
+ *  stl_flash_context_t* ctx - The context to initialize.
+ *  stl_flash_algo_t algo - The checksum algorithm.
+ *  uint32_t StartAddressOfFlash - The start address of the range.
+ *  uint32_t EndAddressOfFlash - The end address of the range.
+ *  uint64_t flash_ExpectedCheckSum - The expected checksum.
+ *
+ * Return:
+ *  None
+ *
+ ******************************************************************************/
+void SelfTest_Flash_Ctx_Init(stl_flash_context_t* ctx, stl_flash_algo_t algo,
+                             uint32_t StartAddressOfFlash, uint32_t EndAddressOfFlash,
+                             uint64_t flash_ExpectedCheckSum)
+{
+    ctx->algo = algo;
+    ctx->startAddress = StartAddressOfFlash;
+    ctx->endAddress = EndAddressOfFlash;
+    ctx->expectedCheckSum = (algo == STL_FLASH_CRC32) ?
+                            (uint64_t)(uint32_t)flash_ExpectedCheckSum : flash_ExpectedCheckSum;
+    SelfTest_Flash_Ctx_Restart(ctx);
+
+    ctx->deadlineConfigured = false;
+    ctx->deadlineNewPass = true;
+    ctx->deadlineLastPassLate = false;
+    ctx->initialized = true;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Flash_Ctx_Restart()
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function sets the context to the start of the range and sets the init
+ *  values for the checksum calculation.
+ *
+ * Parameters:
+ *  stl_flash_context_t* ctx - The context.
+ *
+ * Return:
+ *  None
+ *
+ ******************************************************************************/
+static void SelfTest_Flash_Ctx_Restart(stl_flash_context_t* ctx)
+{
+    /* Set a pointer to access Flash memory to the start address */
+    ctx->currentAddress = ctx->startAddress;
+
+    if (ctx->algo == STL_FLASH_CRC32)
+    {
+        ctx->checkSum = CRC32_INIT_VALUE;
+    }
+    else
+    {
+        ctx->checkSum = CHECKSUM_INIT_VALUE;
+        ctx->sumA = CHECKSUM_INIT_VALUE;
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Flash_Ctx_CheckSum()
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function checks for data corruption in the range of a Flash test context
+ *  using the checksum calculation.
+ *
+ * Parameters:
+ *  stl_flash_context_t* ctx - The context.
+ *  uint32 DoubleWordsToTest - The number of 32-bit Double Words of Flash to
+ *  calculate per each function call.
+ *
+ * Return:
+ *  Result of test:   "1" - fail test; "2" - Test in progress;
+ *   "3" - Test completed OK;
+ *
+ ******************************************************************************/
+uint8_t SelfTest_Flash_Ctx_CheckSum(stl_flash_context_t* ctx, uint32_t DoubleWordsToTest)
+{
+    if (ctx->initialized == false)
     {
         return ERROR_STATUS;
     }
@@ -176,33 +333,18 @@ uint8_t SelfTest_FlashCheckSum(uint32_t DoubleWordsToTest)
     #endif
 
     /* Check if we are in the last permitted byte of Flash */
-    if ((uint32_t)flash_Pointer_FourBytes == flash_end_address)
+    if (ctx->currentAddress == ctx->endAddress)
     {
-        /* Set a pointer to access Flash memory to the start address */
-        flash_Pointer_FourBytes = (uint32_t*)flash_start_address;
-
-
-        #if (FLASH_TEST_MODE == FLASH_TEST_FLETCHER64)
-        /* Set init values for Iteration Counter in Fletcher64 Checksum algorithm */
-        IterationCounter = ITER_COUNT_INIT_VALUE;
-
-        /* Set init values for the checksum calculation */
-
-        flash_CheckSum = CHECKSUM_INIT_VALUE;
-        sumA = CHECKSUM_INIT_VALUE;
-        #elif (FLASH_TEST_MODE == FLASH_TEST_CRC32)
-        flash_CheckSum = CRC32_INIT_VALUE;
-        #endif
+        SelfTest_Flash_Ctx_Restart(ctx);
     }
 
     /* Calculate the end address of the current tested block. */
-    endAdressOfTest =
-        (uint32_t)((uint32_t)flash_Pointer_FourBytes + (DoubleWordsToTest * sizeof(uint32_t)));
+    endAdressOfTest = ctx->currentAddress + (DoubleWordsToTest * sizeof(uint32_t));
 
     /* Check if Flash byte address is in the Flash range */
-    if (endAdressOfTest > flash_end_address)
+    if (endAdressOfTest > ctx->endAddress)
     {
-        endAdressOfTest = flash_end_address;
+        endAdressOfTest = ctx->endAddress;
     }
 
     #if defined(CY_IP_M0S8CPUSSV3)
@@ -221,14 +363,17 @@ uint8_t SelfTest_FlashCheckSum(uint32_t DoubleWordsToTest)
     REG_CPUSS_SYSREQ_REG = REG_MEM_MAP_VECTOR;
     #endif /* if defined(CY_IP_M0S8CPUSSV3) */
 
-    #if (FLASH_TEST_MODE == FLASH_TEST_FLETCHER64)
-    /* Calculates the checksum for all bytes in Flash block */
-    SelfTest_Fletcher64_CheckSum_Formula(endAdressOfTest);
-    #elif (FLASH_TEST_MODE == FLASH_TEST_CRC32)
-    flash_CheckSum = SelfTests_CRC32_ACC(flash_CheckSum, (uint32_t)flash_Pointer_FourBytes,
-                                         endAdressOfTest - (uint32_t)flash_Pointer_FourBytes);
-    flash_Pointer_FourBytes = (uint32_t*)endAdressOfTest;
-    #endif
+    if (ctx->algo == STL_FLASH_CRC32)
+    {
+        ctx->checkSum = SelfTests_CRC32_ACC((uint32_t)ctx->checkSum, ctx->currentAddress,
+                                            endAdressOfTest - ctx->currentAddress);
+        ctx->currentAddress = endAdressOfTest;
+    }
+    else
+    {
+        /* Calculates the checksum for all bytes in Flash block */
+        SelfTest_Fletcher64_CheckSum_Formula(ctx, endAdressOfTest);
+    }
 
     #if defined(CY_IP_M0S8CPUSSV3)
     /* Restore CPU registers */
@@ -241,16 +386,16 @@ uint8_t SelfTest_FlashCheckSum(uint32_t DoubleWordsToTest)
     #endif
 
     /* Check if we are in the last permitted byte of Flash */
-    if ((uint32_t)flash_Pointer_FourBytes == flash_end_address)
+    if (ctx->currentAddress == ctx->endAddress)
     {
         #if (ERROR_IN_FLASH == 1)
 
         /* Compare the stored check sum and calculated check sum */
-        if (flash_CheckSum == (expected_flash_shecksum + 1))
+        if (ctx->checkSum == (ctx->expectedCheckSum + 1u))
         #else
 
         /* Compare the stored check sum and calculated check sum */
-        if (flash_CheckSum == expected_flash_shecksum)
+        if (ctx->checkSum == ctx->expectedCheckSum)
         #endif /* End ERROR_IN_FLASH */
         {
             /* Test passed */
@@ -267,6 +412,436 @@ uint8_t SelfTest_FlashCheckSum(uint32_t DoubleWordsToTest)
 }
 
 
+/*******************************************************************************
+ * Function Name: SelfTest_Flash_Ctx_SetDeadline()
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function configures the deadline-driven mode of a Flash test context.
+ *
+ * Parameters:
+ *  stl_flash_context_t* ctx - The context.
+ *  uint32_t passTimeMs - The time budget for one full pass over Flash in ms.
+ *  uint32_t callPeriodMs - The nominal call period in ms.
+ *  uint32_t maxWordsPerCall - The upper limit of words per call, 0 - default.
+ *
+ * Return:
+ *  None
+ *
+ ******************************************************************************/
+void SelfTest_Flash_Ctx_SetDeadline(stl_flash_context_t* ctx, uint32_t passTimeMs,
+                                    uint32_t callPeriodMs, uint32_t maxWordsPerCall)
+{
+    ctx->deadlinePassTimeMs = passTimeMs;
+    ctx->deadlineMaxWordsPerCall = maxWordsPerCall;
+    ctx->deadlineCallPeriodMs = (callPeriodMs != 0u) ? callPeriodMs : 1u;
+
+    ctx->deadlineStatus.chunkWords = 0u;
+    ctx->deadlineStatus.wordsPerMs = 0u;
+    ctx->deadlineStatus.elapsedMs = 0u;
+    ctx->deadlineStatus.slackMs = (int32_t)passTimeMs;
+    ctx->deadlineStatus.lastPassMs = 0u;
+    ctx->deadlineStatus.deadlineAtRisk = false;
+
+    ctx->deadlineLastPassLate = false;
+    ctx->deadlineNewPass = true;
+    ctx->deadlineConfigured = true;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Flash_Ctx_CheckSum_Deadline()
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function calls SelfTest_Flash_Ctx_CheckSum() with the number of words
+ *  that tests the rest of the current pass within the time budget at the
+ *  measured throughput, limited to the words per call.
+ *
+ * Parameters:
+ *  stl_flash_context_t* ctx - The context.
+ *  uint32_t timeStampMs - Free-running millisecond time stamp.
+ *
+ * Return:
+ *  Result of test:   "1" - fail test; "2" - Test in progress;
+ *   "3" - Test completed OK;
+ *
+ ******************************************************************************/
+uint8_t SelfTest_Flash_Ctx_CheckSum_Deadline(stl_flash_context_t* ctx, uint32_t timeStampMs)
+{
+    stl_flash_deadline_status_t* status = &ctx->deadlineStatus;
+    uint32_t position;
+    uint32_t wordsDone;
+    uint32_t remainingWords;
+    uint32_t remainingMs;
+    uint32_t maxWords;
+    uint32_t callsLeft;
+    uint32_t chunk;
+    uint64_t words;
+    uint64_t afterMs;
+    bool measured;
+    uint8_t ret;
+
+    if ((ctx->initialized == false) || (ctx->deadlineConfigured == false))
+    {
+        return ERROR_STATUS;
+    }
+
+    if (ctx->deadlineNewPass == true)
+    {
+        /* Restart the scan so the pass is timed from its first word */
+        ctx->currentAddress = ctx->endAddress;
+        ctx->deadlinePassStartMs = timeStampMs;
+        ctx->deadlinePassCalls = 0u;
+        ctx->deadlineNewPass = false;
+    }
+
+    /* SelfTest_Flash_Ctx_CheckSum() restarts from the start address when at the end */
+    position = (ctx->currentAddress == ctx->endAddress) ? ctx->startAddress : ctx->currentAddress;
+    wordsDone = (position - ctx->startAddress) / sizeof(uint32_t);
+    remainingWords = (ctx->endAddress - position) / sizeof(uint32_t);
+
+    status->elapsedMs = timeStampMs - ctx->deadlinePassStartMs;
+    remainingMs = (status->elapsedMs < ctx->deadlinePassTimeMs) ?
+                  (ctx->deadlinePassTimeMs - status->elapsedMs) : 0u;
+
+    maxWords = (ctx->deadlineMaxWordsPerCall != 0u) ? ctx->deadlineMaxWordsPerCall :
+               FLASH_DEADLINE_MAX_WORDS_PER_CALL;
+
+    measured = (wordsDone != 0u) && (status->elapsedMs != 0u) && (ctx->deadlinePassCalls != 0u);
+    if (measured == false)
+    {
+        /* No throughput measured yet: spread the words over the calls at the nominal period */
+        status->wordsPerMs = 0u;
+        callsLeft = remainingMs / ctx->deadlineCallPeriodMs;
+        words = (callsLeft != 0u) ? ((remainingWords + (callsLeft - 1u)) / callsLeft) : maxWords;
+    }
+    else
+    {
+        status->wordsPerMs = wordsDone / status->elapsedMs;
+        if (remainingMs == 0u)
+        {
+            words = maxWords;
+        }
+        else
+        {
+            /* The throughput needed for the rest of the pass, remainingWords / remainingMs, over
+             * the measured throughput, wordsDone / elapsedMs, scales the average block of the
+             * pass, wordsDone / deadlinePassCalls */
+            words = (((uint64_t)remainingWords * status->elapsedMs) + (remainingMs - 1u)) /
+                    remainingMs;
+            words = (words + (ctx->deadlinePassCalls - 1u)) / ctx->deadlinePassCalls;
+        }
+    }
+
+    chunk = (words < maxWords) ? (uint32_t)words : maxWords;
+    if (chunk > remainingWords)
+    {
+        chunk = remainingWords;
+    }
+    if (chunk == 0u)
+    {
+        chunk = 1u;
+    }
+    status->chunkWords = chunk;
+
+    /* Projected completion time of this pass: the blocks after this one, each taking the
+     * measured time per block, or the nominal call period before it is measured */
+    words = (remainingWords > chunk) ? (((remainingWords - chunk) + (chunk - 1u)) / chunk) : 0u;
+    afterMs = (measured == false) ? (words * ctx->deadlineCallPeriodMs) :
+              ((words * status->elapsedMs) / ctx->deadlinePassCalls);
+    afterMs += status->elapsedMs;
+    status->slackMs = (afterMs > (uint64_t)INT32_MAX) ? INT32_MIN :
+                      ((int32_t)ctx->deadlinePassTimeMs - (int32_t)afterMs);
+    ctx->deadlinePassCalls++;
+
+    ret = SelfTest_Flash_Ctx_CheckSum(ctx, chunk);
+
+    if (ret != PASS_STILL_TESTING_STATUS)
+    {
+        status->lastPassMs = status->elapsedMs;
+        ctx->deadlineLastPassLate = (status->elapsedMs > ctx->deadlinePassTimeMs);
+        ctx->deadlineNewPass = true;
+    }
+    status->deadlineAtRisk = (status->slackMs < 0) || ctx->deadlineLastPassLate;
+
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Flash_Sector_Init()
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function initializes a sector checksum table context.
+ *
+ * Parameters:
+ *  stl_flash_sector_ctx_t* ctx - The context to initialize.
+ *  uint32_t StartAddressOfFlash - The start address of the first sector.
+ *  uint32_t sectorSize - The size of one sector in bytes.
+ *  uint32_t sectorCount - The number of sectors.
+ *  const uint32_t* refCrc - The reference CRC table.
+ *  uint32_t* dirtyMap - The re-validation bit map buffer.
+ *
+ * Return:
+ *  None
+ *
+ ******************************************************************************/
+void SelfTest_Flash_Sector_Init(stl_flash_sector_ctx_t* ctx, uint32_t StartAddressOfFlash,
+                                uint32_t sectorSize, uint32_t sectorCount,
+                                const uint32_t* refCrc, uint32_t* dirtyMap)
+{
+    ctx->startAddress = StartAddressOfFlash;
+    ctx->sectorSize = sectorSize;
+    ctx->sectorCount = sectorCount;
+    ctx->refCrc = refCrc;
+    ctx->dirtyMap = dirtyMap;
+    ctx->nextSector = 0u;
+    ctx->failedSector = 0u;
+
+    for (uint32_t i = 0u; i < FLASH_SECTOR_MAP_WORDS(sectorCount); i++)
+    {
+        dirtyMap[i] = 0u;
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Flash_Sector_MarkDirty()
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function marks the sectors overlapping an area for re-validation.
+ *
+ * Parameters:
+ *  stl_flash_sector_ctx_t* ctx - The context.
+ *  uint32_t address - The start address of the written area.
+ *  uint32_t size - The size of the written area in bytes.
+ *
+ * Return:
+ *  None
+ *
+ ******************************************************************************/
+void SelfTest_Flash_Sector_MarkDirty(stl_flash_sector_ctx_t* ctx, uint32_t address, uint32_t size)
+{
+    uint32_t first;
+    uint32_t last;
+    uint32_t endAddress = ctx->startAddress + (ctx->sectorSize * ctx->sectorCount);
+
+    /* Ignore the part of the area outside of the table */
+    if ((size == 0u) || (address >= endAddress) || ((address + size) <= ctx->startAddress))
+    {
+        return;
+    }
+
+    first = (address > ctx->startAddress) ? ((address - ctx->startAddress) / ctx->sectorSize) : 0u;
+    last = (((address + size) < endAddress) ? ((address + size) - ctx->startAddress) :
+            (endAddress - ctx->startAddress)) - 1u;
+    last /= ctx->sectorSize;
+
+    for (uint32_t sector = first; sector <= last; sector++)
+    {
+        ctx->dirtyMap[sector / 32u] |= (uint32_t)1u << (sector % 32u);
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Flash_Sector_Revalidate()
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function checks up to sectorsToTest marked sectors against the
+ *  reference CRC table, round-robin from the last position.
+ *
+ * Parameters:
+ *  stl_flash_sector_ctx_t* ctx - The context.
+ *  uint32_t sectorsToTest - The maximum number of sectors per call.
+ *
+ * Return:
+ *  Result of test:   "1" - fail test; "2" - Test in progress;
+ *   "3" - Test completed OK;
+ *
+ ******************************************************************************/
+uint8_t SelfTest_Flash_Sector_Revalidate(stl_flash_sector_ctx_t* ctx, uint32_t sectorsToTest)
+{
+    uint32_t tested = 0u;
+    uint32_t visited = 0u;
+    uint32_t sector = ctx->nextSector;
+    uint32_t crc;
+
+    while ((visited < ctx->sectorCount) && (tested < sectorsToTest))
+    {
+        uint32_t mask = (uint32_t)1u << (sector % 32u);
+
+        if ((ctx->dirtyMap[sector / 32u] & mask) != 0u)
+        {
+            crc = SelfTests_CRC32(ctx->startAddress + (sector * ctx->sectorSize), ctx->sectorSize);
+
+            #if (ERROR_IN_FLASH == 1)
+            crc++;
+            #endif /* End ERROR_IN_FLASH */
+
+            if (crc != ctx->refCrc[sector])
+            {
+                /* Keep the sector marked, so it is checked again */
+                ctx->failedSector = sector;
+                ctx->nextSector = sector;
+                return ERROR_STATUS;
+            }
+            ctx->dirtyMap[sector / 32u] &= ~mask;
+            tested++;
+        }
+
+        sector = ((sector + 1u) < ctx->sectorCount) ? (sector + 1u) : 0u;
+        visited++;
+    }
+    ctx->nextSector = sector;
+
+    /* Any sector still marked? */
+    for (uint32_t i = 0u; i < FLASH_SECTOR_MAP_WORDS(ctx->sectorCount); i++)
+    {
+        if (ctx->dirtyMap[i] != 0u)
+        {
+            return PASS_STILL_TESTING_STATUS;
+        }
+    }
+    return PASS_COMPLETE_STATUS;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Flash_Sector_ImageCrc()
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function combines the reference CRC table into the CRC of the whole
+ *  range. Only the table is read.
+ *
+ * Parameters:
+ *  const stl_flash_sector_ctx_t* ctx - The context.
+ *
+ * Return:
+ *  uint32_t - The CRC of the whole range.
+ *
+ ******************************************************************************/
+uint32_t SelfTest_Flash_Sector_ImageCrc(const stl_flash_sector_ctx_t* ctx)
+{
+    stl_crc_shift_op_t shiftOp;
+
+    /* CRC of an empty area is the init value */
+    uint32_t crc = CRC32_INIT_VALUE;
+
+    /* All sectors have the same size, so the shift operator is calculated once */
+    SelfTests_CRC_ShiftOp_Init(&shiftOp, STL_CRC_32, ctx->sectorSize);
+    for (uint32_t sector = 0u; sector < ctx->sectorCount; sector++)
+    {
+        crc = SelfTests_CRC_Combine_Op(&shiftOp, crc, ctx->refCrc[sector]);
+    }
+    return crc;
+}
+
+
+#if defined(CY_IP_MXSMIF)
+/*******************************************************************************
+ * Function Name: SelfTest_Flash_Xip_Init()
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function initializes a Flash test context for memory-mapped external Flash.
+ *
+ * Parameters:
+ *  stl_flash_context_t* ctx - The context to initialize.
+ *  const stl_flash_xip_cfg_t* cfg - The XIP scan configuration.
+ *  stl_flash_algo_t algo - The checksum algorithm.
+ *  uint32_t StartAddressOfFlash - The start address of the range.
+ *  uint32_t EndAddressOfFlash - The end address of the range.
+ *  uint64_t flash_ExpectedCheckSum - The expected checksum.
+ *
+ * Return:
+ *  "0" - Context initialized; "1" - Range or line size not valid
+ *
+ ******************************************************************************/
+uint8_t SelfTest_Flash_Xip_Init(stl_flash_context_t* ctx, const stl_flash_xip_cfg_t* cfg,
+                                stl_flash_algo_t algo, uint32_t StartAddressOfFlash,
+                                uint32_t EndAddressOfFlash, uint64_t flash_ExpectedCheckSum)
+{
+    uint32_t lineMask = cfg->lineSize - 1u;
+
+    ctx->initialized = false;
+
+    /* Line size must be a power of two of at least one word, range aligned to it */
+    if ((cfg->lineSize < sizeof(uint32_t)) || ((cfg->lineSize & lineMask) != 0u) ||
+        ((StartAddressOfFlash & lineMask) != 0u) || ((EndAddressOfFlash & lineMask) != 0u) ||
+        (EndAddressOfFlash < StartAddressOfFlash))
+    {
+        return ERROR_STATUS;
+    }
+
+    SelfTest_Flash_Ctx_Init(ctx, algo, StartAddressOfFlash, EndAddressOfFlash, flash_ExpectedCheckSum);
+
+    return OK_STATUS;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Flash_Xip_CheckSum()
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function invalidates the caches for the next block of whole lines, if
+ *  configured, and calculates the checksum of the block.
+ *
+ * Parameters:
+ *  stl_flash_context_t* ctx - The context.
+ *  const stl_flash_xip_cfg_t* cfg - The XIP scan configuration.
+ *  uint32_t LinesToTest - The number of lines to test per call.
+ *
+ * Return:
+ *  Result of test:   "1" - fail test; "2" - Test in progress;
+ *   "3" - Test completed OK;
+ *
+ ******************************************************************************/
+uint8_t SelfTest_Flash_Xip_CheckSum(stl_flash_context_t* ctx, const stl_flash_xip_cfg_t* cfg,
+                                    uint32_t LinesToTest)
+{
+    uint32_t blockStart;
+    uint32_t blockSize;
+
+    if (ctx->initialized == false)
+    {
+        return ERROR_STATUS;
+    }
+
+    /* SelfTest_Flash_Ctx_CheckSum() restarts from the start address when at the end */
+    blockStart = (ctx->currentAddress == ctx->endAddress) ? ctx->startAddress : ctx->currentAddress;
+    blockSize = LinesToTest * cfg->lineSize;
+    if (blockSize > (ctx->endAddress - blockStart))
+    {
+        blockSize = ctx->endAddress - blockStart;
+    }
+
+    if (cfg->invalidateCache == true)
+    {
+        #if defined(SELFTEST_PSOC6_FAMILY)
+        if (cfg->base != NULL)
+        {
+            /* The SMIF cache has no per-line invalidation */
+            (void)Cy_SMIF_CacheInvalidate(cfg->base, CY_SMIF_CACHE_BOTH);
+        }
+        #endif
+        #if (CY_CPU_CORTEX_M7) && defined (ENABLE_CM7_DATA_CACHE)
+        SCB_InvalidateDCache_by_Addr((void*)blockStart, (int32_t)blockSize);
+        #endif
+    }
+
+    return SelfTest_Flash_Ctx_CheckSum(ctx, blockSize / sizeof(uint32_t));
+}
+
+
+#endif /* if defined(CY_IP_MXSMIF) */
+
 /*******************************************************************************
  * Function Name: SelfTest_Fletcher64_CheckSum_Formula()
  *******************************************************************************
@@ -291,22 +866,20 @@ uint8_t SelfTest_FlashCheckSum(uint32_t DoubleWordsToTest)
  *
  *
  * Parameters:
+ *  stl_flash_context_t* ctx - The context. currentAddress is the current byte of
+ *  Flash, sumA the Fletcher64 A variable and checkSum the Fletcher64 B variable.
  *  uint32_t endAdress - The number of the last byte for the block checksum calculation.
  *
- * Global Variables Used:
- *  uint32_t *flash_Pointer_FourBytes - The pointer to the current byte of Flash.
- *  sumA - Fletcher64 A variable.
- *  flash_CheckSum - Fletcher64 B variable.
- *  IterationCounter - Byte N counter for Fletcher64.
- *
  * Return:
  *  No
  *
  ******************************************************************************/
-#if (FLASH_TEST_MODE == FLASH_TEST_FLETCHER64)
-static void SelfTest_Fletcher64_CheckSum_Formula(uint32_t endAdress)
+static void SelfTest_Fletcher64_CheckSum_Formula(stl_flash_context_t* ctx, uint32_t endAdress)
 {
-    uint32_t doubleWords = ((endAdress - (uint32_t)flash_Pointer_FourBytes) / sizeof(uint32_t));
+    const uint32_t* flash_Pointer_FourBytes = (const uint32_t*)ctx->currentAddress;
+    uint64_t sumA = ctx->sumA;
+    uint64_t sumB = ctx->checkSum;
+    uint32_t doubleWords = ((endAdress - ctx->currentAddress) / sizeof(uint32_t));
     uint32_t tlen;
 
     /* Calculate Fletcher64 Checksum for Flash Block with size doubleWords. */
@@ -325,33 +898,34 @@ static void SelfTest_Fletcher64_CheckSum_Formula(uint32_t endAdress)
             sumA = sumA + *flash_Pointer_FourBytes;
 
             /* B = B + A */
-            flash_CheckSum = flash_CheckSum + sumA;
+            sumB = sumB + sumA;
 
-            /* Increase Fletcher64 Iteration Counter */
-            /* and the pointer to Flash current byte (+4 bytes because DoubleWord) */
-            IterationCounter++;
+            /* Increase the pointer to Flash current byte (+4 bytes because DoubleWord) */
             flash_Pointer_FourBytes++;
             --tlen;
         } while (tlen != 0u);
 
         /* First reduction step to 32 bits */
         sumA = (sumA & 0xFFFFFFFFu) + (sumA >> 32);
-        flash_CheckSum = (flash_CheckSum & 0xFFFFFFFFu) + (flash_CheckSum >> 32);
+        sumB = (sumB & 0xFFFFFFFFu) + (sumB >> 32);
     }
 
+    ctx->currentAddress = (uint32_t)flash_Pointer_FourBytes;
+
     /* If end of Flash summarize Checksum */
-    if ((uint32_t)flash_Pointer_FourBytes == flash_end_address)
+    if (ctx->currentAddress == ctx->endAddress)
     {
         /* Second reduction step to 32 bits */
         sumA = (sumA & 0xFFFFFFFFu) + (sumA >> 32);
-        flash_CheckSum = (flash_CheckSum & 0xFFFFFFFFu) + (flash_CheckSum >> 32);
+        sumB = (sumB & 0xFFFFFFFFu) + (sumB >> 32);
 
         /* Summarize Checksum and store to 64 bits */
-        flash_CheckSum = (flash_CheckSum << 32) | sumA;
+        sumB = (sumB << 32) | sumA;
     }
-}
 
+    ctx->sumA = sumA;
+    ctx->checkSum = sumB;
+}
 
-#endif /* if (FLASH_TEST_MODE == FLASH_TEST_FLETCHER64) */
 
 /* [] END OF FILE */
@@ -53,7 +53,48 @@
  * checksum can also be stored in SFLASH, EEPROM, or any other external Flash.
  *
  *
+ * \section group_flash_deadline Deadline-driven mode
+ *
+ * Instead of a fixed DoubleWordsToTest, \ref SelfTest_FlashCheckSum_Deadline derives the block
+ * size from the time budget for a full pass (for example the fault tolerant time interval) and the
+ * measured throughput, the words tested per ms since the start of the pass. On each call the
+ * block is scaled by the ratio of the rate needed to test the remaining words in the remaining
+ * time to the measured rate, so the block size follows changes in image size and call rate. The
+ * first block of a pass is calculated from the nominal call period. A block never exceeds
+ * maxWordsPerCall, or \ref FLASH_DEADLINE_MAX_WORDS_PER_CALL if no limit is configured, also
+ * when the deadline has passed. \ref SelfTest_Flash_GetDeadlineStatus reports the projected
+ * slack and whether the deadline is at risk.
+ *
+ * \section group_flash_context Context-based API
+ *
+ * The SelfTest_Flash_Ctx_* functions keep the complete scan state in a \ref stl_flash_context_t
+ * provided by the application. Several ranges, for example internal Flash, Work Flash and
+ * memory-mapped external Flash, can then be tested at the same time, each with its own algorithm
+ * and call rate. \ref SelfTest_Flash_init, \ref SelfTest_FlashCheckSum and the deadline-driven
+ * functions operate on an internal context with the algorithm selected by FLASH_TEST_MODE.
+ *
+ * \section group_flash_xip External memory-mapped Flash
+ *
+ * On devices with SMIF, \ref SelfTest_Flash_Xip_CheckSum scans external QSPI Flash through the
+ * XIP window using the same checksum kernels. The block tested per call is a multiple of
+ * \ref FLASH_XIP_LINE_SIZE bytes, so each cache line is fetched once and completely used. With
+ * invalidation enabled, the SMIF cache (and on CM7 the data cache) is invalidated before each
+ * block, so the test reads the device rather than stale cache content.
+ *
+ * \section group_flash_sector Sector checksum table
+ *
+ * For incremental re-validation after a partial update (for example OTA), a table with one
+ * \ref SelfTests_CRC32 value per Flash sector is stored in a reserved area. After sectors are
+ * written, \ref SelfTest_Flash_Sector_MarkDirty records them and
+ * \ref SelfTest_Flash_Sector_Revalidate checks only those sectors against the table. The CRC of
+ * the whole range is then obtained by \ref SelfTest_Flash_Sector_ImageCrc from the table with
+ * \ref SelfTests_CRC_Combine_Op, without reading unchanged sectors. It equals the
+ * \ref STL_FLASH_CRC32 checksum of the range and can be passed as the expected checksum to
+ * \ref SelfTest_Flash_Ctx_Init.
+ *
  * \defgroup group_flash_macros Macros
+ * \defgroup group_flash_enums Enumerated Types
+ * \defgroup group_flash_structure Data structure
  * \defgroup group_flash_functions Functions
  */
 
@@ -77,8 +118,102 @@
  *  Flash  <br> 2) FLASH_TEST_CRC - Performs a CRC calculation on Flash  */
 #define FLASH_TEST_MODE            (FLASH_TEST_FLETCHER64)
 
+#if !defined(FLASH_DEADLINE_MAX_WORDS_PER_CALL)
+/** Words tested per call of the deadline-driven mode when maxWordsPerCall is 0, may be defined
+ *  by the application */
+#define FLASH_DEADLINE_MAX_WORDS_PER_CALL   (1024u)
+#endif
+
 /** \} group_flash_macros */
 
+/***************************************
+* Enumerations
+***************************************/
+/**
+ * \addtogroup group_flash_enums
+ * \{
+ */
+/** Checksum algorithm of a Flash test context */
+typedef enum
+{
+    STL_FLASH_FLETCHER64 = 0, /**< Fletcher 64-bit checksum */
+    STL_FLASH_CRC32      = 1  /**< CRC-32, as calculated by \ref SelfTests_CRC32_ACC */
+} stl_flash_algo_t;
+
+/** \} group_flash_enums */
+
+/***************************************
+* Data Structure
+***************************************/
+/**
+ * \addtogroup group_flash_structure
+ * \{
+ */
+/** Progress of the deadline-driven Flash test, see \ref SelfTest_Flash_GetDeadlineStatus */
+typedef struct
+{
+    uint32_t chunkWords;     /**< Words tested by the last call */
+    uint32_t wordsPerMs;     /**< Measured throughput of the current pass in words per ms */
+    uint32_t elapsedMs;      /**< Time since the start of the current pass in ms */
+    int32_t  slackMs;        /**< Projected time left in the budget when the current pass
+                                  completes. Negative if the pass is expected to be late */
+    uint32_t lastPassMs;     /**< Duration of the last completed pass in ms, 0 if none yet */
+    bool     deadlineAtRisk; /**< true if the current pass cannot complete within the budget
+                                  with the configured maxWordsPerCall, or the last pass was late */
+} stl_flash_deadline_status_t;
+
+/** Flash test context. Holds the complete state of one scan, so several ranges can be tested
+ *  independently, each with its own algorithm and call rate. The fields are managed by the
+ *  library and must not be modified by the application. */
+typedef struct
+{
+    stl_flash_algo_t algo;                     /**< Checksum algorithm */
+    uint32_t startAddress;                     /**< Start address of the range */
+    uint32_t endAddress;                       /**< End address of the range */
+    uint32_t currentAddress;                   /**< Address of the next word to test */
+    uint64_t sumA;                             /**< Fletcher64 running sum A */
+    uint64_t checkSum;                         /**< Running checksum: Fletcher64 sum B or CRC-32 */
+    uint64_t expectedCheckSum;                 /**< Reference checksum */
+    bool initialized;                          /**< Set by \ref SelfTest_Flash_Ctx_Init */
+
+    bool deadlineConfigured;                   /**< Set by \ref SelfTest_Flash_Ctx_SetDeadline */
+    bool deadlineNewPass;                      /**< Next deadline call starts a new pass */
+    bool deadlineLastPassLate;                 /**< Last completed pass exceeded the budget */
+    uint32_t deadlinePassTimeMs;               /**< Time budget of one pass in ms */
+    uint32_t deadlineMaxWordsPerCall;          /**< Limit of words per call, 0 - default */
+    uint32_t deadlineCallPeriodMs;             /**< Nominal call period in ms */
+    uint32_t deadlinePassStartMs;              /**< Time stamp of the first call of the pass */
+    uint32_t deadlinePassCalls;                /**< Calls of the current pass */
+    stl_flash_deadline_status_t deadlineStatus;/**< Reported progress */
+} stl_flash_context_t;
+
+/** Sector checksum table context, see \ref SelfTest_Flash_Sector_Init. The fields are managed by
+ *  the library and must not be modified by the application. */
+typedef struct
+{
+    uint32_t startAddress;    /**< Start address of the first sector */
+    uint32_t sectorSize;      /**< Size of one sector in bytes */
+    uint32_t sectorCount;     /**< Number of sectors */
+    const uint32_t* refCrc;   /**< Reference CRC per sector, sectorCount entries */
+    uint32_t* dirtyMap;       /**< One bit per sector to re-validate */
+    uint32_t nextSector;      /**< Next sector checked by \ref SelfTest_Flash_Sector_Revalidate */
+    uint32_t failedSector;    /**< Sector that failed the last check */
+} stl_flash_sector_ctx_t;
+
+#if (defined(CY_IP_MXSMIF) || defined (CY_DOXYGEN))
+/** Configuration of the external Flash (XIP) scan, see \ref SelfTest_Flash_Xip_CheckSum */
+typedef struct
+{
+    SMIF_Type* base;          /**< SMIF block that maps the range. Its cache is invalidated if
+                                   invalidateCache is set. NULL if no SMIF cache is used */
+    uint32_t lineSize;        /**< Read granularity in bytes, a power of two and a multiple of the
+                                   cache line size. Usually \ref FLASH_XIP_LINE_SIZE */
+    bool invalidateCache;     /**< Invalidate the caches before each block is read */
+} stl_flash_xip_cfg_t;
+#endif /* (defined(CY_IP_MXSMIF) || defined (CY_DOXYGEN)) */
+
+/** \} group_flash_structure */
+
 /***************************************
 * Function Prototypes
 ***************************************/
@@ -127,6 +262,296 @@ uint8_t SelfTest_FlashCheckSum(uint32_t DoubleWordsToTest);
 *******************************************************************************/
 void SelfTest_Flash_init(uint32_t StartAddressOfFlash, uint32_t EndAddressOfFlash,
                          uint64_t flash_ExpectedCheckSum);
+
+
+/*******************************************************************************
+* Function Name: SelfTest_Flash_SetDeadline
+****************************************************************************//**
+*
+* This function configures the deadline-driven mode of the Flash test. A full pass over the range
+* set by \ref SelfTest_Flash_init must complete within passTimeMs when
+* \ref SelfTest_FlashCheckSum_Deadline is called every callPeriodMs.
+*
+* \param passTimeMs
+* The time budget for one full pass over Flash in ms. <br>
+* \param callPeriodMs
+* The nominal period of \ref SelfTest_FlashCheckSum_Deadline calls in ms. Used for the first
+* block of a pass, until the throughput is measured. <br>
+* \param maxWordsPerCall
+* The upper limit of 32-bit words tested per call, which bounds the time of one call.
+* 0 selects \ref FLASH_DEADLINE_MAX_WORDS_PER_CALL. <br>
+*
+* \note
+* The next call of \ref SelfTest_FlashCheckSum_Deadline starts a new pass.
+*
+*******************************************************************************/
+void SelfTest_Flash_SetDeadline(uint32_t passTimeMs, uint32_t callPeriodMs, uint32_t maxWordsPerCall);
+
+
+/*******************************************************************************
+* Function Name: SelfTest_FlashCheckSum_Deadline
+****************************************************************************//**
+*
+* This function runs \ref SelfTest_FlashCheckSum with a block size that lets the current pass
+* complete within the budget set by \ref SelfTest_Flash_SetDeadline.
+*
+* \param timeStampMs
+* A free-running millisecond time stamp, for example the SysTick count. Wrap-around is handled.
+* <br>
+*
+* \return
+*  1 - Test failed, or \ref SelfTest_Flash_SetDeadline was not called <br>
+*  2 - Test in progress <br>
+*  3 - Test completed
+*
+*******************************************************************************/
+uint8_t SelfTest_FlashCheckSum_Deadline(uint32_t timeStampMs);
+
+
+/*******************************************************************************
+* Function Name: SelfTest_Flash_GetDeadlineStatus
+****************************************************************************//**
+*
+* This function reports the progress of the deadline-driven Flash test.
+*
+* \param status
+* The pointer to the structure to fill. <br>
+*
+*******************************************************************************/
+void SelfTest_Flash_GetDeadlineStatus(stl_flash_deadline_status_t* status);
+
+
+/*******************************************************************************
+* Function Name: SelfTest_Flash_Ctx_Init
+****************************************************************************//**
+*
+* This function initializes a Flash test context for the given range, algorithm and
+* expected/reference checksum.
+*
+* \param ctx
+* The pointer to the context to initialize. <br>
+* \param algo
+* The checksum algorithm, see \ref stl_flash_algo_t. <br>
+* \param StartAddressOfFlash
+* Start address of the range. Must be 4-byte aligned. <br>
+* \param EndAddressOfFlash
+* End address of the range. (EndAddressOfFlash - StartAddressOfFlash) must be a multiple of 4. <br>
+* \param flash_ExpectedCheckSum
+* Expected checksum. Only the lower 32 bits are used for \ref STL_FLASH_CRC32.
+* Must be stored outside the range of check. <br>
+*
+*******************************************************************************/
+void SelfTest_Flash_Ctx_Init(stl_flash_context_t* ctx, stl_flash_algo_t algo,
+                             uint32_t StartAddressOfFlash, uint32_t EndAddressOfFlash,
+                             uint64_t flash_ExpectedCheckSum);
+
+
+/*******************************************************************************
+* Function Name: SelfTest_Flash_Ctx_CheckSum
+****************************************************************************//**
+*
+* This function continues the scan of a Flash test context. Same as \ref SelfTest_FlashCheckSum
+* for the range of the context.
+*
+* \param ctx
+* The pointer to the context initialized by \ref SelfTest_Flash_Ctx_Init. <br>
+* \param DoubleWordsToTest
+* Number of 32-bit Double Words of Flash to be calculated per each function call. <br>
+*
+* \return
+*  1 - Test failed, or the context is not initialized <br>
+*  2 - Test in progress <br>
+*  3 - Test completed
+*
+*******************************************************************************/
+uint8_t SelfTest_Flash_Ctx_CheckSum(stl_flash_context_t* ctx, uint32_t DoubleWordsToTest);
+
+
+/*******************************************************************************
+* Function Name: SelfTest_Flash_Ctx_SetDeadline
+****************************************************************************//**
+*
+* This function configures the deadline-driven mode of a Flash test context.
+* Same as \ref SelfTest_Flash_SetDeadline.
+*
+* \param ctx
+* The pointer to the context initialized by \ref SelfTest_Flash_Ctx_Init. <br>
+* \param passTimeMs
+* The time budget for one full pass over the range in ms. <br>
+* \param callPeriodMs
+* The nominal call period in ms. <br>
+* \param maxWordsPerCall
+* The upper limit of 32-bit words tested per call. 0 selects
+* \ref FLASH_DEADLINE_MAX_WORDS_PER_CALL. <br>
+*
+*******************************************************************************/
+void SelfTest_Flash_Ctx_SetDeadline(stl_flash_context_t* ctx, uint32_t passTimeMs,
+                                    uint32_t callPeriodMs, uint32_t maxWordsPerCall);
+
+
+/*******************************************************************************
+* Function Name: SelfTest_Flash_Ctx_CheckSum_Deadline
+****************************************************************************//**
+*
+* This function continues the deadline-driven scan of a Flash test context.
+* Same as \ref SelfTest_FlashCheckSum_Deadline. The progress is available in the deadlineStatus
+* field of the context.
+*
+* \param ctx
+* The pointer to the context configured by \ref SelfTest_Flash_Ctx_SetDeadline. <br>
+* \param timeStampMs
+* A free-running millisecond time stamp. <br>
+*
+* \return
+*  1 - Test failed, or the context is not configured <br>
+*  2 - Test in progress <br>
+*  3 - Test completed
+*
+*******************************************************************************/
+uint8_t SelfTest_Flash_Ctx_CheckSum_Deadline(stl_flash_context_t* ctx, uint32_t timeStampMs);
+
+
+/*******************************************************************************
+* Function Name: SelfTest_Flash_Sector_Init
+****************************************************************************//**
+*
+* This function initializes a sector checksum table context. No sector is marked for
+* re-validation.
+*
+* \param ctx
+* The pointer to the context to initialize. <br>
+* \param StartAddressOfFlash
+* Start address of the first sector. Must be 4-byte aligned. <br>
+* \param sectorSize
+* Size of one sector in bytes. Must be a multiple of 4. <br>
+* \param sectorCount
+* Number of sectors. <br>
+* \param refCrc
+* The reference CRC table in the reserved area: sectorCount values of \ref SelfTests_CRC32
+* over each sector. Must be stored outside the range of check. <br>
+* \param dirtyMap
+* The buffer for the re-validation bit map, at least \ref FLASH_SECTOR_MAP_WORDS(sectorCount)
+* words. <br>
+*
+*******************************************************************************/
+void SelfTest_Flash_Sector_Init(stl_flash_sector_ctx_t* ctx, uint32_t StartAddressOfFlash,
+                                uint32_t sectorSize, uint32_t sectorCount,
+                                const uint32_t* refCrc, uint32_t* dirtyMap);
+
+
+/*******************************************************************************
+* Function Name: SelfTest_Flash_Sector_MarkDirty
+****************************************************************************//**
+*
+* This function marks all sectors overlapping an area for re-validation. Call it after the
+* area was written and the reference CRC table was updated.
+*
+* \param ctx
+* The pointer to the context initialized by \ref SelfTest_Flash_Sector_Init. <br>
+* \param address
+* Start address of the written area. <br>
+* \param size
+* Size of the written area in bytes. <br>
+*
+*******************************************************************************/
+void SelfTest_Flash_Sector_MarkDirty(stl_flash_sector_ctx_t* ctx, uint32_t address, uint32_t size);
+
+
+/*******************************************************************************
+* Function Name: SelfTest_Flash_Sector_Revalidate
+****************************************************************************//**
+*
+* This function checks marked sectors against the reference CRC table. A sector that matches is
+* unmarked.
+*
+* \param ctx
+* The pointer to the context initialized by \ref SelfTest_Flash_Sector_Init. <br>
+* \param sectorsToTest
+* Maximum number of marked sectors to check per call. <br>
+*
+* \return
+*  1 - Test failed, the sector number is in the failedSector field <br>
+*  2 - Test in progress <br>
+*  3 - Test completed, all marked sectors match
+*
+*******************************************************************************/
+uint8_t SelfTest_Flash_Sector_Revalidate(stl_flash_sector_ctx_t* ctx, uint32_t sectorsToTest);
+
+
+/*******************************************************************************
+* Function Name: SelfTest_Flash_Sector_ImageCrc
+****************************************************************************//**
+*
+* This function combines the reference CRC table into the CRC of the whole range, as
+* \ref SelfTests_CRC32 would calculate it over the range.
+*
+* \param ctx
+* The pointer to the context initialized by \ref SelfTest_Flash_Sector_Init. <br>
+*
+* \return
+* The CRC of the whole range.
+*
+*******************************************************************************/
+uint32_t SelfTest_Flash_Sector_ImageCrc(const stl_flash_sector_ctx_t* ctx);
+
+#if (defined(CY_IP_MXSMIF) || defined (CY_DOXYGEN))
+
+/*******************************************************************************
+* Function Name: SelfTest_Flash_Xip_Init
+****************************************************************************//**
+*
+* This function initializes a Flash test context for a range of memory-mapped external Flash.
+*
+* \param ctx
+* The pointer to the context to initialize. <br>
+* \param cfg
+* The pointer to the XIP scan configuration. <br>
+* \param algo
+* The checksum algorithm, see \ref stl_flash_algo_t. <br>
+* \param StartAddressOfFlash
+* Start address of the range in the XIP window. Must be aligned to cfg->lineSize. <br>
+* \param EndAddressOfFlash
+* End address of the range in the XIP window. Must be aligned to cfg->lineSize. <br>
+* \param flash_ExpectedCheckSum
+* Expected checksum. Must be stored outside the range of check. <br>
+*
+* \return
+*  0 - Context initialized <br>
+*  1 - Range or line size not valid
+*
+*******************************************************************************/
+uint8_t SelfTest_Flash_Xip_Init(stl_flash_context_t* ctx, const stl_flash_xip_cfg_t* cfg,
+                                stl_flash_algo_t algo, uint32_t StartAddressOfFlash,
+                                uint32_t EndAddressOfFlash, uint64_t flash_ExpectedCheckSum);
+
+
+/*******************************************************************************
+* Function Name: SelfTest_Flash_Xip_CheckSum
+****************************************************************************//**
+*
+* This function continues the scan of external Flash in blocks of whole lines.
+*
+* \param ctx
+* The pointer to the context initialized by \ref SelfTest_Flash_Xip_Init. <br>
+* \param cfg
+* The pointer to the XIP scan configuration used for initialization. <br>
+* \param LinesToTest
+* Number of lines of cfg->lineSize bytes to test per call. <br>
+*
+* \return
+*  1 - Test failed <br>
+*  2 - Test in progress <br>
+*  3 - Test completed
+*
+* \note
+* Invalidation of the SMIF cache affects all code and data executed from external Flash, which
+* is fetched from the device again afterwards.
+*
+*******************************************************************************/
+uint8_t SelfTest_Flash_Xip_CheckSum(stl_flash_context_t* ctx, const stl_flash_xip_cfg_t* cfg,
+                                    uint32_t LinesToTest);
+
+#endif /* (defined(CY_IP_MXSMIF) || defined (CY_DOXYGEN)) */
 /** \} group_flash_functions */
 
 
@@ -154,6 +579,13 @@ void SelfTest_Flash_init(uint32_t StartAddressOfFlash, uint32_t EndAddressOfFlas
 /** No of bytes to store the checksum*/
 #define FLASH_RESERVED_CHECKSUM_SIZE    (8u)
 
+/** Number of 32-bit words of the sector re-validation bit map for sectorCount sectors */
+#define FLASH_SECTOR_MAP_WORDS(sectorCount)   (((uint32_t)(sectorCount) + 31u) / 32u)
+
+/** Default read granularity of the external Flash (XIP) test in bytes. A multiple of the SMIF
+ *  and CM7 data cache line sizes */
+#define FLASH_XIP_LINE_SIZE             (32u)
+
 /** Define last Flash address which is used for checksum calculation. Last two bytes used for Flash
  *  checksum storing, So need to subtract "8" */
 #if (defined (CY_IP_M0S8CPUSSV3) || defined(CY_IP_M4CPUSS) || defined (CY_DOXYGEN))
@@ -39,6 +39,8 @@
 
 #if (defined (__FPU_PRESENT) && (__FPU_PRESENT == 1U))
 
+static uint32_t FPU_RegsGroup;
+
 /*******************************************************************************
  * Function Name: SelfTest_FPU_REG
  *******************************************************************************
@@ -75,4 +77,72 @@ uint8_t SelfTest_FPU_Registers(void)
 }
 
 
+/*******************************************************************************
+ * Function Name: SelfTest_FPU_Registers_Slice
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function performs the checkerboard test for the next group of FPU
+ *  registers. Interrupts are disabled only while the group is tested.
+ *
+ * Parameters:
+ *  None.
+ *
+ * Return:
+ *  PASS_STILL_TESTING_STATUS - The group passed, more groups to test.
+ *  PASS_COMPLETE_STATUS - The last group passed.
+ *  ERROR_STATUS - Test failed.
+ *
+ ******************************************************************************/
+uint8_t SelfTest_FPU_Registers_Slice(void)
+{
+    uint8_t ret;
+    uint32_t intState;
+
+    intState = Cy_SysLib_EnterCriticalSection();
+
+    /* If lazy stacking of a preempted FPU context is pending, the first FPU instruction makes
+     * the hardware stack it. Trigger this before any register is changed by the test.
+     */
+    (void)__get_FPSCR();
+
+    if (0u != (FPU->FPCCR & FPU_FPCCR_LSPACT_Msk))
+    {
+        ret = ERROR_STATUS;
+    }
+    else
+    {
+        #if defined(__GNUC__)
+        ret = SelfTest_FPU_Regs_Group_GCC(FPU_RegsGroup);
+        #elif defined(__ICCARM__)
+        ret = SelfTest_FPU_Regs_Group_IAR(FPU_RegsGroup);
+        #elif defined (__ARMCC_VERSION)
+        ret = SelfTest_FPU_Regs_Group_ARM(FPU_RegsGroup);
+        #else
+        ret = ERROR_STATUS;
+        #endif
+    }
+
+    Cy_SysLib_ExitCriticalSection(intState);
+
+    if (ret != OK_STATUS)
+    {
+        FPU_RegsGroup = 0u;
+        ret = ERROR_STATUS;
+    }
+    else
+    {
+        FPU_RegsGroup++;
+        ret = PASS_STILL_TESTING_STATUS;
+        if (FPU_RegsGroup >= FPU_REGS_GROUP_COUNT)
+        {
+            FPU_RegsGroup = 0u;
+            ret = PASS_COMPLETE_STATUS;
+        }
+    }
+
+    return ret;
+}
+
+
 #endif /* if (defined (__FPU_PRESENT) && (__FPU_PRESENT == 1U)) */
@@ -49,7 +49,18 @@
  *         valid floating point values.
  *      2) The test returns an error code if the returned values do not match.
  *
+ * \ref SelfTest_FPU_Registers tests all registers with interrupts disabled for the whole test.
+ * \ref SelfTest_FPU_Registers_Slice tests one group of registers per call, so interrupts are
+ * disabled only for the duration of one group. Each register is restored before the group
+ * returns, so no test state is kept in the FPU between calls and an interrupt that uses the FPU
+ * between two calls sees the FPU state of the application.
  *
+ * With lazy FP context stacking (FPCCR.LSPEN), a call from an interrupt handler can find the FPU
+ * state of the preempted context not yet stacked (FPCCR.LSPACT). The slice executes an FPU
+ * instruction before the test so the hardware stacks that state first, and fails if FPCCR.LSPACT
+ * is still set afterwards.
+ *
+ * \defgroup group_fpu_macros Macros
  * \defgroup group_fpu_functions Functions
  */
 
@@ -67,13 +78,23 @@
 ***************************************/
 #if defined(__GNUC__)
 uint8_t SelfTest_FPU_Regs_GCC(void);
+uint8_t SelfTest_FPU_Regs_Group_GCC(uint32_t group);
 #elif defined(__ICCARM__)
 uint8_t SelfTest_FPU_Regs_IAR(void);
+uint8_t SelfTest_FPU_Regs_Group_IAR(uint32_t group);
 #elif defined(__ARMCC_VERSION)
 uint8_t SelfTest_FPU_Regs_ARM(void);
+uint8_t SelfTest_FPU_Regs_Group_ARM(uint32_t group);
 #endif /* End (__GNUC__) ||  (__CC_ARM) */
 /** \endcond */
 
+/**
+ * \addtogroup group_fpu_macros
+ * \{
+ */
+/** The number of register groups tested by \ref SelfTest_FPU_Registers_Slice */
+#define FPU_REGS_GROUP_COUNT        (5u)
+/** \} group_fpu_macros */
 
 /**
  * \addtogroup group_fpu_functions
@@ -94,6 +115,25 @@ uint8_t SelfTest_FPU_Regs_ARM(void);
 *
 *******************************************************************************/
 uint8_t SelfTest_FPU_Registers(void);
+
+/*******************************************************************************
+* Function Name: SelfTest_FPU_Registers_Slice
+****************************************************************************//**
+*
+* This function performs the checkerboard test for the next group of FPU registers, with
+* interrupts disabled only while the group is tested. The groups are D0 to D3 (S0 to S7),
+* D4 to D7, D8 to D11, D12 to D15 (S24 to S31), and FPSCR. After an error or the last group,
+* the next call starts with the first group.
+* \note
+* Applicable only for CAT1A, CAT1B(PSoC C3) and CAT1C devices.
+*
+* \return
+*  PASS_STILL_TESTING_STATUS - The group passed, more groups to test <br>
+*  PASS_COMPLETE_STATUS      - The last group passed, all registers are tested <br>
+*  ERROR_STATUS              - Test failed
+*
+*******************************************************************************/
+uint8_t SelfTest_FPU_Registers_Slice(void);
 /** \} group_fpu_functions */
 
 #endif /* if ((defined (__FPU_PRESENT) && (__FPU_PRESENT == 1U)) || defined (CY_DOXYGEN)) */
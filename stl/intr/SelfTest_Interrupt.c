@@ -44,6 +44,33 @@
 static volatile uint16_t selfTest_interrupt_counter = 0;
 static TCPWM_Type* base1;
 static uint32_t cntNum1;
+
+/* State of the NVIC test, shared with its handlers */
+static IRQn_Type nvic_irq[INTR_NVIC_LEVELS];
+static volatile uint32_t nvic_phase;
+static volatile uint8_t nvic_log[INTR_NVIC_LOG_SIZE];
+static volatile uint32_t nvic_log_idx;
+static volatile uint32_t nvic_pend_time[INTR_NVIC_LEVELS];
+static volatile uint32_t nvic_latency[INTR_NVIC_LEVELS];
+
+/* Handler entries and exits expected in each phase */
+static const uint8_t nvic_expected_nesting[INTR_NVIC_LOG_SIZE] =
+{
+    INTR_NVIC_ENTRY | 0u, INTR_NVIC_ENTRY | 1u, INTR_NVIC_ENTRY | 2u,
+    INTR_NVIC_EXIT | 2u, INTR_NVIC_EXIT | 1u, INTR_NVIC_EXIT | 0u
+};
+static const uint8_t nvic_expected_priority[INTR_NVIC_LOG_SIZE] =
+{
+    INTR_NVIC_ENTRY | 2u, INTR_NVIC_EXIT | 2u, INTR_NVIC_ENTRY | 1u,
+    INTR_NVIC_EXIT | 1u, INTR_NVIC_ENTRY | 0u, INTR_NVIC_EXIT | 0u
+};
+
+/* The DWT cycle counter and STIR are not implemented on Cortex-M0+ */
+#if defined(__CORTEX_M) && (__CORTEX_M >= 3u)
+    #define INTR_NVIC_CYCLE_COUNTER (1u)
+#else
+    #define INTR_NVIC_CYCLE_COUNTER (0u)
+#endif
 /******************************************************************************
 * Function Name: SelfTest_Interrupt_ISR_TIMER
 *******************************************************************************
@@ -137,4 +164,326 @@ uint8_t SelfTest_Interrupt(TCPWM_Type* base, uint32_t cntNum)
 }
 
 
+/*******************************************************************************
+* Function Name: Interrupt_NVIC_Cycles
+*******************************************************************************
+*
+* Summary:
+*  Returns the DWT cycle counter, 0 on cores without it.
+*
+******************************************************************************/
+static inline uint32_t Interrupt_NVIC_Cycles(void)
+{
+    #if (INTR_NVIC_CYCLE_COUNTER == 1u)
+    return DWT->CYCCNT;
+    #else
+    return 0UL;
+    #endif
+}
+
+
+/*******************************************************************************
+* Function Name: Interrupt_NVIC_Pend
+*******************************************************************************
+*
+* Summary:
+*  Pends the IRQ of the priority level by software and waits until a preemption
+*  is taken.
+*
+* Parameters:
+*  uint32_t level - The priority level, 0 - low, 1 - middle, 2 - high.
+*
+******************************************************************************/
+static void Interrupt_NVIC_Pend(uint32_t level)
+{
+    nvic_pend_time[level] = Interrupt_NVIC_Cycles();
+
+    #if (INTR_NVIC_CYCLE_COUNTER == 1u)
+    NVIC->STIR = (uint32_t)nvic_irq[level] & NVIC_STIR_INTID_Msk;
+    #else
+    NVIC_SetPendingIRQ(nvic_irq[level]);
+    #endif
+
+    __DSB();
+    __ISB();
+}
+
+
+/*******************************************************************************
+* Function Name: Interrupt_NVIC_Log
+*******************************************************************************
+*
+* Summary:
+*  Appends an entry or exit event to the handler log.
+*
+******************************************************************************/
+static void Interrupt_NVIC_Log(uint8_t event)
+{
+    uint32_t idx = nvic_log_idx;
+
+    if (idx < INTR_NVIC_LOG_SIZE)
+    {
+        nvic_log[idx] = event;
+        nvic_log_idx = idx + 1UL;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Interrupt_NVIC_Handler
+*******************************************************************************
+*
+* Summary:
+*  Common part of the NVIC test handlers. In the nesting phase, it measures the
+*  latency and pends the next higher level, which must preempt it.
+*
+* Parameters:
+*  uint32_t level - The priority level of the handler.
+*
+******************************************************************************/
+static void Interrupt_NVIC_Handler(uint32_t level)
+{
+    uint32_t now = Interrupt_NVIC_Cycles();
+
+    Interrupt_NVIC_Log((uint8_t)(INTR_NVIC_ENTRY | level));
+
+    if (nvic_phase == INTR_NVIC_PHASE_NESTING)
+    {
+        nvic_latency[level] = now - nvic_pend_time[level];
+
+        if (level < (INTR_NVIC_LEVELS - 1u))
+        {
+            Interrupt_NVIC_Pend(level + 1u);
+        }
+    }
+
+    Interrupt_NVIC_Log((uint8_t)(INTR_NVIC_EXIT | level));
+}
+
+
+/*******************************************************************************
+* Function Name: SelfTest_Interrupt_NVIC_ISR_LOW
+*******************************************************************************
+*
+* Summary:
+*  Handle Interrupt Service Routine. Source - low priority IRQ of the NVIC test.
+*
+******************************************************************************/
+void SelfTest_Interrupt_NVIC_ISR_LOW(void)
+{
+    Interrupt_NVIC_Handler(0u);
+}
+
+
+/*******************************************************************************
+* Function Name: SelfTest_Interrupt_NVIC_ISR_MID
+*******************************************************************************
+*
+* Summary:
+*  Handle Interrupt Service Routine. Source - middle priority IRQ of the NVIC test.
+*
+******************************************************************************/
+void SelfTest_Interrupt_NVIC_ISR_MID(void)
+{
+    Interrupt_NVIC_Handler(1u);
+}
+
+
+/*******************************************************************************
+* Function Name: SelfTest_Interrupt_NVIC_ISR_HIGH
+*******************************************************************************
+*
+* Summary:
+*  Handle Interrupt Service Routine. Source - high priority IRQ of the NVIC test.
+*
+******************************************************************************/
+void SelfTest_Interrupt_NVIC_ISR_HIGH(void)
+{
+    Interrupt_NVIC_Handler(2u);
+}
+
+
+/*******************************************************************************
+* Function Name: Interrupt_NVIC_CheckLog
+*******************************************************************************
+*
+* Summary:
+*  Compares the handler log with the expected sequence.
+*
+* Return:
+*  0 - the sequence matches.
+*  1 - an event is missing or out of order.
+*
+******************************************************************************/
+static uint8_t Interrupt_NVIC_CheckLog(const uint8_t expected[])
+{
+    uint8_t ret = OK_STATUS;
+
+    if (nvic_log_idx != INTR_NVIC_LOG_SIZE)
+    {
+        ret = ERROR_STATUS;
+    }
+
+    for (uint32_t i = 0u; (ret == OK_STATUS) && (i < INTR_NVIC_LOG_SIZE); i++)
+    {
+        if (nvic_log[i] != expected[i])
+        {
+            ret = ERROR_STATUS;
+        }
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+* Function Name: Interrupt_NVIC_Reset
+*******************************************************************************
+*
+* Summary:
+*  Clears the handler log and selects the next test phase.
+*
+******************************************************************************/
+static void Interrupt_NVIC_Reset(uint32_t phase)
+{
+    nvic_phase = phase;
+    nvic_log_idx = 0UL;
+
+    for (uint32_t i = 0u; i < INTR_NVIC_LOG_SIZE; i++)
+    {
+        nvic_log[i] = 0u;
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Interrupt_NVIC
+ ********************************************************************************
+ *
+ * Summary:
+ *  This function checks the preemption, nesting, and priority order of three
+ *  software-pended IRQs and the latency of the handler entry. The priorities and
+ *  enable states of the IRQs are restored at the end.
+ *
+ * Parameters:
+ *  const stl_intr_nvic_cfg_t* cfg - The IRQ lines and the latency limit.
+ *
+ * Return:
+ *  0 - pass test.
+ *  1 - fail test.
+ *
+ **********************************************************************************/
+uint8_t SelfTest_Interrupt_NVIC(const stl_intr_nvic_cfg_t* cfg)
+{
+    uint8_t ret = OK_STATUS;
+    uint32_t savedPriority[INTR_NVIC_LEVELS];
+    uint32_t savedEnable[INTR_NVIC_LEVELS];
+    uint32_t priority[INTR_NVIC_LEVELS];
+    uint32_t level;
+
+    if ((cfg == NULL) ||
+        ((int32_t)cfg->irq[0] < 0) || ((int32_t)cfg->irq[1] < 0) || ((int32_t)cfg->irq[2] < 0) ||
+        (cfg->irq[0] == cfg->irq[1]) || (cfg->irq[1] == cfg->irq[2]) ||
+        (cfg->irq[0] == cfg->irq[2]))
+    {
+        return ERROR_STATUS;
+    }
+
+    /* Lowest priority for the low level, each next level one step higher */
+    priority[0] = (1UL << __NVIC_PRIO_BITS) - 1UL;
+    priority[1] = priority[0] - 1UL;
+    priority[2] = priority[0] - 2UL;
+
+    /* Check if an intentional error should be made for testing */
+    #if (ERROR_IN_INTERRUPT_HANDLING == 1)
+
+    priority[2] = priority[0];
+
+    #endif /* End ERROR_IN_INTERRUPT_HANDLING */
+
+    for (level = 0u; level < INTR_NVIC_LEVELS; level++)
+    {
+        nvic_irq[level] = cfg->irq[level];
+        nvic_latency[level] = 0UL;
+        savedPriority[level] = NVIC_GetPriority(nvic_irq[level]);
+        savedEnable[level] = NVIC_GetEnableIRQ(nvic_irq[level]);
+
+        NVIC_DisableIRQ(nvic_irq[level]);
+        NVIC_ClearPendingIRQ(nvic_irq[level]);
+        NVIC_SetPriority(nvic_irq[level], priority[level]);
+        NVIC_EnableIRQ(nvic_irq[level]);
+    }
+
+    #if (INTR_NVIC_CYCLE_COUNTER == 1u)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    #endif
+
+    /* Nesting: each handler pends the next higher level, which preempts it */
+    Interrupt_NVIC_Reset(INTR_NVIC_PHASE_NESTING);
+    Interrupt_NVIC_Pend(0u);
+    ret = Interrupt_NVIC_CheckLog(nvic_expected_nesting);
+
+    /* Priority: all levels pending at once are served from high to low */
+    if (ret == OK_STATUS)
+    {
+        Interrupt_NVIC_Reset(INTR_NVIC_PHASE_PRIORITY);
+
+        uint32_t intState = Cy_SysLib_EnterCriticalSection();
+        for (level = 0u; level < INTR_NVIC_LEVELS; level++)
+        {
+            Interrupt_NVIC_Pend(level);
+        }
+        Cy_SysLib_ExitCriticalSection(intState);
+        __ISB();
+
+        ret = Interrupt_NVIC_CheckLog(nvic_expected_priority);
+    }
+
+    #if (INTR_NVIC_CYCLE_COUNTER == 1u)
+    for (level = 0u; (ret == OK_STATUS) && (level < INTR_NVIC_LEVELS); level++)
+    {
+        if ((cfg->maxLatencyCycles != 0UL) && (nvic_latency[level] > cfg->maxLatencyCycles))
+        {
+            ret = ERROR_STATUS;
+        }
+    }
+    #endif
+
+    /* Restore the IRQ lines */
+    for (level = 0u; level < INTR_NVIC_LEVELS; level++)
+    {
+        NVIC_DisableIRQ(nvic_irq[level]);
+        NVIC_ClearPendingIRQ(nvic_irq[level]);
+        NVIC_SetPriority(nvic_irq[level], savedPriority[level]);
+        if (savedEnable[level] != 0UL)
+        {
+            NVIC_EnableIRQ(nvic_irq[level]);
+        }
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTest_Interrupt_NVIC_GetLatency
+ ********************************************************************************
+ *
+ * Summary:
+ *  This function returns the latency measured by the last NVIC test.
+ *
+ * Parameters:
+ *  uint32_t level - The priority level, 0 - low, 1 - middle, 2 - high.
+ *
+ * Return:
+ *  The cycles from pending to handler entry, 0 without a cycle counter.
+ *
+ **********************************************************************************/
+uint32_t SelfTest_Interrupt_NVIC_GetLatency(uint32_t level)
+{
+    return (level < INTR_NVIC_LEVELS) ? nvic_latency[level] : 0UL;
+}
+
+
 /* [] END OF FILE */
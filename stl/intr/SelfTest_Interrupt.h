@@ -52,8 +52,43 @@
  * to be supervised must decrement a dedicated global variable (freq), InterruptTest(), compares
  * that variable to predefined upper and lower bounds, returns an error, if the limits are exceeded.
  *
+ * \ref SelfTest_Interrupt_NVIC checks the interrupt controller itself in microseconds. It uses
+ * three IRQ lines that are not used by the application, with the handlers
+ * \ref SelfTest_Interrupt_NVIC_ISR_LOW, \ref SelfTest_Interrupt_NVIC_ISR_MID, and
+ * \ref SelfTest_Interrupt_NVIC_ISR_HIGH connected, and sets them to three different priorities.
+ * The IRQs are pended by software, with the NVIC STIR register or with ISPR on Cortex-M0+:
+ *      1) Nesting: the low priority handler pends the middle one, which pends the high one. Each
+ *         must preempt the handler that pended it, so the handlers are entered low, middle, high
+ *         and left in the reverse order.
+ *      2) Priority: all three are pended with interrupts disabled. After the interrupts are
+ *         enabled, the handlers must run one after the other from high to low priority.
+ *
+ * The latency from pending to handler entry of the nesting step is measured with the DWT cycle
+ * counter where available (not on Cortex-M0+) and can be limited. The priorities and enable
+ * states of the three IRQ lines are restored after the test. The test is called from thread mode
+ * with interrupts enabled, and the application interrupts must not mask the three priorities.
+ *
+ * On devices with interrupt multiplexing (CAT1C, and the CM0+ of CAT1A), the handlers are
+ * installed directly in the vector table for the CPU interrupts, for example the internal
+ * software interrupts of CAT1C, because a software-pended CPU interrupt has no system interrupt
+ * source for the dispatcher.
+ *
+ * \code
+ * static const stl_intr_nvic_cfg_t nvicCfg =
+ * {
+ *     .irq = { NVIC_TEST_IRQ_LOW, NVIC_TEST_IRQ_MID, NVIC_TEST_IRQ_HIGH },
+ *     .maxLatencyCycles = 200UL
+ * };
+ *
+ * if (SelfTest_Interrupt_NVIC(&nvicCfg) != OK_STATUS)
+ * {
+ *     // Process error
+ * }
+ * \endcode
+ *
  *
  * \defgroup group_intr_macros Macros
+ * \defgroup group_intr_data_structures Data Structures
  * \defgroup group_intr_functions Functions
  */
 
@@ -63,6 +98,30 @@
 #include "cy_pdl.h"
 #include "SelfTest_common.h"
 
+/** \addtogroup group_intr_macros
+ * \{
+ */
+
+/** Number of priority levels of \ref SelfTest_Interrupt_NVIC: low, middle, high */
+#define INTR_NVIC_LEVELS                  (3u)
+
+/** \} group_intr_macros */
+
+/**
+ * \addtogroup group_intr_data_structures
+ * \{
+ */
+
+/** Configuration of \ref SelfTest_Interrupt_NVIC */
+typedef struct
+{
+    IRQn_Type irq[INTR_NVIC_LEVELS];    /**< IRQ lines of the low, middle, and high priority
+                                             handlers */
+    uint32_t maxLatencyCycles;          /**< Largest latency from pending to handler entry,
+                                             0 - not checked */
+} stl_intr_nvic_cfg_t;
+
+/** \} group_intr_data_structures */
 
 /***************************************
 * Function Prototypes
@@ -101,6 +160,65 @@ uint8_t SelfTest_Interrupt(TCPWM_Type* base, uint32_t cntNum);
 *******************************************************************************/
 void SelfTest_Interrupt_ISR_TIMER(void);
 
+/*******************************************************************************
+* Function Name: SelfTest_Interrupt_NVIC
+****************************************************************************//**
+*
+*  This function checks the preemption, nesting, and priority order of three software-pended
+*  IRQs and the latency of the handler entry.
+*
+* \param cfg
+* The IRQ lines and the latency limit.
+*
+* \return
+*  0 - Test passed <br>
+*  1 - Test failed
+*
+*******************************************************************************/
+uint8_t SelfTest_Interrupt_NVIC(const stl_intr_nvic_cfg_t* cfg);
+
+/*******************************************************************************
+* Function Name: SelfTest_Interrupt_NVIC_GetLatency
+****************************************************************************//**
+*
+*  This function returns the latency measured by the last \ref SelfTest_Interrupt_NVIC.
+*
+* \param level
+* The priority level, 0 - low, 1 - middle, 2 - high.
+*
+* \return
+*  The cycles from pending to handler entry, 0 without a cycle counter.
+*
+*******************************************************************************/
+uint32_t SelfTest_Interrupt_NVIC_GetLatency(uint32_t level);
+
+/*******************************************************************************
+* Function Name: SelfTest_Interrupt_NVIC_ISR_LOW
+****************************************************************************//**
+*
+* Handle Interrupt Service Routine. Source - low priority IRQ of \ref SelfTest_Interrupt_NVIC.
+*
+*******************************************************************************/
+void SelfTest_Interrupt_NVIC_ISR_LOW(void);
+
+/*******************************************************************************
+* Function Name: SelfTest_Interrupt_NVIC_ISR_MID
+****************************************************************************//**
+*
+* Handle Interrupt Service Routine. Source - middle priority IRQ of \ref SelfTest_Interrupt_NVIC.
+*
+*******************************************************************************/
+void SelfTest_Interrupt_NVIC_ISR_MID(void);
+
+/*******************************************************************************
+* Function Name: SelfTest_Interrupt_NVIC_ISR_HIGH
+****************************************************************************//**
+*
+* Handle Interrupt Service Routine. Source - high priority IRQ of \ref SelfTest_Interrupt_NVIC.
+*
+*******************************************************************************/
+void SelfTest_Interrupt_NVIC_ISR_HIGH(void);
+
 /** \} group_intr_functions */
 
 /***************************************
@@ -134,6 +252,17 @@ void SelfTest_Interrupt_ISR_TIMER(void);
 
 /** \} group_intr_macros */
 
+/** \cond INTERNAL */
+/* Events of the handler log: level in bits 0-3 */
+#define INTR_NVIC_ENTRY                   (0x10u)
+#define INTR_NVIC_EXIT                    (0x20u)
+#define INTR_NVIC_LOG_SIZE                (2u * INTR_NVIC_LEVELS)
+
+/* Test phases */
+#define INTR_NVIC_PHASE_NESTING           (0u)
+#define INTR_NVIC_PHASE_PRIORITY          (1u)
+/** \endcond */
+
 /** \} group_intr */
 
 #endif /* SELFTEST_INTERRUPT_H */
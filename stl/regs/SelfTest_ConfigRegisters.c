@@ -671,8 +671,593 @@ void SelfTests_Init_StartUp_ConfigReg(void)
 static uint8_t SelfTests_Check_StartUp_Cfg_CRC(uint32_t Current_CRC);
 #endif /* End (STARTUP_CFG_REGS_MODE == CFG_REGS_CRC_MODE) */
 
+/* The number of registers in the default table */
+#define CFG_REGS_DEFAULT_COUNT  (sizeof(regs32_ToTest) / sizeof(regs32_ToTest[0u]))
+
+/* The number of tested registers: the default table followed by the application registers */
+#define CFG_REGS_COUNT          (CFG_REGS_DEFAULT_COUNT + cfgRegSectionCount + cfgRegUserCount)
+
+/* The maximum number of tested registers */
+#define CFG_REGS_MAX_COUNT      (CFG_REGS_DEFAULT_COUNT + CFG_REGS_USER_MAX_COUNT)
+
+/* The number of words of flashRowData available for the register values */
+#if (CFG_REGS_JOURNAL == 1u)
+/* The journal record header uses the last words */
+#define CFG_REGS_ROW_WORDS      ((sizeof(flashRowData) / sizeof(uint32_t)) - 3u)
+#elif CFG_REGS_FLASH_COPY && !defined(CY_IP_MXFLASHC_VERSION_ECT)
+#define CFG_REGS_ROW_WORDS      \
+    ((sizeof(flashRowData) - FLASH_RESERVED_CHECKSUM_SIZE) / sizeof(uint32_t))
+#else
+#define CFG_REGS_ROW_WORDS      (sizeof(flashRowData) / sizeof(uint32_t))
+#endif
+#if (STARTUP_CFG_REGS_MODE == CFG_REGS_HYBRID_MODE)
+/* Only the CRC and the volatile fields are stored, and the registers are not buffered */
+#define CFG_REGS_CAPACITY       (CFG_REGS_MAX_COUNT)
+#else
+#define CFG_REGS_CAPACITY       (CFG_REGS_ROW_WORDS)
+#endif
+
+#if (CFG_REGS_USER_SECTION == 1u)
+/* Application registers placed by STL_CFG_REG_ENTRY(); both are NULL if the section is empty */
+extern const stl_cfg_reg_t __start_stl_cfg_regs[] __attribute__((weak));
+extern const stl_cfg_reg_t __stop_stl_cfg_regs[] __attribute__((weak));
+#endif /* End (CFG_REGS_USER_SECTION == 1u) */
+
+/* Application registers, set by SelfTests_ConfigReg_Register() */
+static const stl_cfg_reg_t* cfgRegSection = NULL;
+static uint32_t cfgRegSectionCount = 0u;
+static const stl_cfg_reg_t* cfgRegUser = NULL;
+static uint32_t cfgRegUserCount = 0u;
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_ConfigReg_Register
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function adds the application registers to the default table.
+ *
+ * Parameters:
+ *  const stl_cfg_reg_t* regs - The table of application registers.
+ *  uint32_t count - The number of entries.
+ *
+ * Return:
+ *  OK_STATUS - The registers are added.
+ *  ERROR_STATUS - The merged table does not fit.
+ *
+ ******************************************************************************/
+uint8_t SelfTests_ConfigReg_Register(const stl_cfg_reg_t* regs, uint32_t count)
+{
+    uint8_t ret = ERROR_STATUS;
+    const stl_cfg_reg_t* section = NULL;
+    uint32_t sectionCount = 0u;
+    uint32_t userCount = (regs != NULL) ? count : 0u;
+
+    #if (CFG_REGS_USER_SECTION == 1u)
+    if (__start_stl_cfg_regs != NULL)
+    {
+        section = __start_stl_cfg_regs;
+        sectionCount = (uint32_t)(__stop_stl_cfg_regs - __start_stl_cfg_regs);
+    }
+    #endif /* End (CFG_REGS_USER_SECTION == 1u) */
+
+    if ((sectionCount <= CFG_REGS_USER_MAX_COUNT) &&
+        (userCount <= (CFG_REGS_USER_MAX_COUNT - sectionCount)) &&
+        ((CFG_REGS_DEFAULT_COUNT + sectionCount + userCount) <= CFG_REGS_CAPACITY))
+    {
+        cfgRegSection = section;
+        cfgRegSectionCount = sectionCount;
+        cfgRegUser = regs;
+        cfgRegUserCount = userCount;
+        ret = OK_STATUS;
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_ConfigReg_GetCount
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function returns the number of tested registers.
+ *
+ * Parameters:
+ *  None.
+ *
+ * Return:
+ *  The number of registers in the merged table.
+ *
+ ******************************************************************************/
+uint32_t SelfTests_ConfigReg_GetCount(void)
+{
+    return CFG_REGS_COUNT;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_ConfigReg_Entry
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function returns the entry "index" of the merged table. The default
+ *  registers are checked with all bits.
+ *
+ ******************************************************************************/
+static stl_cfg_reg_t SelfTests_ConfigReg_Entry(uint32_t index)
+{
+    stl_cfg_reg_t entry;
+
+    if (index < CFG_REGS_DEFAULT_COUNT)
+    {
+        entry.address = regs32_ToTest[index];
+        entry.mask = 0xFFFFFFFFUL;
+    }
+    else if (index < (CFG_REGS_DEFAULT_COUNT + cfgRegSectionCount))
+    {
+        entry = cfgRegSection[index - CFG_REGS_DEFAULT_COUNT];
+    }
+    else
+    {
+        entry = cfgRegUser[index - CFG_REGS_DEFAULT_COUNT - cfgRegSectionCount];
+    }
+    return entry;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_ConfigReg_Read
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function returns the checked bits of register "index".
+ *
+ ******************************************************************************/
+static uint32_t SelfTests_ConfigReg_Read(uint32_t index)
+{
+    stl_cfg_reg_t entry = SelfTests_ConfigReg_Entry(index);
+
+    return CY_GET_REG32(entry.address) & entry.mask;
+}
+
+#if (CFG_REGS_JOURNAL == 1u)
+/* A journal record is one flashRowData image: the payload followed by the record header */
+#define CFG_REGS_RECORD_WORDS       (sizeof(flashRowData) / sizeof(uint32_t))
+#define CFG_REGS_RECORD_SEQ         (CFG_REGS_RECORD_WORDS - 3u)
+#define CFG_REGS_RECORD_MAGIC       (CFG_REGS_RECORD_WORDS - 2u)
+#define CFG_REGS_RECORD_CRC         (CFG_REGS_RECORD_WORDS - 1u)
+#define CFG_REGS_RECORD_MAGIC_VALUE (0x53544C4AUL)
+
+/* The number of records in one slot and in the journal */
+#define CFG_REGS_SLOT_RECORDS       (CFG_REGS_JOURNAL_SLOT_SIZE / sizeof(flashRowData))
+#define CFG_REGS_JOURNAL_RECORDS    (2u * CFG_REGS_SLOT_RECORDS)
+
+/* No valid record in the journal */
+#define CFG_REGS_JOURNAL_EMPTY      (0xFFFFFFFFUL)
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_ConfigReg_JournalRecord
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function returns the address of journal record "pos".
+ *
+ ******************************************************************************/
+static const uint32_t* SelfTests_ConfigReg_JournalRecord(uint32_t pos)
+{
+    return (const uint32_t*)(CFG_REGS_JOURNAL_ADDR + (pos * sizeof(flashRowData)));
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_ConfigReg_JournalLatest
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function finds the valid record with the highest sequence number.
+ *  Records with a wrong marker or CRC, for example after a power loss during
+ *  programming, are skipped.
+ *
+ * Parameters:
+ *  uint32_t* sequence - Returns the sequence number of the found record.
+ *
+ * Return:
+ *  The record position or CFG_REGS_JOURNAL_EMPTY.
+ *
+ ******************************************************************************/
+static uint32_t SelfTests_ConfigReg_JournalLatest(uint32_t* sequence)
+{
+    uint32_t latest = CFG_REGS_JOURNAL_EMPTY;
+    const uint32_t* record;
+
+    for (uint32_t pos = 0u; pos < CFG_REGS_JOURNAL_RECORDS; pos++)
+    {
+        record = SelfTests_ConfigReg_JournalRecord(pos);
+        if ((record[CFG_REGS_RECORD_MAGIC] == CFG_REGS_RECORD_MAGIC_VALUE) &&
+            (record[CFG_REGS_RECORD_CRC] ==
+             SelfTests_CRC32_IEEE((uint32_t)record, CFG_REGS_RECORD_CRC * sizeof(uint32_t))) &&
+            ((latest == CFG_REGS_JOURNAL_EMPTY) ||
+             ((int32_t)(record[CFG_REGS_RECORD_SEQ] - *sequence) > 0)))
+        {
+            latest = pos;
+            *sequence = record[CFG_REGS_RECORD_SEQ];
+        }
+    }
+    return latest;
+}
+
+
+#if defined(CY_IP_MXFLASHC_VERSION_ECT)
+/*******************************************************************************
+ * Function Name: SelfTests_ConfigReg_JournalNextSlot
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function returns the first record position of the slot after the slot
+ *  of record "pos".
+ *
+ ******************************************************************************/
+static uint32_t SelfTests_ConfigReg_JournalNextSlot(uint32_t pos)
+{
+    return (((pos / CFG_REGS_SLOT_RECORDS) + 1u) % 2u) * CFG_REGS_SLOT_RECORDS;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_ConfigReg_JournalBlank
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function checks that record "pos" is erased. Rows are only programmed
+ *  after a sector erase, so a record that was partly programmed, for example
+ *  after a power loss, cannot be programmed again.
+ *
+ * Return:
+ *  true - All words of the record hold the erased value.
+ *
+ ******************************************************************************/
+static bool SelfTests_ConfigReg_JournalBlank(uint32_t pos)
+{
+    const uint32_t* record = SelfTests_ConfigReg_JournalRecord(pos);
+    bool blank = true;
+
+    for (uint32_t i = 0u; (i < CFG_REGS_RECORD_WORDS) && blank; i++)
+    {
+        blank = (record[i] == CFG_REGS_JOURNAL_ERASED_VALUE);
+    }
+    return blank;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_ConfigReg_JournalWrite
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function programs flashRowData to record "pos" and verifies it. The
+ *  sector is erased first when "pos" is the first record of a slot.
+ *
+ * Return:
+ *  The Flash driver status, CY_FLASH_DRV_ERR_UNC if the verification failed.
+ *
+ ******************************************************************************/
+static cy_en_flashdrv_status_t SelfTests_ConfigReg_JournalWrite(uint32_t pos)
+{
+    cy_en_flashdrv_status_t ret = CY_FLASH_DRV_SUCCESS;
+    uint32_t addr_to_write = (uint32_t)SelfTests_ConfigReg_JournalRecord(pos);
+
+    if ((pos % CFG_REGS_SLOT_RECORDS) == 0u)
+    {
+        uint16_t guardCnt = 0u;
+        ret = Cy_Flash_EraseSector(addr_to_write);
+        while ((Cy_Flash_IsOperationComplete() != CY_FLASH_DRV_SUCCESS) && (guardCnt < 1000U))
+        {
+            guardCnt++;
+            Cy_SysLib_DelayUs(1u);
+        }
+        if ((ret == CY_FLASH_DRV_SUCCESS) && (guardCnt >= 1000U))
+        {
+            ret = CY_FLASH_DRV_OPERATION_STARTED;
+        }
+    }
+    for (uint32_t i = 0u; (i < (sizeof(flashRowData) / CY_FLASH_SIZEOF_ROW)) &&
+         (ret == CY_FLASH_DRV_SUCCESS); i++)
+    {
+        ret = Cy_Flash_ProgramRow(addr_to_write + (i * CY_FLASH_SIZEOF_ROW),
+                                  &flashRowData[i * (CY_FLASH_SIZEOF_ROW / sizeof(uint32_t))]);
+    }
+    if ((ret == CY_FLASH_DRV_SUCCESS) &&
+        (memcmp((const void*)addr_to_write, flashRowData, sizeof(flashRowData)) != 0))
+    {
+        ret = CY_FLASH_DRV_ERR_UNC;
+    }
+    return ret;
+}
+
+
+#endif /* defined(CY_IP_MXFLASHC_VERSION_ECT) */
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_ConfigReg_JournalPrepare
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function completes flashRowData with the record header and returns the
+ *  position of the next record. The record after the latest one is used, so the
+ *  latest record stays valid until the new record is complete. On devices with
+ *  sector erase, the journal moves to the next slot if that record is not
+ *  blank.
+ *
+ * Parameters:
+ *  None.
+ *
+ * Return:
+ *  The record position.
+ *
+ ******************************************************************************/
+static uint32_t SelfTests_ConfigReg_JournalPrepare(void)
+{
+    uint32_t sequence = 0u;
+    uint32_t pos = SelfTests_ConfigReg_JournalLatest(&sequence);
+
+    pos = (pos == CFG_REGS_JOURNAL_EMPTY) ? 0u : ((pos + 1u) % CFG_REGS_JOURNAL_RECORDS);
+
+    #if defined(CY_IP_MXFLASHC_VERSION_ECT)
+    /* The first record of a slot is erased before programming. Any other record that is not
+       blank, for example after a power loss during programming, cannot be programmed again, so
+       the journal continues in the next slot, which does not hold the latest record. */
+    if (((pos % CFG_REGS_SLOT_RECORDS) != 0u) && !SelfTests_ConfigReg_JournalBlank(pos))
+    {
+        pos = SelfTests_ConfigReg_JournalNextSlot(pos);
+    }
+    #endif /* defined(CY_IP_MXFLASHC_VERSION_ECT) */
+
+    flashRowData[CFG_REGS_RECORD_SEQ] = sequence + 1u;
+    flashRowData[CFG_REGS_RECORD_MAGIC] = CFG_REGS_RECORD_MAGIC_VALUE;
+    flashRowData[CFG_REGS_RECORD_CRC] =
+        SelfTests_CRC32_IEEE((uint32_t)flashRowData, CFG_REGS_RECORD_CRC * sizeof(uint32_t));
+
+    return pos;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_ConfigReg_JournalAppend
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function writes flashRowData as the next journal record. On devices
+ *  with sector erase, a slot is erased only when the journal moves into it, and
+ *  a record that fails to program or verify is retried in the next slot.
+ *
+ * Parameters:
+ *  None.
+ *
+ * Return:
+ *  The Flash driver status.
+ *
+ ******************************************************************************/
+static cy_en_flashdrv_status_t SelfTests_ConfigReg_JournalAppend(void)
+{
+    cy_en_flashdrv_status_t ret = CY_FLASH_DRV_SUCCESS;
+    uint32_t pos = SelfTests_ConfigReg_JournalPrepare();
+
+    #if !defined(CY_IP_MXFLASHC_VERSION_ECT)
+    uint32_t addr_to_write = (uint32_t)SelfTests_ConfigReg_JournalRecord(pos);
+    for (uint32_t i = 0u; (i < (sizeof(flashRowData) / CY_FLASH_SIZEOF_ROW)) &&
+         (ret == CY_FLASH_DRV_SUCCESS); i++)
+    {
+        ret = Cy_Flash_WriteRow(addr_to_write + (i * CY_FLASH_SIZEOF_ROW),
+                                &flashRowData[i * (CY_FLASH_SIZEOF_ROW / sizeof(uint32_t))]);
+    }
+    #else
+    Cy_Flashc_MainWriteEnable();
+    ret = SelfTests_ConfigReg_JournalWrite(pos);
+    /* A failed record cannot be programmed again: retry once in the erased next slot */
+    if ((ret != CY_FLASH_DRV_SUCCESS) && ((pos % CFG_REGS_SLOT_RECORDS) != 0u))
+    {
+        ret = SelfTests_ConfigReg_JournalWrite(SelfTests_ConfigReg_JournalNextSlot(pos));
+    }
+    Cy_Flashc_MainWriteDisable();
+    #endif /* !defined(CY_IP_MXFLASHC_VERSION_ECT) */
+
+    return ret;
+}
+
+
+#endif /* End (CFG_REGS_JOURNAL == 1u) */
+
+
+#if CFG_REGS_FLASH_COPY
+/*******************************************************************************
+ * Function Name: SelfTests_ConfigReg_Stored
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function returns the stored register duplicates, or NULL if the
+ *  journal holds no valid record.
+ *
+ ******************************************************************************/
+static const uint32_t* SelfTests_ConfigReg_Stored(void)
+{
+    #if (CFG_REGS_JOURNAL == 1u)
+    uint32_t sequence = 0u;
+    uint32_t pos = SelfTests_ConfigReg_JournalLatest(&sequence);
+
+    return (pos != CFG_REGS_JOURNAL_EMPTY) ? SelfTests_ConfigReg_JournalRecord(pos) : NULL;
+    #else
+    return (const uint32_t*)(CONF_REG_FIRST_ROW_ADDR);
+    #endif
+}
+
+
+#endif /* End CFG_REGS_FLASH_COPY */
+
+
+#if (STARTUP_CFG_REGS_MODE == CFG_REGS_HYBRID_MODE)
+/* Hybrid record: the CRC of the register set, the number of volatile fields, and the fields as
+ * pairs of register index and mask */
+#define CFG_REGS_HYBRID_CRC     (0u)
+#define CFG_REGS_HYBRID_COUNT   (1u)
+#define CFG_REGS_HYBRID_FIELDS  (2u)
+
+/* Volatile register fields, set by SelfTests_ConfigReg_SetVolatileFields() */
+static const stl_cfg_reg_field_t* cfgRegVolatileFields = NULL;
+static uint32_t cfgRegVolatileCount = 0u;
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_ConfigReg_SetVolatileFields
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function sets the table of volatile register fields, which is stored
+ *  with the CRC by the next save.
+ *
+ * Parameters:
+ *  const stl_cfg_reg_field_t* fields - The table of volatile fields.
+ *  uint32_t count - The number of entries.
+ *
+ * Return:
+ *  OK_STATUS - The table is set.
+ *  ERROR_STATUS - More than CFG_REGS_VOLATILE_MAX_COUNT entries.
+ *
+ ******************************************************************************/
+uint8_t SelfTests_ConfigReg_SetVolatileFields(const stl_cfg_reg_field_t* fields, uint32_t count)
+{
+    uint8_t ret = ERROR_STATUS;
+    uint32_t fieldCount = (fields != NULL) ? count : 0u;
+
+    if (fieldCount <= CFG_REGS_VOLATILE_MAX_COUNT)
+    {
+        cfgRegVolatileFields = fields;
+        cfgRegVolatileCount = fieldCount;
+        ret = OK_STATUS;
+    }
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_ConfigReg_SetCrc
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function reads all tested registers in one pass and returns the CRC of
+ *  their values with the volatile fields cleared.
+ *
+ * Parameters:
+ *  const uint32_t* fields - The volatile fields as pairs of register index
+ *  and mask, as stored in the hybrid record.
+ *  uint32_t count - The number of fields.
+ *
+ * Return:
+ *  The CRC32 of the register set.
+ *
+ ******************************************************************************/
+static uint32_t SelfTests_ConfigReg_SetCrc(const uint32_t* fields, uint32_t count)
+{
+    uint32_t crc = 0u;
+    uint32_t value;
+
+    for (uint32_t i = 0u; i < CFG_REGS_COUNT; i++)
+    {
+        value = SelfTests_ConfigReg_Read(i);
+        for (uint32_t j = 0u; j < count; j++)
+        {
+            if (fields[2u * j] == i)
+            {
+                value &= ~fields[(2u * j) + 1u];
+            }
+        }
+        crc = SelfTests_CRC32_IEEE_ACC(crc, (uint32_t)&value, sizeof(value));
+    }
+    return crc;
+}
+
+
+#endif /* End (STARTUP_CFG_REGS_MODE == CFG_REGS_HYBRID_MODE) */
+
+
+#if CFG_REGS_FLASH_COPY
+
+#if defined(CY_IP_MXFLASHC_VERSION_ECT)
+/* Non-blocking save: the row to program next, the number of rows, and the first row address */
+static uint32_t cfgRegSaveRow = 0u;
+static uint32_t cfgRegSaveRows = 0u;
+static uint32_t cfgRegSaveAddr = 0u;
+static bool cfgRegSaveBusy = false;
+#if (CFG_REGS_JOURNAL == 1u)
+/* Non-blocking save: the journal record being written */
+static uint32_t cfgRegSavePos = 0u;
+#endif /* (CFG_REGS_JOURNAL == 1u) */
+#endif /* defined(CY_IP_MXFLASHC_VERSION_ECT) */
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_ConfigReg_Fill
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function stores the configuration registers to the flashRowData array.
+ *
+ ******************************************************************************/
+static void SelfTests_ConfigReg_Fill(void)
+{
+    /* Fill Flash row with "0" */
+    (void)memset(flashRowData, 0x00, sizeof(flashRowData));
+
+    #if defined(CY_DEVICE_PSOC6ABLE2)
+    /* Setting Regs affected by Flash delay for 1M device*/
+    SRSS_CLK_OUTPUT_SLOW = _VAL2FLD(SRSS_CLK_OUTPUT_SLOW_SLOW_SEL0, 6);
+    SRSS_CLK_CAL_CNT1 = _VAL2FLD(SRSS_CLK_CAL_CNT1_CAL_COUNTER1, 0);
+    #endif
+
+    #if (STARTUP_CFG_REGS_MODE == CFG_REGS_HYBRID_MODE)
+    /* Store the volatile fields and the CRC of the register set without them */
+    flashRowData[CFG_REGS_HYBRID_COUNT] = cfgRegVolatileCount;
+    for (uint32_t i = 0u; i < cfgRegVolatileCount; i++)
+    {
+        flashRowData[CFG_REGS_HYBRID_FIELDS + (2u * i)] = cfgRegVolatileFields[i].index;
+        flashRowData[CFG_REGS_HYBRID_FIELDS + (2u * i) + 1u] = cfgRegVolatileFields[i].mask;
+    }
+    flashRowData[CFG_REGS_HYBRID_CRC] =
+        SelfTests_ConfigReg_SetCrc(&flashRowData[CFG_REGS_HYBRID_FIELDS], cfgRegVolatileCount);
+    #else
+    /* Store 32Bit registers */
+    for (uint32_t i = 0u; i < CFG_REGS_COUNT; i++)
+    {
+        flashRowData[i] = SelfTests_ConfigReg_Read(i);
+    }
+    #endif /* End (STARTUP_CFG_REGS_MODE == CFG_REGS_HYBRID_MODE) */
+}
+
+
+#if defined(CY_IP_MXFLASHC_VERSION_ECT) && (CFG_REGS_JOURNAL == 0u)
+/*******************************************************************************
+ * Function Name: SelfTests_ConfigReg_StoredSize
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function returns the number of bytes of flashRowData to program: the
+ *  register duplicates, or the hybrid record.
+ *
+ ******************************************************************************/
+static uint32_t SelfTests_ConfigReg_StoredSize(void)
+{
+    #if (STARTUP_CFG_REGS_MODE == CFG_REGS_HYBRID_MODE)
+    return (CFG_REGS_HYBRID_FIELDS + (2u * cfgRegVolatileCount)) * sizeof(uint32_t);
+    #else
+    return CFG_REGS_COUNT * sizeof(uint32_t);
+    #endif /* End (STARTUP_CFG_REGS_MODE == CFG_REGS_HYBRID_MODE) */
+}
+
+
+#endif /* defined(CY_IP_MXFLASHC_VERSION_ECT) && (CFG_REGS_JOURNAL == 0u) */
 
-#if (STARTUP_CFG_REGS_MODE == CFG_REGS_TO_FLASH_MODE)
 
 /*******************************************************************************
  * Function Name: SelfTests_Save_StartUp_ConfigReg(void)
@@ -688,32 +1273,29 @@ static uint8_t SelfTests_Check_StartUp_Cfg_CRC(uint32_t Current_CRC);
  * Return:
  *  0 - Writing to Flash is successful.
  *  >=1 - Writing to Flash is not successful. Refer to the Flash Driver PDL documentation.
- *  for error codes.
+ *  for error codes. CY_FLASH_DRV_OPCODE_BUSY while a non-blocking save is running.
  *
  ******************************************************************************/
 cy_en_flashdrv_status_t SelfTests_Save_StartUp_ConfigReg(void)
-{
-    /* Fill Flash row with "0" */
-    (void)memset(flashRowData, 0x00, sizeof(flashRowData));
-
-    #if !defined(CY_IP_MXFLASHC_VERSION_ECT)
+{
+    #if !defined(CY_IP_MXFLASHC_VERSION_ECT) && (CFG_REGS_JOURNAL == 0u)
     uint32_t* flash_checksum_ptr = (uint32_t*)FLASH_END_ADDR;
     uint32_t no_of_data_to_copy = (FLASH_RESERVED_CHECKSUM_SIZE/sizeof(flashRowData[0]));
     #endif
 
-    #if defined(CY_DEVICE_PSOC6ABLE2)
-    /* Setting Regs affected by Flash delay for 1M device*/
-    SRSS_CLK_OUTPUT_SLOW = _VAL2FLD(SRSS_CLK_OUTPUT_SLOW_SLOW_SEL0, 6);
-    SRSS_CLK_CAL_CNT1 = _VAL2FLD(SRSS_CLK_CAL_CNT1_CAL_COUNTER1, 0);
-    #endif
-
-    /* Store 32Bit registers */
-    for (uint32_t i = 0u; i < (sizeof(regs32_ToTest) / sizeof(regs32_ToTest[0u])); i++)
+    #if defined(CY_IP_MXFLASHC_VERSION_ECT)
+    /* flashRowData holds the rows of the running non-blocking save */
+    if (cfgRegSaveBusy)
     {
-        flashRowData[i] = CY_GET_REG32(regs32_ToTest[i]);
+        return CY_FLASH_DRV_OPCODE_BUSY;
     }
+    #endif /* defined(CY_IP_MXFLASHC_VERSION_ECT) */
 
-    #if !defined(CY_IP_MXFLASHC_VERSION_ECT)
+    SelfTests_ConfigReg_Fill();
+
+    #if (CFG_REGS_JOURNAL == 1u)
+    return SelfTests_ConfigReg_JournalAppend();
+    #elif !defined(CY_IP_MXFLASHC_VERSION_ECT)
     for (uint32_t i = 0; i < no_of_data_to_copy; i++)
     {
         flashRowData[(CY_FLASH_SIZEOF_ROW/(sizeof(uint32_t))) - no_of_data_to_copy + i] =
@@ -734,7 +1316,7 @@ cy_en_flashdrv_status_t SelfTests_Save_StartUp_ConfigReg(void)
     {
         return ret;
     }
-    uint32_t regsToTestSize = sizeof(regs32_ToTest);
+    uint32_t regsToTestSize = SelfTests_ConfigReg_StoredSize();
     if (regsToTestSize > CY_FLASH_SIZEOF_ROW)
     {
         uint32_t addr_to_write = (uint32_t)(CONF_REG_FIRST_ROW_ADDR);
@@ -760,6 +1342,184 @@ cy_en_flashdrv_status_t SelfTests_Save_StartUp_ConfigReg(void)
 }
 
 
+#if defined(CY_IP_MXFLASHC_VERSION_ECT)
+#if (CFG_REGS_JOURNAL == 1u)
+/*******************************************************************************
+ * Function Name: SelfTests_ConfigReg_SaveRetry
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function continues a failed non-blocking save in the next journal slot,
+ *  as SelfTests_ConfigReg_JournalAppend() does. A failed record cannot be
+ *  programmed again, so the next slot is erased and the record is written to
+ *  its first position. A record that already is the first of its slot is not
+ *  retried.
+ *
+ * Parameters:
+ *  cy_en_flashdrv_status_t ret - The status of the last Flash operation.
+ *
+ * Return:
+ *  CY_FLASH_DRV_OPERATION_STARTED if the erase of the next slot was started,
+ *  otherwise "ret" or the status of the erase.
+ *
+ ******************************************************************************/
+static cy_en_flashdrv_status_t SelfTests_ConfigReg_SaveRetry(cy_en_flashdrv_status_t ret)
+{
+    if ((ret != CY_FLASH_DRV_SUCCESS) && (ret != CY_FLASH_DRV_OPERATION_STARTED) &&
+        ((cfgRegSavePos % CFG_REGS_SLOT_RECORDS) != 0u))
+    {
+        cfgRegSavePos = SelfTests_ConfigReg_JournalNextSlot(cfgRegSavePos);
+        cfgRegSaveAddr = (uint32_t)SelfTests_ConfigReg_JournalRecord(cfgRegSavePos);
+        cfgRegSaveRow = 0u;
+        ret = Cy_Flash_StartEraseSector(cfgRegSaveAddr);
+        if (ret == CY_FLASH_DRV_SUCCESS)
+        {
+            ret = CY_FLASH_DRV_OPERATION_STARTED;
+        }
+    }
+    return ret;
+}
+
+
+#endif /* (CFG_REGS_JOURNAL == 1u) */
+/*******************************************************************************
+ * Function Name: SelfTests_Save_StartUp_ConfigReg_Start
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function stores the configuration registers to the flashRowData array
+ *  and starts the sector erase or the first row program without waiting.
+ *
+ * Parameters:
+ *  None.
+ *
+ * Return:
+ *  CY_FLASH_DRV_OPERATION_STARTED - The save is running.
+ *  CY_FLASH_DRV_OPCODE_BUSY - A save is already running.
+ *  Other - Starting the Flash operation failed.
+ *
+ ******************************************************************************/
+cy_en_flashdrv_status_t SelfTests_Save_StartUp_ConfigReg_Start(void)
+{
+    cy_en_flashdrv_status_t ret;
+    uint32_t eraseAddr;
+
+    if (cfgRegSaveBusy)
+    {
+        return CY_FLASH_DRV_OPCODE_BUSY;
+    }
+
+    SelfTests_ConfigReg_Fill();
+
+    #if (CFG_REGS_JOURNAL == 1u)
+    cfgRegSavePos = SelfTests_ConfigReg_JournalPrepare();
+    cfgRegSaveAddr = (uint32_t)SelfTests_ConfigReg_JournalRecord(cfgRegSavePos);
+    cfgRegSaveRows = sizeof(flashRowData) / CY_FLASH_SIZEOF_ROW;
+    /* Erase a slot only when the journal moves into it */
+    eraseAddr = ((cfgRegSavePos % CFG_REGS_SLOT_RECORDS) == 0u) ? cfgRegSaveAddr : 0u;
+    #else
+    uint32_t regsToTestSize = SelfTests_ConfigReg_StoredSize();
+    cfgRegSaveAddr = (uint32_t)(CONF_REG_FIRST_ROW_ADDR);
+    cfgRegSaveRows = (regsToTestSize > CY_FLASH_SIZEOF_ROW) ? 2u : 1u;
+    eraseAddr = CONF_REG_FLASH_SMALL_SECTOR_ADDR_BASE;
+    #endif /* (CFG_REGS_JOURNAL == 1u) */
+
+    Cy_Flashc_MainWriteEnable();
+    if (eraseAddr != 0u)
+    {
+        cfgRegSaveRow = 0u;
+        ret = Cy_Flash_StartEraseSector(eraseAddr);
+    }
+    else
+    {
+        cfgRegSaveRow = 1u;
+        ret = Cy_Flash_StartProgram(cfgRegSaveAddr, flashRowData);
+        #if (CFG_REGS_JOURNAL == 1u)
+        ret = SelfTests_ConfigReg_SaveRetry(ret);
+        #endif /* (CFG_REGS_JOURNAL == 1u) */
+    }
+
+    if ((ret == CY_FLASH_DRV_SUCCESS) || (ret == CY_FLASH_DRV_OPERATION_STARTED))
+    {
+        cfgRegSaveBusy = true;
+        ret = CY_FLASH_DRV_OPERATION_STARTED;
+    }
+    else
+    {
+        Cy_Flashc_MainWriteDisable();
+    }
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_Save_StartUp_ConfigReg_Process
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function advances the save started by
+ *  SelfTests_Save_StartUp_ConfigReg_Start(). When the running Flash operation
+ *  is complete, it starts programming the next row.
+ *
+ * Parameters:
+ *  None.
+ *
+ * Return:
+ *  CY_FLASH_DRV_OPERATION_STARTED - The save is running.
+ *  CY_FLASH_DRV_SUCCESS - The save is complete, or no save is running.
+ *  Other - Starting a row program or verifying the journal record failed, the
+ *          save is stopped. A failed journal record is first retried in the
+ *          next slot.
+ *
+ ******************************************************************************/
+cy_en_flashdrv_status_t SelfTests_Save_StartUp_ConfigReg_Process(void)
+{
+    cy_en_flashdrv_status_t ret = CY_FLASH_DRV_SUCCESS;
+
+    if (cfgRegSaveBusy)
+    {
+        ret = CY_FLASH_DRV_OPERATION_STARTED;
+        if (Cy_Flash_IsOperationComplete() == CY_FLASH_DRV_SUCCESS)
+        {
+            if (cfgRegSaveRow < cfgRegSaveRows)
+            {
+                uint32_t offset = cfgRegSaveRow * CY_FLASH_SIZEOF_ROW;
+                ret = Cy_Flash_StartProgram(cfgRegSaveAddr + offset,
+                                            &flashRowData[offset / sizeof(uint32_t)]);
+                cfgRegSaveRow++;
+                #if (CFG_REGS_JOURNAL == 1u)
+                ret = SelfTests_ConfigReg_SaveRetry(ret);
+                #endif /* (CFG_REGS_JOURNAL == 1u) */
+                if (ret == CY_FLASH_DRV_SUCCESS)
+                {
+                    ret = CY_FLASH_DRV_OPERATION_STARTED;
+                }
+            }
+            else
+            {
+                ret = CY_FLASH_DRV_SUCCESS;
+                #if (CFG_REGS_JOURNAL == 1u)
+                if (memcmp((const void*)cfgRegSaveAddr, flashRowData, sizeof(flashRowData)) != 0)
+                {
+                    ret = SelfTests_ConfigReg_SaveRetry(CY_FLASH_DRV_ERR_UNC);
+                }
+                #endif /* (CFG_REGS_JOURNAL == 1u) */
+            }
+
+            if (ret != CY_FLASH_DRV_OPERATION_STARTED)
+            {
+                cfgRegSaveBusy = false;
+                Cy_Flashc_MainWriteDisable();
+            }
+        }
+    }
+    return ret;
+}
+
+
+#endif /* defined(CY_IP_MXFLASHC_VERSION_ECT) */
+
+
 #elif (STARTUP_CFG_REGS_MODE == CFG_REGS_CRC_MODE)
 /*******************************************************************************
  * Function Name: SelfTests_Check_StartUp_Cfg_CRC
@@ -782,8 +1542,40 @@ cy_en_flashdrv_status_t SelfTests_Save_StartUp_ConfigReg(void)
  ******************************************************************************/
 static uint8_t SelfTests_Check_StartUp_Cfg_CRC(uint32_t Current_CRC)
 {
-    uint8_t* regPointer;
     uint8_t  ret = ERROR_STATUS;
+
+    #if (CFG_REGS_JOURNAL == 1u)
+    uint32_t sequence = 0u;
+    uint32_t pos = SelfTests_ConfigReg_JournalLatest(&sequence);
+
+    /* A valid record takes the place of the CRC status semaphore */
+    if (pos != CFG_REGS_JOURNAL_EMPTY)
+    {
+        /* Check if an intentional error should be made for testing */
+        #if (ERROR_IN_STARTUP_CONF_REG)
+
+        /* Make an artificial error in CRC */
+        Current_CRC++;
+        #endif /* End (ERROR_IN_STARTUP_CONF_REG) */
+        if (SelfTests_ConfigReg_JournalRecord(pos)[0u] == Current_CRC)
+        {
+            ret = PASS_COMPLETE_STATUS;
+        }
+    }
+    else
+    {
+        (void)memset(flashRowData, 0x00, sizeof(flashRowData));
+        flashRowData[0u] = Current_CRC;
+        if (SelfTests_ConfigReg_JournalAppend() == CY_FLASH_DRV_SUCCESS)
+        {
+            /* Return the status that CRC is already stored */
+            ret = CRC_SAVED_STATUS;
+        }
+    }
+
+    return ret;
+    #else /* (CFG_REGS_JOURNAL == 1u) */
+    uint8_t* regPointer;
     cy_en_flashdrv_status_t status;
 
     /* The pointer to Flash base */
@@ -862,6 +1654,7 @@ static uint8_t SelfTests_Check_StartUp_Cfg_CRC(uint32_t Current_CRC)
     }
 
     return ret;
+    #endif /* (CFG_REGS_JOURNAL == 1u) */
 }
 
 
@@ -888,16 +1681,20 @@ static uint8_t SelfTests_Check_StartUp_Cfg_CRC(uint32_t Current_CRC)
 uint8_t SelfTests_StartUp_ConfigReg(void)
 {
     #if (STARTUP_CFG_REGS_MODE == CFG_REGS_TO_FLASH_MODE)
-    uint32_t* cfgRegPointer;
+    const uint32_t* cfgRegPointer;
     uint8_t ret = OK_STATUS;
     uint32_t tmp;
 
     /* Set the base address to Flash where configuration registers are stored */
-    cfgRegPointer = (uint32_t*)(CONF_REG_FIRST_ROW_ADDR);
+    cfgRegPointer = SelfTests_ConfigReg_Stored();
+    if (cfgRegPointer == NULL)
+    {
+        return ERROR_STATUS;
+    }
 
     /* Compare the register values with the saved values */
     uint32_t i = 0u;
-    while (((i < (sizeof(regs32_ToTest) / sizeof(regs32_ToTest[0u]))) && (ret == OK_STATUS)))
+    while (((i < CFG_REGS_COUNT) && (ret == OK_STATUS)))
     {
         tmp = cfgRegPointer[i];
 
@@ -908,7 +1705,7 @@ uint8_t SelfTests_StartUp_ConfigReg(void)
         tmp++;
         #endif /* End (ERROR_IN_STARTUP_CONF_REG) */
 
-        if (tmp != CY_GET_REG32(regs32_ToTest[i]))
+        if (tmp != SelfTests_ConfigReg_Read(i))
         {
             ret = ERROR_STATUS;
         }
@@ -918,6 +1715,49 @@ uint8_t SelfTests_StartUp_ConfigReg(void)
     /* Return the OK status if no error detected */
     return ret;
 
+    #elif (STARTUP_CFG_REGS_MODE == CFG_REGS_HYBRID_MODE)
+    const uint32_t* cfgRegPointer;
+    uint8_t ret = ERROR_STATUS;
+    uint32_t calculated_CRC;
+    uint32_t count;
+
+    #if defined(CY_IP_MXFLASHC_VERSION_ECT)
+    /* The stored record is rewritten by the running non-blocking save */
+    if (cfgRegSaveBusy)
+    {
+        return ERROR_STATUS;
+    }
+    #endif /* defined(CY_IP_MXFLASHC_VERSION_ECT) */
+
+    /* Set the base address to Flash where the CRC and the volatile fields are stored */
+    cfgRegPointer = SelfTests_ConfigReg_Stored();
+    if (cfgRegPointer == NULL)
+    {
+        return ERROR_STATUS;
+    }
+
+    /* One pass over the registers, without the volatile fields of the last save */
+    count = cfgRegPointer[CFG_REGS_HYBRID_COUNT];
+    if (count <= CFG_REGS_VOLATILE_MAX_COUNT)
+    {
+        calculated_CRC = SelfTests_ConfigReg_SetCrc(&cfgRegPointer[CFG_REGS_HYBRID_FIELDS],
+                                                    count);
+
+        /* Check if an intentional error should be made for testing */
+        #if (ERROR_IN_STARTUP_CONF_REG)
+
+        /* Make an artificial error in CRC */
+        calculated_CRC++;
+        #endif /* End (ERROR_IN_STARTUP_CONF_REG) */
+
+        if (calculated_CRC == cfgRegPointer[CFG_REGS_HYBRID_CRC])
+        {
+            ret = OK_STATUS;
+        }
+    }
+
+    return ret;
+
     #elif (STARTUP_CFG_REGS_MODE == CFG_REGS_CRC_MODE)
     uint32_t calculated_CRC;
 
@@ -925,15 +1765,13 @@ uint8_t SelfTests_StartUp_ConfigReg(void)
     (void)memset(flashRowData, 0x00, sizeof(flashRowData));
 
     /* Store the 32Bit registers */
-    for (uint32_t i = 0u; i < (sizeof(regs32_ToTest) / sizeof(regs32_ToTest[0u])); i++)
+    for (uint32_t i = 0u; i < CFG_REGS_COUNT; i++)
     {
-        flashRowData[i] = CY_GET_REG32(regs32_ToTest[i]);
+        flashRowData[i] = SelfTests_ConfigReg_Read(i);
     }
 
     /* Calculate CRC of Start Up registers */
-    calculated_CRC =
-        SelfTests_CRC32((uint32_t)flashRowData,
-                        (sizeof(regs32_ToTest) / sizeof(regs32_ToTest[0u])));
+    calculated_CRC = SelfTests_CRC32((uint32_t)flashRowData, CFG_REGS_COUNT * sizeof(uint32_t));
 
     /* Compare the calculated CRC with the previously saved and return the status of matches */
     return SelfTests_Check_StartUp_Cfg_CRC(calculated_CRC);
@@ -941,4 +1779,228 @@ uint8_t SelfTests_StartUp_ConfigReg(void)
 }
 
 
+/* Runtime monitor: golden register value and checked bits per register */
+#define CFG_REGS_MON_VALUE      (0u)
+#define CFG_REGS_MON_MASK       (1u)
+static uint32_t cfgRegMonGolden[CFG_REGS_MAX_COUNT][2u];
+
+/* The number of registers in the golden image */
+static uint32_t cfgRegMonCount = 0u;
+
+/* Set when SelfTests_ConfigReg_Monitor_Init() has taken the golden image */
+static bool cfgRegMonInitialized = false;
+
+/* CRC of the golden image, taken by SelfTests_ConfigReg_Monitor_Init() */
+static uint32_t cfgRegMonCrc = 0u;
+
+/* The next register to check and the CRC of the golden image up to it */
+static uint32_t cfgRegMonIndex = 0u;
+static uint32_t cfgRegMonRunCrc = 0u;
+
+/* The divergence found by the last failed check */
+static stl_cfg_reg_fault_t cfgRegMonFault = { CFG_REGS_NO_FAILED_INDEX, 0u, 0u, 0u, 0u };
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_ConfigReg_Monitor_Init
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function takes the golden image of the tested registers and restarts
+ *  the runtime monitor.
+ *
+ * Parameters:
+ *  const stl_cfg_reg_field_t* fields - The table of volatile fields.
+ *  uint32_t count - The number of entries.
+ *
+ * Return:
+ *  None.
+ *
+ ******************************************************************************/
+void SelfTests_ConfigReg_Monitor_Init(const stl_cfg_reg_field_t* fields, uint32_t count)
+{
+    cfgRegMonInitialized = false;
+    cfgRegMonCount = CFG_REGS_COUNT;
+    for (uint32_t i = 0u; i < cfgRegMonCount; i++)
+    {
+        cfgRegMonGolden[i][CFG_REGS_MON_MASK] = SelfTests_ConfigReg_Entry(i).mask;
+    }
+
+    if (fields != NULL)
+    {
+        for (uint32_t i = 0u; i < count; i++)
+        {
+            if (fields[i].index < cfgRegMonCount)
+            {
+                cfgRegMonGolden[fields[i].index][CFG_REGS_MON_MASK] &= ~fields[i].mask;
+            }
+        }
+    }
+
+    for (uint32_t i = 0u; i < cfgRegMonCount; i++)
+    {
+        cfgRegMonGolden[i][CFG_REGS_MON_VALUE] =
+            SelfTests_ConfigReg_Read(i) & cfgRegMonGolden[i][CFG_REGS_MON_MASK];
+    }
+
+    cfgRegMonCrc = SelfTests_CRC32_IEEE((uint32_t)cfgRegMonGolden,
+                                        cfgRegMonCount * sizeof(cfgRegMonGolden[0u]));
+    cfgRegMonIndex = 0u;
+    cfgRegMonRunCrc = 0u;
+    cfgRegMonFault.index = CFG_REGS_NO_FAILED_INDEX;
+    cfgRegMonInitialized = true;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_ConfigReg_Monitor_GoldenFault
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function records a corrupted golden image as the fault.
+ *
+ * Parameters:
+ *  uint32_t actualCrc - The CRC calculated over the golden image.
+ *
+ * Return:
+ *  None.
+ *
+ ******************************************************************************/
+static void SelfTests_ConfigReg_Monitor_GoldenFault(uint32_t actualCrc)
+{
+    cfgRegMonFault.index = cfgRegMonCount;
+    cfgRegMonFault.address = 0u;
+    cfgRegMonFault.expected = cfgRegMonCrc;
+    cfgRegMonFault.actual = actualCrc;
+    cfgRegMonFault.diff = actualCrc ^ cfgRegMonCrc;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_ConfigReg_Monitor
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function compares the next "regsToTest" registers with the golden
+ *  image, and checks the golden image CRC after the last register. On a
+ *  mismatch, the whole golden image is checked first, so a corrupted golden
+ *  entry is not reported as a diverged register.
+ *
+ * Parameters:
+ *  uint32_t regsToTest - The number of registers to check in this call.
+ *
+ * Return:
+ *  PASS_STILL_TESTING_STATUS - No divergence, the round is not complete.
+ *  PASS_COMPLETE_STATUS - No divergence, the round is complete.
+ *  ERROR_STATUS - A register diverged, the golden image is corrupted, or
+ *  SelfTests_ConfigReg_Monitor_Init() has not been called.
+ *
+ ******************************************************************************/
+uint8_t SelfTests_ConfigReg_Monitor(uint32_t regsToTest)
+{
+    uint8_t ret = PASS_STILL_TESTING_STATUS;
+    uint32_t expected;
+    uint32_t actual;
+    uint32_t goldenCrc;
+    uint32_t n = 0u;
+
+    /* There is no golden image to compare with */
+    if (cfgRegMonInitialized == false)
+    {
+        cfgRegMonFault.index = CFG_REGS_NO_FAILED_INDEX;
+        cfgRegMonFault.address = 0u;
+        cfgRegMonFault.expected = 0u;
+        cfgRegMonFault.actual = 0u;
+        cfgRegMonFault.diff = 0u;
+        ret = ERROR_STATUS;
+    }
+
+    while ((n < regsToTest) && (cfgRegMonIndex < cfgRegMonCount) &&
+           (ret == PASS_STILL_TESTING_STATUS))
+    {
+        expected = cfgRegMonGolden[cfgRegMonIndex][CFG_REGS_MON_VALUE];
+        actual = SelfTests_ConfigReg_Read(cfgRegMonIndex) &
+                 cfgRegMonGolden[cfgRegMonIndex][CFG_REGS_MON_MASK];
+
+        /* Check if an intentional error should be made for testing */
+        #if (ERROR_IN_CONF_REG_MONITOR)
+
+        /* Make an artificial error in the configuration register */
+        actual = ~actual & cfgRegMonGolden[cfgRegMonIndex][CFG_REGS_MON_MASK];
+        #endif /* End (ERROR_IN_CONF_REG_MONITOR) */
+
+        if (actual != expected)
+        {
+            /* The golden entry itself may be corrupted */
+            goldenCrc = SelfTests_CRC32_IEEE((uint32_t)cfgRegMonGolden,
+                                             cfgRegMonCount * sizeof(cfgRegMonGolden[0u]));
+            if (goldenCrc != cfgRegMonCrc)
+            {
+                SelfTests_ConfigReg_Monitor_GoldenFault(goldenCrc);
+            }
+            else
+            {
+                cfgRegMonFault.index = cfgRegMonIndex;
+                cfgRegMonFault.address =
+                    (uint32_t)SelfTests_ConfigReg_Entry(cfgRegMonIndex).address;
+                cfgRegMonFault.expected = expected;
+                cfgRegMonFault.actual = actual;
+                cfgRegMonFault.diff = actual ^ expected;
+            }
+            ret = ERROR_STATUS;
+        }
+        else
+        {
+            cfgRegMonRunCrc = SelfTests_CRC32_IEEE_ACC(cfgRegMonRunCrc,
+                                                       (uint32_t)cfgRegMonGolden[cfgRegMonIndex],
+                                                       sizeof(cfgRegMonGolden[0u]));
+            cfgRegMonIndex++;
+            n++;
+        }
+    }
+
+    if ((ret == PASS_STILL_TESTING_STATUS) && (cfgRegMonIndex >= cfgRegMonCount))
+    {
+        if (cfgRegMonRunCrc == cfgRegMonCrc)
+        {
+            ret = PASS_COMPLETE_STATUS;
+        }
+        else
+        {
+            SelfTests_ConfigReg_Monitor_GoldenFault(cfgRegMonRunCrc);
+            ret = ERROR_STATUS;
+        }
+    }
+
+    if (ret != PASS_STILL_TESTING_STATUS)
+    {
+        /* Start a new round */
+        cfgRegMonIndex = 0u;
+        cfgRegMonRunCrc = 0u;
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: SelfTests_ConfigReg_Monitor_GetFault
+ *******************************************************************************
+ *
+ * Summary:
+ *  This function returns the divergence found by the last failed check.
+ *
+ * Parameters:
+ *  stl_cfg_reg_fault_t* fault - The structure to fill.
+ *
+ * Return:
+ *  None.
+ *
+ ******************************************************************************/
+void SelfTests_ConfigReg_Monitor_GetFault(stl_cfg_reg_fault_t* fault)
+{
+    *fault = cfgRegMonFault;
+}
+
+
 /* [] END OF FILE */
@@ -54,9 +54,99 @@
  *      2) Compare the calculated CRC with the CRC previously stored in Flash if the CRC status
  *         semaphore is set. If the status semaphore is not set, the CRC must be calculated and
  *         stored in Flash, and the status semaphore must be set.
+ *      3) Hybrid mode: store only a CRC32 of the register set and a small table of volatile
+ *         fields, the bits that change legitimately, see
+ *         \ref SelfTests_ConfigReg_SetVolatileFields. The check reads the registers in one pass,
+ *         clears the stored volatile fields, and compares their CRC with the single stored CRC
+ *         word. The stored record does not depend on the number of registers, but a mismatch
+ *         does not identify the register; the runtime monitor reports it, see
+ *         \ref SelfTests_ConfigReg_Monitor_GetFault.
+ *
+ * By default, the duplicates or the CRC are written to the same Flash row on every save, and a
+ * power loss during the write leaves no valid copy. With \ref CFG_REGS_JOURNAL, each save
+ * appends a record to a journal of two slots at \ref CFG_REGS_JOURNAL_ADDR, which must be
+ * reserved in the linker script. Each record carries a sequence number and a CRC; the check uses
+ * the valid record with the highest sequence number. A new record never overwrites the latest
+ * one, so the previous record stays valid until the new one is complete. The writes rotate over
+ * all records of both slots, and on devices with sector erase, a slot is erased only when the
+ * journal moves into it. On these devices a record is only programmed when it is blank; if it is
+ * not, for example after a power loss while it was programmed, or if programming or verifying it
+ * fails, the journal moves to the next slot and erases it.
+ *
+ * On PSOC 4 and PSOC 6, the journal occupies the rows in front of the last Flash row, inside the
+ * range [CY_FLASH_BASE, FLASH_END_ADDR) of the Flash test. End the Flash test range at
+ * \ref CFG_REGS_JOURNAL_FLASH_END_ADDR, and compute the reference checksum over the same range,
+ * for example with the "-e" option of the stl_flash_checksum tool:
+ * \code
+ * SelfTest_Flash_init(CY_FLASH_BASE, CFG_REGS_JOURNAL_FLASH_END_ADDR, flash_StoredCheckSum);
+ * \endcode
+ *
+ * On XMC7 and XMC5, \ref SelfTests_Save_StartUp_ConfigReg blocks while the sector is erased and
+ * the rows are programmed. \ref SelfTests_Save_StartUp_ConfigReg_Start and
+ * \ref SelfTests_Save_StartUp_ConfigReg_Process perform the same save without waiting, so a
+ * save does not delay the boot path:
+ * \code
+ * if (SelfTests_Save_StartUp_ConfigReg_Start() == CY_FLASH_DRV_OPERATION_STARTED)
+ * {
+ *     while (SelfTests_Save_StartUp_ConfigReg_Process() == CY_FLASH_DRV_OPERATION_STARTED)
+ *     {
+ *         // Continue with the application initialization
+ *     }
+ * }
+ * \endcode
+ *
+ * The default table of tested registers depends on the device. The application adds its own
+ * registers with \ref SelfTests_ConfigReg_Register, each with the mask of the checked bits. The
+ * added registers follow the default registers, and the save, compare, and monitor functions
+ * iterate the merged table. Call \ref SelfTests_ConfigReg_Register before
+ * \ref SelfTests_Save_StartUp_ConfigReg and \ref SelfTests_ConfigReg_Monitor_Init.
+ * \code
+ * static const stl_cfg_reg_t appRegs[] =
+ * {
+ *     { &(TCPWM0->GRP[0].CNT[0].CTRL), 0xFFFFFFFFUL },
+ *     { &(TCPWM0->GRP[0].CNT[0].PERIOD), 0x0000FFFFUL },
+ * };
+ * uint32_t firstAppIndex = SelfTests_ConfigReg_GetCount();
+ *
+ * if (SelfTests_ConfigReg_Register(appRegs, 2u) != OK_STATUS)
+ * {
+ *     // Too many registers, see CFG_REGS_USER_MAX_COUNT
+ * }
+ * \endcode
+ *
+ * With the GCC toolchain, registers can also be collected from several source files with
+ * \ref STL_CFG_REG_ENTRY when \ref CFG_REGS_USER_SECTION is set. The linker places these entries
+ * in the "stl_cfg_regs" section, and \ref SelfTests_ConfigReg_Register adds them in front of
+ * the registers passed as parameters.
+ *
+ * The startup test is independent of the runtime monitor. The monitor keeps a golden image of
+ * the tested registers in RAM, taken by \ref SelfTests_ConfigReg_Monitor_Init after the
+ * application has configured the device. Each \ref SelfTests_ConfigReg_Monitor call compares a
+ * bounded number of registers with the golden image in round-robin order, ignoring the volatile
+ * fields given at initialization. The golden image is protected by a CRC, which is accumulated
+ * during the scan and checked at the end of each round. On a mismatch, the CRC of the whole
+ * golden image is checked first: if it is corrupted, the fault index is the number of
+ * registers; otherwise \ref SelfTests_ConfigReg_Monitor_GetFault reports the register and the
+ * bits that diverged.
+ * After an intended change of the configuration, call \ref SelfTests_ConfigReg_Monitor_Init
+ * again.
+ *
+ * \code
+ * static const stl_cfg_reg_field_t volatileFields[] = { {0u, 0x80000000UL} };
+ * stl_cfg_reg_fault_t fault;
+ *
+ * SelfTests_ConfigReg_Monitor_Init(volatileFields, 1u);
+ * ...
+ * if (SelfTests_ConfigReg_Monitor(CFG_REGS_MONITOR_REGS_PER_CALL) == ERROR_STATUS)
+ * {
+ *     SelfTests_ConfigReg_Monitor_GetFault(&fault);
+ *     // Process error: fault.index, fault.address and fault.diff identify the divergence
+ * }
+ * \endcode
  *
  *
  * \defgroup group_regs_macros Macros
+ * \defgroup group_regs_data_structures Data Structures
  * \defgroup group_regs_functions Functions
  */
 
@@ -78,10 +168,33 @@
 #define CFG_REGS_TO_FLASH_MODE           (1u)
 /** Calculates the registers CRC and stores to Flash; recalculates CRC and compares with the saved CRC. */
 #define CFG_REGS_CRC_MODE                (0u)
+/** Stores the CRC of the registers and the table of volatile fields to Flash; recalculates the CRC
+ *  without the volatile fields and compares it with the saved CRC. */
+#define CFG_REGS_HYBRID_MODE             (2u)
 
-/** Select which mode to use (CFG_REGS_TO_FLASH_MODE or CFG_REGS_CRC_MODE) */
+/** Select which mode to use (CFG_REGS_TO_FLASH_MODE, CFG_REGS_CRC_MODE or CFG_REGS_HYBRID_MODE) */
 #define STARTUP_CFG_REGS_MODE            CFG_REGS_TO_FLASH_MODE
 
+/** \ref SelfTests_Save_StartUp_ConfigReg stores the register duplicates or the hybrid record in
+ *  Flash (CFG_REGS_TO_FLASH_MODE or CFG_REGS_HYBRID_MODE) */
+#define CFG_REGS_FLASH_COPY              ((STARTUP_CFG_REGS_MODE == CFG_REGS_TO_FLASH_MODE) || \
+                                          (STARTUP_CFG_REGS_MODE == CFG_REGS_HYBRID_MODE))
+
+/** \ref stl_cfg_reg_fault_t index when no register failed */
+#define CFG_REGS_NO_FAILED_INDEX         (0xFFFFFFFFUL)
+
+/** The maximum number of application registers added to the default table */
+#define CFG_REGS_USER_MAX_COUNT          (8u)
+
+/** The maximum number of volatile fields stored with the CRC in CFG_REGS_HYBRID_MODE */
+#define CFG_REGS_VOLATILE_MAX_COUNT      (8u)
+
+/** Collect application registers from the "stl_cfg_regs" linker section (GCC only) */
+#define CFG_REGS_USER_SECTION            (0u)
+
+/** The default number of registers checked by one \ref SelfTests_ConfigReg_Monitor call */
+#define CFG_REGS_MONITOR_REGS_PER_CALL   (4u)
+
 
 #if (STARTUP_CFG_REGS_MODE == CFG_REGS_CRC_MODE)
 
@@ -153,7 +266,78 @@
 #endif /* defined(SELFTEST_XMC7X_FAMILY) */
 #endif /* (STARTUP_CFG_REGS_MODE == CFG_REGS_CRC_MODE) */
 
+/** Stores the register duplicates or the CRC in a journal of two Flash slots instead of
+ *  rewriting one Flash row */
+#define CFG_REGS_JOURNAL                 (0u)
+
+#if (CFG_REGS_JOURNAL == 1u)
+#if defined(SELFTEST_XMC7X_FAMILY) || defined(SELFTEST_XMC5X_FAMILY)
+/** The size of one journal slot, equal to the size of one small sector of Code Flash */
+    #define CFG_REGS_JOURNAL_SLOT_SIZE   (0x2000UL)
+/** The start address of the journal, the first two small sectors of Code Flash */
+    #define CFG_REGS_JOURNAL_ADDR        (CY_FLASH_SM_SBM_BASE)
+/** The value of an erased Code Flash word. A journal record that holds other values is not
+ *  programmed again, the journal continues in the next slot instead */
+    #define CFG_REGS_JOURNAL_ERASED_VALUE (0xFFFFFFFFUL)
+#else
+/** The size of one journal slot, four Flash rows */
+    #define CFG_REGS_JOURNAL_SLOT_SIZE   (4u * CY_FLASH_SIZEOF_ROW)
+/** The start address of the journal, the rows before the last Flash row, which holds the Flash
+ *  checksum */
+    #define CFG_REGS_JOURNAL_ADDR        \
+    (CY_FLASH_BASE + CY_FLASH_SIZE - CY_FLASH_SIZEOF_ROW - (2u * CFG_REGS_JOURNAL_SLOT_SIZE))
+#if defined(SELFTEST_PSOC4_FAMILY) || defined(SELFTEST_PSOC6_FAMILY)
+/** The end address of the Flash test range without the journal, which is rewritten at run time.
+ *  Use it instead of FLASH_END_ADDR for \ref SelfTest_Flash_init and the reference checksum */
+    #define CFG_REGS_JOURNAL_FLASH_END_ADDR (CFG_REGS_JOURNAL_ADDR)
+#endif /* defined(SELFTEST_PSOC4_FAMILY) || defined(SELFTEST_PSOC6_FAMILY) */
+#endif /* defined(SELFTEST_XMC7X_FAMILY) || defined(SELFTEST_XMC5X_FAMILY) */
+#endif /* End (CFG_REGS_JOURNAL == 1u) */
+
+/** \} group_regs_macros */
+
+/**
+ * \addtogroup group_regs_data_structures
+ * \{
+ */
+
+/** Application register added to the default table */
+typedef struct
+{
+    volatile uint32_t* address;     /**< Address of the register */
+    uint32_t mask;                  /**< Checked bits of the register */
+} stl_cfg_reg_t;
+
+/** Register bits that change legitimately and are excluded from the check */
+typedef struct
+{
+    uint32_t index;     /**< Index of the register in the table of tested registers */
+    uint32_t mask;      /**< Volatile bits of the register */
+} stl_cfg_reg_field_t;
+
+/** Divergence found by the runtime monitor, see \ref SelfTests_ConfigReg_Monitor_GetFault */
+typedef struct
+{
+    uint32_t index;     /**< Index of the register, the number of registers if the golden image is
+                             corrupted, or \ref CFG_REGS_NO_FAILED_INDEX if no error was found */
+    uint32_t address;   /**< Address of the register, 0 if the golden image is corrupted */
+    uint32_t expected;  /**< Golden value of the checked bits */
+    uint32_t actual;    /**< Register value of the checked bits */
+    uint32_t diff;      /**< Bits that diverged */
+} stl_cfg_reg_fault_t;
+
+/** \} group_regs_data_structures */
+
+#if (CFG_REGS_USER_SECTION == 1u)
+/** \addtogroup group_regs_macros
+ * \{
+ */
+/** Places an application register in the "stl_cfg_regs" linker section */
+#define STL_CFG_REG_ENTRY(name, reg, checkMask) \
+    static const stl_cfg_reg_t name __attribute__((used, section("stl_cfg_regs"))) = \
+    { &(reg), (checkMask) }
 /** \} group_regs_macros */
+#endif /* End (CFG_REGS_USER_SECTION == 1u) */
 
 
 /***************************************
@@ -174,7 +358,8 @@
 *
 * \return
 *  0 - Test Passed <br>
-*  1 - Test failed
+*  1 - Test failed. In CFG_REGS_HYBRID_MODE, also while a save started by
+*  \ref SelfTests_Save_StartUp_ConfigReg_Start is running.
 *
 *******************************************************************************/
 uint8_t SelfTests_StartUp_ConfigReg(void);
@@ -212,24 +397,200 @@ void SelfTests_Init_StartUp_ConfigReg(void);
 *
 *
 *  This function stores the configuration registers to the FlashRowData array and writes this array to
-*  Flash.
+*  Flash. In CFG_REGS_HYBRID_MODE, the CRC of the registers and the volatile fields are stored
+*  instead.
 *
 *
 * \note
-* Used only if the STARTUP_CFG_REGS_MODE == CFG_REGS_TO_FLASH_MODE. <br>
+* Used only if CFG_REGS_FLASH_COPY is set. <br>
 * This function must be called once after the initial PSOC power up and initialization before
 * entering the main program.
 *
 * \return
 *  0 - Writing to Flash is successful. <br>
 *  >=1 - Writing to Flash is not successful. Refer to the Flash Driver PDL documentation
-*  for error codes.
+*  for error codes. CY_FLASH_DRV_OPCODE_BUSY while a save started by
+*  \ref SelfTests_Save_StartUp_ConfigReg_Start is running.
 *
 *
 *******************************************************************************/
-#if (STARTUP_CFG_REGS_MODE == CFG_REGS_TO_FLASH_MODE)
+#if CFG_REGS_FLASH_COPY
 cy_en_flashdrv_status_t SelfTests_Save_StartUp_ConfigReg(void);
-#endif /* End (STARTUP_CFG_REGS_MODE == CFG_REGS_TO_FLASH_MODE) */
+
+#if defined(CY_IP_MXFLASHC_VERSION_ECT)
+
+/*******************************************************************************
+* Function Name: SelfTests_Save_StartUp_ConfigReg_Start
+****************************************************************************//**
+*
+* This function stores the configuration registers to the FlashRowData array and starts the
+* sector erase or the first row program without waiting for it. Call
+* \ref SelfTests_Save_StartUp_ConfigReg_Process until it returns CY_FLASH_DRV_SUCCESS. Do not
+* call other functions of the configuration register test while the save is running.
+*
+* \note
+* Used only if CFG_REGS_FLASH_COPY is set, on devices with the XMC7/XMC5 Flash controller.
+*
+* \return
+*  CY_FLASH_DRV_OPERATION_STARTED - The save is running. <br>
+*  CY_FLASH_DRV_OPCODE_BUSY       - A save is already running. <br>
+*  Other                          - Starting the Flash operation failed. Refer to the Flash
+*  Driver PDL documentation for error codes.
+*
+*
+*******************************************************************************/
+cy_en_flashdrv_status_t SelfTests_Save_StartUp_ConfigReg_Start(void);
+
+/*******************************************************************************
+* Function Name: SelfTests_Save_StartUp_ConfigReg_Process
+****************************************************************************//**
+*
+* This function advances the save started by \ref SelfTests_Save_StartUp_ConfigReg_Start. When the
+* running Flash operation is complete, it starts programming the next row and returns. Call it
+* periodically from the main loop, or from the Flash operation complete interrupt.
+*
+* \note
+* Used only if CFG_REGS_FLASH_COPY is set, on devices with the XMC7/XMC5 Flash controller.
+*
+* \return
+*  CY_FLASH_DRV_OPERATION_STARTED - The save is running. <br>
+*  CY_FLASH_DRV_SUCCESS           - The save is complete, or no save is running. <br>
+*  Other                          - Starting a row program or verifying the journal record
+*                                   failed, and the save is stopped. As with
+*                                   \ref SelfTests_Save_StartUp_ConfigReg, a failed journal
+*                                   record is first retried in the next slot.
+*
+*
+*******************************************************************************/
+cy_en_flashdrv_status_t SelfTests_Save_StartUp_ConfigReg_Process(void);
+#endif /* defined(CY_IP_MXFLASHC_VERSION_ECT) */
+#endif /* End CFG_REGS_FLASH_COPY */
+
+#if (STARTUP_CFG_REGS_MODE == CFG_REGS_HYBRID_MODE)
+
+/*******************************************************************************
+* Function Name: SelfTests_ConfigReg_SetVolatileFields
+****************************************************************************//**
+*
+* This function sets the table of volatile register fields, which are excluded from the CRC.
+* \ref SelfTests_Save_StartUp_ConfigReg stores the table with the CRC, and
+* \ref SelfTests_StartUp_ConfigReg uses the stored table, so the function need not be called
+* again before the check. The table must stay valid until the save.
+*
+* \note
+* Used only if the STARTUP_CFG_REGS_MODE == CFG_REGS_HYBRID_MODE.
+*
+* \param fields
+* The table of volatile fields, one entry per register with volatile bits. NULL for none.
+*
+* \param count
+* The number of entries.
+*
+* \return
+*  OK_STATUS    - The table is set. <br>
+*  ERROR_STATUS - More than \ref CFG_REGS_VOLATILE_MAX_COUNT entries. The table is not changed.
+*
+*
+*******************************************************************************/
+uint8_t SelfTests_ConfigReg_SetVolatileFields(const stl_cfg_reg_field_t* fields, uint32_t count);
+#endif /* End (STARTUP_CFG_REGS_MODE == CFG_REGS_HYBRID_MODE) */
+
+/*******************************************************************************
+* Function Name: SelfTests_ConfigReg_Register
+****************************************************************************//**
+*
+* This function adds the application registers to the default table of tested registers. With
+* \ref CFG_REGS_USER_SECTION, the entries of the "stl_cfg_regs" linker section are added first.
+* A new call replaces the application registers of the previous call.
+*
+* \param regs
+* The table of application registers, NULL for none. The table must stay valid while the tests
+* are used.
+*
+* \param count
+* The number of entries.
+*
+* \return
+*  OK_STATUS    - The registers are added. <br>
+*  ERROR_STATUS - More than \ref CFG_REGS_USER_MAX_COUNT application registers, or the merged
+*                 table does not fit in the Flash storage. The table is not changed.
+*
+*
+*******************************************************************************/
+uint8_t SelfTests_ConfigReg_Register(const stl_cfg_reg_t* regs, uint32_t count);
+
+/*******************************************************************************
+* Function Name: SelfTests_ConfigReg_GetCount
+****************************************************************************//**
+*
+* This function returns the number of tested registers. Before
+* \ref SelfTests_ConfigReg_Register is called, this is the number of default registers, which is
+* the index of the first application register.
+*
+* \return
+* The number of registers in the merged table.
+*
+*
+*******************************************************************************/
+uint32_t SelfTests_ConfigReg_GetCount(void);
+
+/*******************************************************************************
+* Function Name: SelfTests_ConfigReg_Monitor_Init
+****************************************************************************//**
+*
+* This function takes the golden image of the tested registers for the runtime monitor and
+* restarts the scan. Call it after the application has configured the device, and again after
+* every intended configuration change.
+*
+* \param fields
+* The table of volatile fields, which are excluded from the compare. NULL for none. The table is
+* copied into the golden image and need not stay valid.
+*
+* \param count
+* The number of entries.
+*
+*
+*******************************************************************************/
+void SelfTests_ConfigReg_Monitor_Init(const stl_cfg_reg_field_t* fields, uint32_t count);
+
+/*******************************************************************************
+* Function Name: SelfTests_ConfigReg_Monitor
+****************************************************************************//**
+*
+* This function compares the next "regsToTest" registers with the golden image. The scan
+* continues where the previous call stopped and wraps around after the last register.
+*
+* \param regsToTest
+* The number of registers to check in this call, for example
+* \ref CFG_REGS_MONITOR_REGS_PER_CALL.
+*
+* \return
+*  PASS_STILL_TESTING_STATUS - No divergence, the round is not complete. <br>
+*  PASS_COMPLETE_STATUS      - No divergence, the round is complete and the golden image CRC
+*                              is correct. <br>
+*  ERROR_STATUS              - A register diverged or the golden image is corrupted, see
+*                              \ref SelfTests_ConfigReg_Monitor_GetFault. The next call starts a
+*                              new round. Also returned, with the fault index
+*                              \ref CFG_REGS_NO_FAILED_INDEX, until
+*                              \ref SelfTests_ConfigReg_Monitor_Init has been called.
+*
+*
+*******************************************************************************/
+uint8_t SelfTests_ConfigReg_Monitor(uint32_t regsToTest);
+
+/*******************************************************************************
+* Function Name: SelfTests_ConfigReg_Monitor_GetFault
+****************************************************************************//**
+*
+* This function returns the divergence found by the last \ref SelfTests_ConfigReg_Monitor call
+* that returned ERROR_STATUS.
+*
+* \param fault
+* The structure to fill.
+*
+*
+*******************************************************************************/
+void SelfTests_ConfigReg_Monitor_GetFault(stl_cfg_reg_fault_t* fault);
 /** \} group_regs_functions */
 
 /** \} group_regs */
@@ -162,9 +162,6 @@ static void UART_MessageTxInt(uint32_t IntMask)
 
             /* Next state */
             UART_Master_Struct.tstatus = UM_SEND_ADDR;
-
-            /* Reset TX crc*/
-            UART_Master_Struct.tcrc = 0u;
             break;
 
         case UM_SEND_ADDR:
@@ -178,9 +175,6 @@ static void UART_MessageTxInt(uint32_t IntMask)
                                       (uint32_t)UART_Master_Struct.address + 1u);
 
                 UART_Master_Struct.tstatus = UM_SEND_DL;
-                UART_Master_Struct.tcrc =
-                    SelfTests_CRC16_CCITT_Byte(UART_Master_Struct.tcrc,
-                                               UART_Master_Struct.address + 1u);
             }
             else
             {
@@ -190,8 +184,6 @@ static void UART_MessageTxInt(uint32_t IntMask)
                     /* Change the procedure */
                     UART_Master_Struct.tescflg = 1u;
                     (void)Cy_SCB_UART_Put(UART_Master_Struct.scb_base, ESC);
-
-                    UART_Master_Struct.tcrc = SelfTests_CRC16_CCITT_Byte(UART_Master_Struct.tcrc, ESC);
                 }
                 else
                 {
@@ -199,9 +191,6 @@ static void UART_MessageTxInt(uint32_t IntMask)
                     (void)Cy_SCB_UART_Put(UART_Master_Struct.scb_base,
                                           (uint32_t)UART_Master_Struct.address);
                     UART_Master_Struct.tstatus = UM_SEND_DL;
-                    UART_Master_Struct.tcrc =
-                        SelfTests_CRC16_CCITT_Byte(UART_Master_Struct.tcrc,
-                                                   UART_Master_Struct.address);
                 }
             }
             break;
@@ -217,9 +206,6 @@ static void UART_MessageTxInt(uint32_t IntMask)
                                       (uint32_t)UART_Master_Struct.txcnt + 1u);
 
                 UART_Master_Struct.tstatus = UM_SEND_DATA;
-                UART_Master_Struct.tcrc =
-                    SelfTests_CRC16_CCITT_Byte(UART_Master_Struct.tcrc,
-                                               UART_Master_Struct.txcnt + 1u);
             }
             else
             {
@@ -229,8 +215,6 @@ static void UART_MessageTxInt(uint32_t IntMask)
                     /* Change the procedure */
                     UART_Master_Struct.tescflg = 1u;
                     (void)Cy_SCB_UART_Put(UART_Master_Struct.scb_base, ESC);
-                    UART_Master_Struct.tcrc = SelfTests_CRC16_CCITT_Byte(UART_Master_Struct.tcrc,
-                                                                         ESC);
                 }
                 else
                 {
@@ -239,9 +223,6 @@ static void UART_MessageTxInt(uint32_t IntMask)
                                           (uint32_t)UART_Master_Struct.txcnt);
 
                     UART_Master_Struct.tstatus = UM_SEND_DATA;
-                    UART_Master_Struct.tcrc =
-                        SelfTests_CRC16_CCITT_Byte(UART_Master_Struct.tcrc,
-                                                   UART_Master_Struct.txcnt);
                 }
             }
             break;
@@ -255,9 +236,6 @@ static void UART_MessageTxInt(uint32_t IntMask)
                 UART_Master_Struct.tescflg = 0u;
                 (void)Cy_SCB_UART_Put(UART_Master_Struct.scb_base,
                                       (uint32_t)(*UART_Master_Struct.txptr) + 1u);
-                UART_Master_Struct.tcrc =
-                    SelfTests_CRC16_CCITT_Byte(UART_Master_Struct.tcrc,
-                                               *UART_Master_Struct.txptr + 1u);
 
                 UART_Master_Struct.txptr++;
                 UART_Master_Struct.txcnt--;
@@ -270,17 +248,12 @@ static void UART_MessageTxInt(uint32_t IntMask)
                     /* Change the procedure */
                     UART_Master_Struct.tescflg = 1u;
                     (void)Cy_SCB_UART_Put(UART_Master_Struct.scb_base, ESC);
-                    UART_Master_Struct.tcrc = SelfTests_CRC16_CCITT_Byte(UART_Master_Struct.tcrc,
-                                                                         ESC);
                 }
                 else
                 {
                     /* Send data */
                     (void)Cy_SCB_UART_Put(UART_Master_Struct.scb_base,
                                           (uint32_t)(*UART_Master_Struct.txptr));
-                    UART_Master_Struct.tcrc =
-                        SelfTests_CRC16_CCITT_Byte(UART_Master_Struct.tcrc,
-                                                   *UART_Master_Struct.txptr);
 
                     UART_Master_Struct.txptr++;
                     UART_Master_Struct.txcnt--;
@@ -676,6 +649,8 @@ uint8_t UartMesMaster_DataProc(uint8_t address, uint8_t* txd, uint8_t tlen, uint
                                uint8_t rlen)
 {
     uint8_t ret = 0u;
+    stl_crc16_ctx_t crcCtx;
+    uint8_t hdr[2];
     const uint8_t uart_master_struct_gstatus = UART_Master_Struct.gstatus;
     /* Check if it possible to start a request */
     if ((tlen == 0u) || (uart_master_struct_gstatus == UM_BUSY))
@@ -684,8 +659,15 @@ uint8_t UartMesMaster_DataProc(uint8_t address, uint8_t* txd, uint8_t tlen, uint
     }
     else
     {
+        /* CRC16 of the packet as it is sent, so the TX interrupt only sends bytes */
+        hdr[0] = address;
+        hdr[1] = tlen;
+        SelfTests_CRC16_CCITT_Init(&crcCtx);
+        SelfTests_CRC16_CCITT_UpdateEscaped(&crcCtx, (uint32_t)hdr, sizeof(hdr), STX, ESC);
+        SelfTests_CRC16_CCITT_UpdateEscaped(&crcCtx, (uint32_t)txd, tlen, STX, ESC);
+        UART_Master_Struct.tcrc = SelfTests_CRC16_CCITT_Final(&crcCtx);
+
         /* Init the structure */
-        UART_Master_Struct.tcrc = 0u;
         UART_Master_Struct.rcrc = 0u;
         UART_Master_Struct.txptr = txd;
         UART_Master_Struct.txcnt = tlen;
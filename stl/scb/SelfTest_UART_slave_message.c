@@ -125,8 +125,6 @@ static volatile struct
 } UART_Slave_Struct;
 
 
-
-
 /*****************************************************************************
 * Function Name: UART_MessageTxSlaveInt
 ******************************************************************************
@@ -156,9 +154,6 @@ static void UART_MessageTxSlaveInt(uint32_t IntMask)
 
             /* Interrupt only when physical transmission completed */
             UART_Slave_Struct.tstatus = UMS_SEND_ADDR;
-
-            /* Reset TX crc*/
-            UART_Slave_Struct.tcrc = 0u;
             break;
 
         case UMS_SEND_ADDR:
@@ -172,9 +167,6 @@ static void UART_MessageTxSlaveInt(uint32_t IntMask)
                                       (uint32_t)UART_Slave_Struct.address + 1u);
 
                 UART_Slave_Struct.tstatus = UMS_SEND_DL;
-                UART_Slave_Struct.tcrc =
-                    SelfTests_CRC16_CCITT_Byte(UART_Slave_Struct.tcrc,
-                                               UART_Slave_Struct.address + 1u);
             }
             else
             {
@@ -184,9 +176,6 @@ static void UART_MessageTxSlaveInt(uint32_t IntMask)
                     /* Change the procedure */
                     UART_Slave_Struct.tescflg = 1u;
                     (void)Cy_SCB_UART_Put(UART_Slave_Struct.scb_base, ESC);
-
-                    UART_Slave_Struct.tcrc =
-                        SelfTests_CRC16_CCITT_Byte(UART_Slave_Struct.tcrc, ESC);
                 }
                 else
                 {
@@ -195,9 +184,6 @@ static void UART_MessageTxSlaveInt(uint32_t IntMask)
                                           (uint32_t)UART_Slave_Struct.address);
 
                     UART_Slave_Struct.tstatus = UMS_SEND_DL;
-                    UART_Slave_Struct.tcrc =
-                        SelfTests_CRC16_CCITT_Byte(UART_Slave_Struct.tcrc,
-                                                   UART_Slave_Struct.address);
                 }
             }
             break;
@@ -213,9 +199,6 @@ static void UART_MessageTxSlaveInt(uint32_t IntMask)
                                       (uint32_t)UART_Slave_Struct.txcnt + 1u);
 
                 UART_Slave_Struct.tstatus = UMS_SEND_DATA;
-                UART_Slave_Struct.tcrc =
-                    SelfTests_CRC16_CCITT_Byte(UART_Slave_Struct.tcrc,
-                                               UART_Slave_Struct.txcnt + 1u);
             }
             else
             {
@@ -225,8 +208,6 @@ static void UART_MessageTxSlaveInt(uint32_t IntMask)
                     /* Change the procedure */
                     UART_Slave_Struct.tescflg = 1u;
                     (void)Cy_SCB_UART_Put(UART_Slave_Struct.scb_base, ESC);
-                    UART_Slave_Struct.tcrc =
-                        SelfTests_CRC16_CCITT_Byte(UART_Slave_Struct.tcrc, ESC);
                 }
                 else
                 {
@@ -235,8 +216,6 @@ static void UART_MessageTxSlaveInt(uint32_t IntMask)
                                           (uint32_t)UART_Slave_Struct.txcnt);
 
                     UART_Slave_Struct.tstatus = UMS_SEND_DATA;
-                    UART_Slave_Struct.tcrc = SelfTests_CRC16_CCITT_Byte(UART_Slave_Struct.tcrc,
-                                                                        UART_Slave_Struct.txcnt);
                 }
             }
             break;
@@ -250,8 +229,6 @@ static void UART_MessageTxSlaveInt(uint32_t IntMask)
                 UART_Slave_Struct.tescflg = 0u;
                 (void)Cy_SCB_UART_Put(UART_Slave_Struct.scb_base,
                                       (uint32_t)(*UART_Slave_Struct.txptr) + 1u);
-                UART_Slave_Struct.tcrc = SelfTests_CRC16_CCITT_Byte(UART_Slave_Struct.tcrc,
-                                                                    *UART_Slave_Struct.txptr + 1u);
 
                 UART_Slave_Struct.txptr++;
                 UART_Slave_Struct.txcnt--;
@@ -264,16 +241,12 @@ static void UART_MessageTxSlaveInt(uint32_t IntMask)
                     /* Change the procedure */
                     UART_Slave_Struct.tescflg = 1u;
                     (void)Cy_SCB_UART_Put(UART_Slave_Struct.scb_base, ESC);
-                    UART_Slave_Struct.tcrc =
-                        SelfTests_CRC16_CCITT_Byte(UART_Slave_Struct.tcrc, ESC);
                 }
                 else
                 {
                     /* Send data */
                     (void)Cy_SCB_UART_Put(UART_Slave_Struct.scb_base,
                                           (uint32_t)(*UART_Slave_Struct.txptr));
-                    UART_Slave_Struct.tcrc = SelfTests_CRC16_CCITT_Byte(UART_Slave_Struct.tcrc,
-                                                                        *UART_Slave_Struct.txptr);
 
                     UART_Slave_Struct.txptr++;
                     UART_Slave_Struct.txcnt--;
@@ -662,6 +635,8 @@ uint8_t UartMesSlave_GetDataSize(void)
 uint8_t UartMesSlave_Respond(uint8_t* txd, uint8_t tlen)
 {
     uint8_t ret = 0u;
+    stl_crc16_ctx_t crcCtx;
+    uint8_t hdr[2];
 
     const uint8_t uart_slave_struct_gstatus = UART_Slave_Struct.gstatus;
     /* Check if it possible to start responding */
@@ -671,8 +646,15 @@ uint8_t UartMesSlave_Respond(uint8_t* txd, uint8_t tlen)
     }
     else
     {
+        /* CRC16 of the packet as it is sent, so the TX interrupt only sends bytes */
+        hdr[0] = UART_Slave_Struct.address;
+        hdr[1] = tlen;
+        SelfTests_CRC16_CCITT_Init(&crcCtx);
+        SelfTests_CRC16_CCITT_UpdateEscaped(&crcCtx, (uint32_t)hdr, sizeof(hdr), STX, ESC);
+        SelfTests_CRC16_CCITT_UpdateEscaped(&crcCtx, (uint32_t)txd, tlen, STX, ESC);
+        UART_Slave_Struct.tcrc = SelfTests_CRC16_CCITT_Final(&crcCtx);
+
         /* Init the structure */
-        UART_Slave_Struct.tcrc = 0u;
         UART_Slave_Struct.rcrc = 0u;
         UART_Slave_Struct.txptr = txd;
         UART_Slave_Struct.txcnt = tlen;
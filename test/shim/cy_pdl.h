@@ -0,0 +1,153 @@
+/*******************************************************************************
+* File Name: cy_pdl.h
+*
+* Description:
+*  This file replaces the PDL header for the host (Linux) builds of the
+*  mtb-stl kernels used by the tests in this directory. It defines no device,
+*  so only the device independent code is built. With STL_TEST_SRSS, it adds
+*  the SRSS clock measurement API, which the test implements.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#if !defined(CY_PDL_H)
+    #define CY_PDL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define CY_ALIGN(align)     __attribute__((aligned(align)))
+
+#if defined(STL_TEST_SRSS)
+/* SRSS clock calibration counters, implemented by the test */
+#define CY_IP_MXS40SRSS     (1u)
+
+typedef enum
+{
+    CY_SYSCLK_MEAS_CLK_IMO = 1,
+    CY_SYSCLK_MEAS_CLK_WCO,
+    CY_SYSCLK_MEAS_CLK_ILO,
+    CY_SYSCLK_MEAS_CLK_ECO,
+    CY_SYSCLK_MEAS_CLK_CLK_HFS
+} cy_en_meas_clks_t;
+
+typedef enum
+{
+    CY_SYSCLK_SUCCESS = 0,
+    CY_SYSCLK_BAD_PARAM = 1,
+    CY_SYSCLK_TIMEOUT = 2,
+    CY_SYSCLK_INVALID_STATE = 3
+} cy_en_sysclk_status_t;
+
+cy_en_sysclk_status_t Cy_SysClk_StartClkMeasurementCounters(cy_en_meas_clks_t clock1,
+                                                            uint32_t count1,
+                                                            cy_en_meas_clks_t clock2);
+bool Cy_SysClk_ClkMeasurementCountersDone(void);
+uint32_t Cy_SysClk_ClkMeasurementCountersGetFreq(bool measuredClock, uint32_t refClkFreq);
+#endif /* STL_TEST_SRSS */
+
+#if defined(STL_TEST_REGS)
+/* PSOC 4000S configuration registers and Flash driver, implemented by the test */
+#define CY_DEVICE_SERIES_PSOC_4000S
+#define CY_IP_M0S8CPUSSV3   (1u)
+
+#define CY_FLASH_BASE       (0x10000000UL)
+#define CY_FLASH_SIZE       (0x00010000UL)
+#define CY_FLASH_SIZEOF_ROW (128UL)
+
+#define CY_GET_REG32(addr)  (*(volatile uint32_t*)(addr))
+
+typedef enum
+{
+    CY_FLASH_DRV_SUCCESS = 0,
+    CY_FLASH_DRV_INV_PROT = 1,
+    CY_FLASH_DRV_ERR_UNC = 2
+} cy_en_flashdrv_status_t;
+
+typedef struct
+{
+    volatile uint32_t CLK_IMO_SELECT;
+    volatile uint32_t CLK_IMO_TRIM1;
+    volatile uint32_t CLK_IMO_TRIM2;
+    volatile uint32_t CLK_IMO_TRIM3;
+    volatile uint32_t CLK_IMO_CONFIG;
+    volatile uint32_t CLK_ILO_CONFIG;
+} stl_test_srsslt_t;
+
+typedef struct
+{
+    volatile uint32_t PCLK_CTL[8];
+    volatile uint32_t DIV_16_CTL[4];
+} stl_test_peri_t;
+
+typedef struct
+{
+    volatile uint32_t WDT_CONFIG;
+} stl_test_wco_t;
+
+typedef struct
+{
+    volatile uint32_t PORT_SEL;
+} stl_test_hsiom_t;
+
+typedef struct
+{
+    volatile uint32_t PC;
+    volatile uint32_t PC2;
+} stl_test_gpio_t;
+
+extern stl_test_srsslt_t stl_test_srsslt;
+extern stl_test_peri_t stl_test_peri;
+extern stl_test_wco_t stl_test_wco;
+extern stl_test_hsiom_t stl_test_hsiom[5];
+extern stl_test_gpio_t stl_test_gpio[5];
+
+#define SRSSLT              (&stl_test_srsslt)
+#define PERI                (&stl_test_peri)
+#define WCO                 (&stl_test_wco)
+#define HSIOM_PRT0          (&stl_test_hsiom[0])
+#define HSIOM_PRT1          (&stl_test_hsiom[1])
+#define HSIOM_PRT2          (&stl_test_hsiom[2])
+#define HSIOM_PRT3          (&stl_test_hsiom[3])
+#define HSIOM_PRT4          (&stl_test_hsiom[4])
+#define GPIO_PRT0           (&stl_test_gpio[0])
+#define GPIO_PRT1           (&stl_test_gpio[1])
+#define GPIO_PRT2           (&stl_test_gpio[2])
+#define GPIO_PRT3           (&stl_test_gpio[3])
+#define GPIO_PRT4           (&stl_test_gpio[4])
+
+cy_en_flashdrv_status_t Cy_Flash_WriteRow(uint32_t rowAddr, const uint32_t* data);
+#endif /* STL_TEST_REGS */
+
+#endif /* CY_PDL_H */
+
+/* [] END OF FILE */
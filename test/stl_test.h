@@ -0,0 +1,134 @@
+/*******************************************************************************
+* File Name: stl_test.h
+*
+* Description:
+*  This file provides the check macros and the simulated Flash used by the host
+*  tests of the mtb-stl kernels.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#if !defined(STL_TEST_H)
+    #define STL_TEST_H
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <sys/mman.h>
+
+/* The library addresses memory with 32-bit integers, so the data under test is mapped at a fixed
+ * address below 4 GB */
+#define STL_TEST_FLASH_BASE     (0x10000000UL)
+#define STL_TEST_FLASH_SIZE     (0x00080000UL)
+
+/* Number of failed checks */
+static int stl_test_failed = 0;
+
+/* Records a failed check with its location */
+#define STL_CHECK(cond) \
+    do \
+    { \
+        if (!(cond)) \
+        { \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            stl_test_failed++; \
+        } \
+    } while (0)
+
+/* Records a failed comparison of two 64-bit values */
+#define STL_CHECK_EQ(actual, expected) \
+    do \
+    { \
+        uint64_t stl_a = (uint64_t)(actual); \
+        uint64_t stl_e = (uint64_t)(expected); \
+        if (stl_a != stl_e) \
+        { \
+            fprintf(stderr, "%s:%d: %s = 0x%" PRIX64 ", expected 0x%" PRIX64 "\n", \
+                    __FILE__, __LINE__, #actual, stl_a, stl_e); \
+            stl_test_failed++; \
+        } \
+    } while (0)
+
+
+/*******************************************************************************
+ * Function Name: stl_test_flash
+ *******************************************************************************
+ *
+ * Summary:
+ *  Maps the simulated Flash at STL_TEST_FLASH_BASE and returns it, NULL if the
+ *  address is not available.
+ *
+ ******************************************************************************/
+static inline uint8_t* stl_test_flash(void)
+{
+    void* p = mmap((void*)(uintptr_t)STL_TEST_FLASH_BASE, STL_TEST_FLASH_SIZE,
+                   PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+
+    return (p == MAP_FAILED) ? NULL : (uint8_t*)p;
+}
+
+
+/*******************************************************************************
+ * Function Name: stl_test_fill
+ *******************************************************************************
+ *
+ * Summary:
+ *  Fills buf with a reproducible pseudo-random pattern.
+ *
+ ******************************************************************************/
+static inline void stl_test_fill(uint8_t* buf, uint32_t len, uint32_t seed)
+{
+    uint32_t x = seed;
+
+    for (uint32_t i = 0u; i < len; i++)
+    {
+        x = (x * 1664525u) + 1013904223u;
+        buf[i] = (uint8_t)(x >> 24);
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: stl_test_result
+ *******************************************************************************
+ *
+ * Summary:
+ *  Prints the summary and returns the process exit code.
+ *
+ ******************************************************************************/
+static inline int stl_test_result(const char* name)
+{
+    printf("%s: %s\n", name, (stl_test_failed == 0) ? "PASS" : "FAIL");
+    return (stl_test_failed == 0) ? 0 : 1;
+}
+
+#endif /* STL_TEST_H */
+
+/* [] END OF FILE */
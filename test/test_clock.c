@@ -0,0 +1,496 @@
+/*******************************************************************************
+* File Name: test_clock.c
+*
+* Description:
+*  This file checks the deviation and limit calculation of the clock
+*  cross-measurement engine, and its measurement sequence with simulated
+*  calibration counters, including a stopped reference clock and counters that
+*  stay in use. It also checks the ring buffer statistics, the EMA, and the
+*  thresholds of the clock drift trend.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#include "cy_pdl.h"
+#include "SelfTest_Clock_Engine.h"
+#include "SelfTest_Clock_Trend.h"
+#include "stl_test.h"
+
+/* Number of simulated clocks, indexed by cy_en_meas_clks_t */
+#define SIM_CLOCKS          (6u)
+
+/* Calls of Cy_SysClk_ClkMeasurementCountersDone() until a measurement is done */
+#define SIM_POLLS           (3u)
+
+/* Real frequencies of the simulated clocks in Hz */
+static uint32_t simHz[SIM_CLOCKS];
+
+/* The reference clock is stopped, the measurement never finishes */
+static bool simStopped;
+
+/* The counters are used by other code */
+static bool simBusy;
+
+/* State of the simulated counters */
+static uint32_t simPolls;
+static uint32_t simStarts;
+static uint32_t simCount;
+
+
+cy_en_sysclk_status_t Cy_SysClk_StartClkMeasurementCounters(cy_en_meas_clks_t clock1,
+                                                            uint32_t count1,
+                                                            cy_en_meas_clks_t clock2)
+{
+    if (simBusy)
+    {
+        return CY_SYSCLK_INVALID_STATE;
+    }
+    simStarts++;
+    simPolls = 0u;
+    simCount = (uint32_t)(((uint64_t)simHz[clock2] * count1) / simHz[clock1]);
+    return CY_SYSCLK_SUCCESS;
+}
+
+
+bool Cy_SysClk_ClkMeasurementCountersDone(void)
+{
+    simPolls++;
+    return (!simStopped) && (simPolls >= SIM_POLLS);
+}
+
+
+uint32_t Cy_SysClk_ClkMeasurementCountersGetFreq(bool measuredClock, uint32_t refClkFreq)
+{
+    (void)measuredClock;
+    (void)refClkFreq;
+    return simCount;
+}
+
+
+/* IMO 2 %, WCO 150 ppm, ILO 10 %, CLK_HF0 */
+static const stl_clock_domain_t domains[] =
+{
+    { CY_SYSCLK_MEAS_CLK_IMO, 8000000UL, 20000UL },
+    { CY_SYSCLK_MEAS_CLK_WCO, 32768UL, 150UL },
+    { CY_SYSCLK_MEAS_CLK_ILO, 32000UL, 100000UL },
+    { CY_SYSCLK_MEAS_CLK_CLK_HFS, 100000000UL, 20000UL }
+};
+
+/* IMO and ILO against WCO, CLK_HF0 against IMO */
+static const stl_clock_pair_t pairs[] = { { 0u, 1u }, { 2u, 1u }, { 3u, 0u } };
+
+#define PAIR_COUNT          (sizeof(pairs) / sizeof(pairs[0]))
+#define DOMAIN_COUNT        (sizeof(domains) / sizeof(domains[0]))
+
+
+/*******************************************************************************
+ * Function Name: sim_nominal
+ *******************************************************************************
+ *
+ * Summary:
+ *  Sets all simulated clocks to their nominal frequencies.
+ *
+ ******************************************************************************/
+static void sim_nominal(void)
+{
+    for (uint32_t i = 0u; i < DOMAIN_COUNT; i++)
+    {
+        simHz[domains[i].clock] = domains[i].nominalHz;
+    }
+    simStopped = false;
+    simBusy = false;
+    simStarts = 0u;
+}
+
+
+/*******************************************************************************
+ * Function Name: run_pass
+ *******************************************************************************
+ *
+ * Summary:
+ *  Calls SelfTest_Clock_Engine_Process until the pass ends and returns its
+ *  status. The number of calls is returned in calls.
+ *
+ ******************************************************************************/
+static uint8_t run_pass(stl_clock_engine_t* engine, uint32_t* calls)
+{
+    uint8_t status;
+
+    *calls = 0u;
+    do
+    {
+        status = SelfTest_Clock_Engine_Process(engine);
+        (*calls)++;
+    } while ((status == PASS_STILL_TESTING_STATUS) && (*calls < 100000u));
+
+    return status;
+}
+
+
+/*******************************************************************************
+ * Function Name: test_ppm
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks the deviation and its saturation.
+ *
+ ******************************************************************************/
+static void test_ppm(void)
+{
+    STL_CHECK_EQ(SelfTest_Clock_Engine_Ppm(1000000UL, 1000000UL), 0);
+    STL_CHECK(SelfTest_Clock_Engine_Ppm(1000100UL, 1000000UL) == 100);
+    STL_CHECK(SelfTest_Clock_Engine_Ppm(999900UL, 1000000UL) == -100);
+    STL_CHECK(SelfTest_Clock_Engine_Ppm(0UL, 79833UL) == -1000000);
+    STL_CHECK(SelfTest_Clock_Engine_Ppm(3UL, 2UL) == 500000);
+
+    /* Truncated toward 0 */
+    STL_CHECK(SelfTest_Clock_Engine_Ppm(1000001UL, 3000000UL) == -666666);
+
+    /* Saturated */
+    STL_CHECK(SelfTest_Clock_Engine_Ppm(0xFFFFFFFFUL, 1UL) == INT32_MAX);
+    STL_CHECK(SelfTest_Clock_Engine_Ppm(2148UL, 1UL) == 2147000000);
+    STL_CHECK(SelfTest_Clock_Engine_Ppm(2149UL, 1UL) == INT32_MAX);
+}
+
+
+/*******************************************************************************
+ * Function Name: test_init
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks the window, the expected count, and the limit of each pair, and the
+ *  rejected configurations.
+ *
+ ******************************************************************************/
+static void test_init(void)
+{
+    stl_clock_result_t results[PAIR_COUNT];
+    stl_clock_engine_t engine;
+    stl_clock_pair_t bad;
+
+    STL_CHECK_EQ(SelfTest_Clock_Engine_Init(&engine, domains, DOMAIN_COUNT, pairs, PAIR_COUNT,
+                                            results, 10000UL), OK_STATUS);
+
+    /* 327 WCO cycles, 79833.98 IMO cycles, 20000 + 150 + ceil(1000000 / 79833) ppm */
+    STL_CHECK_EQ(results[0].refCycles, 327u);
+    STL_CHECK_EQ(results[0].expected, 79833u);
+    STL_CHECK_EQ(results[0].limitPpm, 20163u);
+    STL_CHECK_EQ(results[0].status, STL_CLOCK_PAIR_PENDING);
+
+    /* 319.33 ILO cycles, 100000 + 150 + ceil(1000000 / 319) ppm */
+    STL_CHECK_EQ(results[1].refCycles, 327u);
+    STL_CHECK_EQ(results[1].expected, 319u);
+    STL_CHECK_EQ(results[1].limitPpm, 103285u);
+
+    /* 80000 IMO cycles, 1000000 CLK_HF0 cycles, 20000 + 20000 + 1 ppm */
+    STL_CHECK_EQ(results[2].refCycles, 80000u);
+    STL_CHECK_EQ(results[2].expected, 1000000u);
+    STL_CHECK_EQ(results[2].limitPpm, 40001u);
+
+    /* Missing domain, same domain twice */
+    bad.measured = 0u;
+    bad.reference = (uint8_t)DOMAIN_COUNT;
+    STL_CHECK_EQ(SelfTest_Clock_Engine_Init(&engine, domains, DOMAIN_COUNT, &bad, 1u, results,
+                                            10000UL), ERROR_STATUS);
+    bad.reference = 0u;
+    STL_CHECK_EQ(SelfTest_Clock_Engine_Init(&engine, domains, DOMAIN_COUNT, &bad, 1u, results,
+                                            10000UL), ERROR_STATUS);
+    STL_CHECK_EQ(SelfTest_Clock_Engine_Process(&engine), ERROR_STATUS);
+
+    /* Window shorter than one reference cycle */
+    STL_CHECK_EQ(SelfTest_Clock_Engine_Init(&engine, domains, DOMAIN_COUNT, pairs, PAIR_COUNT,
+                                            results, 30UL), ERROR_STATUS);
+
+    /* 2.1 s: 16.8 million IMO cycles exceed the 24-bit reference counter */
+    STL_CHECK_EQ(SelfTest_Clock_Engine_Init(&engine, domains, DOMAIN_COUNT, &pairs[2], 1u,
+                                            results, 2100000UL), ERROR_STATUS);
+
+    /* 0.2 s: 20 million CLK_HF0 cycles exceed the 24-bit measured counter */
+    STL_CHECK_EQ(SelfTest_Clock_Engine_Init(&engine, domains, DOMAIN_COUNT, &pairs[2], 1u,
+                                            results, 200000UL), ERROR_STATUS);
+    STL_CHECK_EQ(SelfTest_Clock_Engine_Init(&engine, domains, DOMAIN_COUNT, &pairs[2], 1u,
+                                            results, 100000UL), OK_STATUS);
+
+    STL_CHECK_EQ(SelfTest_Clock_Engine_Init(NULL, domains, DOMAIN_COUNT, pairs, PAIR_COUNT,
+                                            results, 10000UL), ERROR_STATUS);
+    STL_CHECK_EQ(SelfTest_Clock_Engine_Init(&engine, domains, DOMAIN_COUNT, pairs, 0u,
+                                            results, 10000UL), ERROR_STATUS);
+}
+
+
+/*******************************************************************************
+ * Function Name: test_process
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks a pass at nominal frequencies and with a clock outside its limit.
+ *
+ ******************************************************************************/
+static void test_process(void)
+{
+    stl_clock_result_t results[PAIR_COUNT];
+    stl_clock_engine_t engine;
+    uint32_t calls;
+
+    sim_nominal();
+    (void)SelfTest_Clock_Engine_Init(&engine, domains, DOMAIN_COUNT, pairs, PAIR_COUNT, results,
+                                     10000UL);
+    STL_CHECK_EQ(run_pass(&engine, &calls), PASS_COMPLETE_STATUS);
+    STL_CHECK_EQ(simStarts, PAIR_COUNT);
+    for (uint32_t i = 0u; i < PAIR_COUNT; i++)
+    {
+        STL_CHECK_EQ(results[i].status, STL_CLOCK_PAIR_PASS);
+        STL_CHECK((results[i].ppm <= (int32_t)results[i].limitPpm) &&
+                  (results[i].ppm >= -(int32_t)results[i].limitPpm));
+    }
+
+    /* IMO 2.2 % fast: IMO against WCO fails, CLK_HF0 against IMO is 2.2 % slow and passes */
+    simHz[CY_SYSCLK_MEAS_CLK_IMO] = 8176000UL;
+    STL_CHECK_EQ(run_pass(&engine, &calls), ERROR_STATUS);
+    STL_CHECK_EQ(results[0].status, STL_CLOCK_PAIR_FAIL);
+    STL_CHECK(results[0].ppm > (int32_t)results[0].limitPpm);
+    STL_CHECK_EQ(results[1].status, STL_CLOCK_PAIR_PASS);
+    STL_CHECK_EQ(results[2].status, STL_CLOCK_PAIR_PASS);
+    STL_CHECK(results[2].ppm < -21000);
+
+    /* The next pass starts over */
+    sim_nominal();
+    STL_CHECK_EQ(run_pass(&engine, &calls), PASS_COMPLETE_STATUS);
+}
+
+
+/*******************************************************************************
+ * Function Name: test_timeout
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks that a stopped reference clock and counters that stay in use fail
+ *  the pair after STL_CLOCK_ENGINE_MAX_CALLS calls, and that the engine
+ *  continues with the next pair.
+ *
+ ******************************************************************************/
+static void test_timeout(void)
+{
+    stl_clock_result_t results[PAIR_COUNT];
+    stl_clock_engine_t engine;
+    uint32_t calls;
+
+    /* Stopped reference clock: the counters stay busy, so every pair fails */
+    sim_nominal();
+    (void)SelfTest_Clock_Engine_Init(&engine, domains, DOMAIN_COUNT, pairs, PAIR_COUNT, results,
+                                     10000UL);
+    simStopped = true;
+    for (calls = 0u; calls < (STL_CLOCK_ENGINE_MAX_CALLS - 1u); calls++)
+    {
+        STL_CHECK_EQ(SelfTest_Clock_Engine_Process(&engine), PASS_STILL_TESTING_STATUS);
+    }
+    STL_CHECK_EQ(results[0].status, STL_CLOCK_PAIR_PENDING);
+    simBusy = true;
+    STL_CHECK_EQ(SelfTest_Clock_Engine_Process(&engine), PASS_STILL_TESTING_STATUS);
+    STL_CHECK_EQ(results[0].status, STL_CLOCK_PAIR_FAIL);
+    STL_CHECK_EQ(results[0].count, 0u);
+    STL_CHECK(results[0].ppm == -1000000);
+    STL_CHECK_EQ(engine.current, 1u);
+    STL_CHECK_EQ(run_pass(&engine, &calls), ERROR_STATUS);
+    STL_CHECK_EQ(calls, 2u * STL_CLOCK_ENGINE_MAX_CALLS);
+    STL_CHECK_EQ(results[1].status, STL_CLOCK_PAIR_FAIL);
+    STL_CHECK_EQ(results[2].status, STL_CLOCK_PAIR_FAIL);
+
+    /* The counters are released: the next pass measures all pairs */
+    sim_nominal();
+    STL_CHECK_EQ(run_pass(&engine, &calls), PASS_COMPLETE_STATUS);
+    STL_CHECK_EQ(simStarts, PAIR_COUNT);
+
+    /* Counters in use for fewer calls than the bound: the pair is measured late */
+    simBusy = true;
+    for (calls = 0u; calls < (STL_CLOCK_ENGINE_MAX_CALLS / 2u); calls++)
+    {
+        STL_CHECK_EQ(SelfTest_Clock_Engine_Process(&engine), PASS_STILL_TESTING_STATUS);
+    }
+    simBusy = false;
+    STL_CHECK_EQ(run_pass(&engine, &calls), PASS_COMPLETE_STATUS);
+    STL_CHECK_EQ(results[0].status, STL_CLOCK_PAIR_PASS);
+}
+
+
+/*******************************************************************************
+ * Function Name: test_trend_stats
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks the rejected parameters and the statistics of the ring buffer
+ *  before and after it wraps.
+ *
+ ******************************************************************************/
+static void test_trend_stats(void)
+{
+    int32_t history[4u];
+    stl_clock_trend_t trend;
+    stl_clock_trend_stats_t stats;
+
+    STL_CHECK_EQ(SelfTest_Clock_Trend_Init(NULL, history, 4u, 0u, 50UL, 100UL, 0UL),
+                 ERROR_STATUS);
+    STL_CHECK_EQ(SelfTest_Clock_Trend_Init(&trend, NULL, 4u, 0u, 50UL, 100UL, 0UL),
+                 ERROR_STATUS);
+    STL_CHECK_EQ(SelfTest_Clock_Trend_Init(&trend, history, 0u, 0u, 50UL, 100UL, 0UL),
+                 ERROR_STATUS);
+    STL_CHECK_EQ(SelfTest_Clock_Trend_Init(&trend, history, 4u, STL_CLOCK_TREND_MAX_SHIFT + 1u,
+                                           50UL, 100UL, 0UL), ERROR_STATUS);
+    STL_CHECK_EQ(SelfTest_Clock_Trend_Init(&trend, history, 4u, 0u, 101UL, 100UL, 0UL),
+                 ERROR_STATUS);
+
+    STL_CHECK_EQ(SelfTest_Clock_Trend_Init(&trend, history, 4u, 8u, 5000UL, 10000UL, 0UL),
+                 OK_STATUS);
+    SelfTest_Clock_Trend_GetStats(&trend, &stats);
+    STL_CHECK_EQ(stats.count, 0u);
+    STL_CHECK_EQ(stats.variance, 0u);
+
+    /* 10, 20, 30, 40: mean 25, variance 750 - 625 */
+    for (int32_t ppm = 10; ppm <= 40; ppm += 10)
+    {
+        STL_CHECK_EQ(SelfTest_Clock_Trend_Update(&trend, ppm), OK_STATUS);
+    }
+    SelfTest_Clock_Trend_GetStats(&trend, &stats);
+    STL_CHECK_EQ(stats.count, 4u);
+    STL_CHECK(stats.mean == 25);
+    STL_CHECK(stats.min == 10);
+    STL_CHECK(stats.max == 40);
+    STL_CHECK_EQ(stats.variance, 125u);
+
+    /* 50 and -70 replace 10 and 20: 30, 40, 50, -70 */
+    (void)SelfTest_Clock_Trend_Update(&trend, 50);
+    (void)SelfTest_Clock_Trend_Update(&trend, -70);
+    SelfTest_Clock_Trend_GetStats(&trend, &stats);
+    STL_CHECK_EQ(stats.count, 4u);
+    STL_CHECK(stats.mean == 12);
+    STL_CHECK(stats.min == -70);
+    STL_CHECK(stats.max == 50);
+    STL_CHECK_EQ(stats.variance, 2475u - 144u);
+
+    /* A constant history has no variance */
+    for (uint32_t i = 0u; i < 4u; i++)
+    {
+        (void)SelfTest_Clock_Trend_Update(&trend, -7);
+    }
+    SelfTest_Clock_Trend_GetStats(&trend, &stats);
+    STL_CHECK(stats.mean == -7);
+    STL_CHECK(stats.min == -7);
+    STL_CHECK(stats.max == -7);
+    STL_CHECK_EQ(stats.variance, 0u);
+
+    /* Samples are clamped to STL_CLOCK_TREND_MAX_PPM, the variance saturates */
+    (void)SelfTest_Clock_Trend_Update(&trend, INT32_MAX);
+    (void)SelfTest_Clock_Trend_Update(&trend, INT32_MIN);
+    SelfTest_Clock_Trend_GetStats(&trend, &stats);
+    STL_CHECK(stats.max == STL_CLOCK_TREND_MAX_PPM);
+    STL_CHECK(stats.min == -STL_CLOCK_TREND_MAX_PPM);
+    STL_CHECK_EQ(stats.variance, UINT32_MAX);
+}
+
+
+/*******************************************************************************
+ * Function Name: test_trend_ema
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks the EMA and the warning, failure, and hard limit thresholds.
+ *
+ ******************************************************************************/
+static void test_trend_ema(void)
+{
+    int32_t history[8u];
+    stl_clock_trend_t trend;
+    stl_clock_trend_stats_t stats;
+
+    /* The first sample starts the EMA, then 100 - 100 / 4 and 75 - 75 / 4 */
+    (void)SelfTest_Clock_Trend_Init(&trend, history, 8u, 2u, 500UL, 1000UL, 0UL);
+    (void)SelfTest_Clock_Trend_Update(&trend, 100);
+    SelfTest_Clock_Trend_GetStats(&trend, &stats);
+    STL_CHECK(stats.ema == 100);
+    (void)SelfTest_Clock_Trend_Update(&trend, 0);
+    SelfTest_Clock_Trend_GetStats(&trend, &stats);
+    STL_CHECK(stats.ema == 75);
+    (void)SelfTest_Clock_Trend_Update(&trend, 0);
+    SelfTest_Clock_Trend_GetStats(&trend, &stats);
+    STL_CHECK(stats.ema == 56);
+
+    /* Weight 1: the EMA is the last sample */
+    (void)SelfTest_Clock_Trend_Init(&trend, history, 8u, 0u, 500UL, 1000UL, 0UL);
+    (void)SelfTest_Clock_Trend_Update(&trend, 300);
+    (void)SelfTest_Clock_Trend_Update(&trend, -200);
+    SelfTest_Clock_Trend_GetStats(&trend, &stats);
+    STL_CHECK(stats.ema == -200);
+
+    /* The thresholds apply to the magnitude of the EMA and are reached at equality */
+    STL_CHECK_EQ(SelfTest_Clock_Trend_Update(&trend, 499), OK_STATUS);
+    STL_CHECK_EQ(SelfTest_Clock_Trend_Update(&trend, 500), CLOCK_DRIFT_WARNING_STATUS);
+    STL_CHECK_EQ(SelfTest_Clock_Trend_Update(&trend, -999), CLOCK_DRIFT_WARNING_STATUS);
+    STL_CHECK_EQ(SelfTest_Clock_Trend_Update(&trend, -1000), ERROR_STATUS);
+    STL_CHECK_EQ(SelfTest_Clock_Trend_Update(&trend, 0), OK_STATUS);
+
+    /* A slow drift reaches the warning before the failure, one-off jitter is filtered */
+    (void)SelfTest_Clock_Trend_Init(&trend, history, 8u, 3u, 500UL, 1000UL, 2000UL);
+    STL_CHECK_EQ(SelfTest_Clock_Trend_Update(&trend, 0), OK_STATUS);
+    STL_CHECK_EQ(SelfTest_Clock_Trend_Update(&trend, 1900), OK_STATUS);
+    STL_CHECK_EQ(SelfTest_Clock_Trend_Update(&trend, 0), OK_STATUS);
+    for (uint32_t i = 0u; i < 10u; i++)
+    {
+        STL_CHECK(SelfTest_Clock_Trend_Update(&trend, 800) != ERROR_STATUS);
+    }
+    STL_CHECK_EQ(SelfTest_Clock_Trend_Update(&trend, 800), CLOCK_DRIFT_WARNING_STATUS);
+    for (uint32_t i = 0u; i < 20u; i++)
+    {
+        (void)SelfTest_Clock_Trend_Update(&trend, 1200);
+    }
+    STL_CHECK_EQ(SelfTest_Clock_Trend_Update(&trend, 1200), ERROR_STATUS);
+
+    /* The hard limit fails a single sample with a low EMA */
+    (void)SelfTest_Clock_Trend_Init(&trend, history, 8u, 8u, 500UL, 1000UL, 2000UL);
+    STL_CHECK_EQ(SelfTest_Clock_Trend_Update(&trend, 0), OK_STATUS);
+    STL_CHECK_EQ(SelfTest_Clock_Trend_Update(&trend, -2000), OK_STATUS);
+    STL_CHECK_EQ(SelfTest_Clock_Trend_Update(&trend, -2001), ERROR_STATUS);
+    STL_CHECK_EQ(SelfTest_Clock_Trend_Update(&trend, 0), OK_STATUS);
+}
+
+
+int main(void)
+{
+    test_ppm();
+    test_init();
+    test_process();
+    test_timeout();
+    test_trend_stats();
+    test_trend_ema();
+
+    return stl_test_result("test_clock");
+}
+
+
+/* [] END OF FILE */
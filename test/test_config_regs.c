@@ -0,0 +1,213 @@
+/*******************************************************************************
+* File Name: test_config_regs.c
+*
+* Description:
+*  This file checks the runtime monitor of the configuration registers with
+*  simulated PSOC 4000S registers: clean rounds, register drift, volatile fields
+*  and a corrupted golden image. The library source is included so the test can
+*  corrupt the golden image, which is private to it.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#include "../stl/regs/SelfTest_ConfigRegisters.c"
+#include "stl_test.h"
+
+/* Index of GPIO_PRT0->PC in the default table */
+#define GPIO_PRT0_PC_INDEX      (16u)
+
+/* Simulated registers */
+stl_test_srsslt_t stl_test_srsslt;
+stl_test_peri_t stl_test_peri;
+stl_test_wco_t stl_test_wco;
+stl_test_hsiom_t stl_test_hsiom[5];
+stl_test_gpio_t stl_test_gpio[5];
+
+
+/*******************************************************************************
+ * Function Name: Cy_Flash_WriteRow
+ *******************************************************************************
+ *
+ * Summary:
+ *  Writes one row of the simulated Flash.
+ *
+ ******************************************************************************/
+cy_en_flashdrv_status_t Cy_Flash_WriteRow(uint32_t rowAddr, const uint32_t* data)
+{
+    memcpy((void*)(uintptr_t)rowAddr, data, CY_FLASH_SIZEOF_ROW);
+    return CY_FLASH_DRV_SUCCESS;
+}
+
+
+/*******************************************************************************
+ * Function Name: monitor_round
+ *******************************************************************************
+ *
+ * Summary:
+ *  Runs the monitor until it returns a final status and returns it.
+ *
+ ******************************************************************************/
+static uint8_t monitor_round(void)
+{
+    uint8_t ret;
+    uint32_t calls = 0u;
+
+    do
+    {
+        ret = SelfTests_ConfigReg_Monitor(CFG_REGS_MONITOR_REGS_PER_CALL);
+        calls++;
+    } while ((ret == PASS_STILL_TESTING_STATUS) && (calls <= CFG_REGS_MAX_COUNT));
+
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: test_not_initialized
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks that the monitor fails before the golden image is taken.
+ *
+ ******************************************************************************/
+static void test_not_initialized(void)
+{
+    stl_cfg_reg_fault_t fault;
+
+    STL_CHECK_EQ(SelfTests_ConfigReg_Monitor(CFG_REGS_MONITOR_REGS_PER_CALL), ERROR_STATUS);
+    SelfTests_ConfigReg_Monitor_GetFault(&fault);
+    STL_CHECK_EQ(fault.index, CFG_REGS_NO_FAILED_INDEX);
+}
+
+
+/*******************************************************************************
+ * Function Name: test_drift
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks clean rounds, the report of a diverged register, and that a
+ *  volatile field is not checked.
+ *
+ ******************************************************************************/
+static void test_drift(void)
+{
+    static const stl_cfg_reg_field_t volatileFields[] = { { GPIO_PRT0_PC_INDEX, 0x1UL } };
+    stl_cfg_reg_fault_t fault;
+
+    GPIO_PRT0->PC = 0x00000C36UL;
+    SelfTests_ConfigReg_Monitor_Init(NULL, 0u);
+    STL_CHECK_EQ(monitor_round(), PASS_COMPLETE_STATUS);
+    STL_CHECK_EQ(monitor_round(), PASS_COMPLETE_STATUS);
+
+    GPIO_PRT0->PC ^= 0x00000100UL;
+    STL_CHECK_EQ(monitor_round(), ERROR_STATUS);
+    SelfTests_ConfigReg_Monitor_GetFault(&fault);
+    STL_CHECK_EQ(fault.index, GPIO_PRT0_PC_INDEX);
+    STL_CHECK_EQ(fault.address, (uint32_t)(uintptr_t)&GPIO_PRT0->PC);
+    STL_CHECK_EQ(fault.expected, 0x00000C36UL);
+    STL_CHECK_EQ(fault.actual, 0x00000D36UL);
+    STL_CHECK_EQ(fault.diff, 0x00000100UL);
+
+    /* The divergence is reported again in every round */
+    STL_CHECK_EQ(monitor_round(), ERROR_STATUS);
+
+    GPIO_PRT0->PC = 0x00000C36UL;
+    SelfTests_ConfigReg_Monitor_Init(volatileFields, 1u);
+    GPIO_PRT0->PC ^= 0x1UL;
+    STL_CHECK_EQ(monitor_round(), PASS_COMPLETE_STATUS);
+    GPIO_PRT0->PC = 0x00000C36UL;
+}
+
+
+/*******************************************************************************
+ * Function Name: test_corrupted_golden
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks that a corrupted golden image is reported as such, both when the
+ *  corrupted entry makes its register mismatch and when it does not, and not
+ *  as a diverged register.
+ *
+ ******************************************************************************/
+static void test_corrupted_golden(void)
+{
+    stl_cfg_reg_fault_t fault;
+    uint32_t count;
+
+    SelfTests_ConfigReg_Monitor_Init(NULL, 0u);
+    count = SelfTests_ConfigReg_GetCount();
+    STL_CHECK_EQ(monitor_round(), PASS_COMPLETE_STATUS);
+
+    /* The golden value differs from the unchanged register */
+    cfgRegMonGolden[GPIO_PRT0_PC_INDEX][CFG_REGS_MON_VALUE] ^= 0x00000040UL;
+    STL_CHECK_EQ(monitor_round(), ERROR_STATUS);
+    SelfTests_ConfigReg_Monitor_GetFault(&fault);
+    STL_CHECK_EQ(fault.index, count);
+    STL_CHECK_EQ(fault.address, 0u);
+    STL_CHECK(fault.diff != 0u);
+
+    /* Also in the middle of a round */
+    STL_CHECK_EQ(SelfTests_ConfigReg_Monitor(1u), PASS_STILL_TESTING_STATUS);
+    STL_CHECK_EQ(monitor_round(), ERROR_STATUS);
+    SelfTests_ConfigReg_Monitor_GetFault(&fault);
+    STL_CHECK_EQ(fault.index, count);
+
+    /* A new golden image clears the error */
+    SelfTests_ConfigReg_Monitor_Init(NULL, 0u);
+    STL_CHECK_EQ(monitor_round(), PASS_COMPLETE_STATUS);
+
+    /* A corrupted mask of an unset bit does not make its register mismatch */
+    cfgRegMonGolden[GPIO_PRT0_PC_INDEX][CFG_REGS_MON_MASK] ^= 0x80000000UL;
+    STL_CHECK_EQ(monitor_round(), ERROR_STATUS);
+    SelfTests_ConfigReg_Monitor_GetFault(&fault);
+    STL_CHECK_EQ(fault.index, count);
+
+    SelfTests_ConfigReg_Monitor_Init(NULL, 0u);
+    STL_CHECK_EQ(monitor_round(), PASS_COMPLETE_STATUS);
+}
+
+
+int main(void)
+{
+    if (stl_test_flash() == NULL)
+    {
+        fprintf(stderr, "Cannot map the simulated Flash\n");
+        return 1;
+    }
+
+    test_not_initialized();
+    test_drift();
+    test_corrupted_golden();
+
+    return stl_test_result("test_config_regs");
+}
+
+
+/* [] END OF FILE */
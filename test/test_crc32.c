@@ -0,0 +1,202 @@
+/*******************************************************************************
+* File Name: test_crc32.c
+*
+* Description:
+*  This file checks the standard CRC-32 (IEEE 802.3) of the library against
+*  zlib and the CRC-32C against a bitwise reference, for all alignments of the
+*  slice-by-4 path, split (accumulated) calculations, and empty areas.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#include <zlib.h>
+
+#include "SelfTest_CRC_calc.h"
+#include "stl_test.h"
+
+/* Length of the random test data */
+#define DATA_SIZE           (4096UL)
+
+/* Reflected CRC-32C polynomial */
+#define CRC32C_POLY         (0x82F63B78UL)
+
+
+/*******************************************************************************
+ * Function Name: ref_crc32c
+ *******************************************************************************
+ *
+ * Summary:
+ *  Bitwise CRC-32C, continued from crc as SelfTests_CRC32C_ACC.
+ *
+ ******************************************************************************/
+static uint32_t ref_crc32c(uint32_t crc, const uint8_t* data, uint32_t len)
+{
+    crc = ~crc;
+    for (uint32_t i = 0u; i < len; i++)
+    {
+        crc ^= data[i];
+        for (uint32_t bit = 0u; bit < 8u; bit++)
+        {
+            crc = ((crc & 1u) != 0u) ? ((crc >> 1u) ^ CRC32C_POLY) : (crc >> 1u);
+        }
+    }
+    return ~crc;
+}
+
+
+/*******************************************************************************
+ * Function Name: test_check_values
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks the "123456789" check values and the empty area.
+ *
+ ******************************************************************************/
+static void test_check_values(uint8_t* flash)
+{
+    uint32_t base = STL_TEST_FLASH_BASE;
+
+    (void)memcpy(flash, "123456789", 9u);
+    STL_CHECK_EQ(SelfTests_CRC32_IEEE(base, 9u), CRC32_IEEE_CHECK);
+    STL_CHECK_EQ(crc32(0UL, flash, 9u), CRC32_IEEE_CHECK);
+    STL_CHECK_EQ(SelfTests_CRC32C(base, 9u), CRC32C_CHECK);
+    STL_CHECK_EQ(ref_crc32c(0u, flash, 9u), CRC32C_CHECK);
+
+    /* Empty area */
+    STL_CHECK_EQ(SelfTests_CRC32_IEEE(base, 0u), crc32(0UL, Z_NULL, 0u));
+    STL_CHECK_EQ(SelfTests_CRC32_IEEE(base, 0u), 0u);
+    STL_CHECK_EQ(SelfTests_CRC32C(base, 0u), 0u);
+    STL_CHECK_EQ(SelfTests_CRC32_IEEE_ACC(CRC32_IEEE_CHECK, base, 0u), CRC32_IEEE_CHECK);
+    STL_CHECK_EQ(SelfTests_CRC32C_ACC(CRC32C_CHECK, base, 0u), CRC32C_CHECK);
+    STL_CHECK_EQ(SelfTests_CRC32_IEEE_Combine(CRC32_IEEE_CHECK, 0u, 0u), CRC32_IEEE_CHECK);
+    STL_CHECK_EQ(SelfTests_CRC32C_Combine(CRC32C_CHECK, 0u, 0u), CRC32C_CHECK);
+}
+
+
+/*******************************************************************************
+ * Function Name: test_areas
+ *******************************************************************************
+ *
+ * Summary:
+ *  Compares whole-area CRCs for every start alignment and lengths around the
+ *  4-byte word boundaries.
+ *
+ ******************************************************************************/
+static void test_areas(const uint8_t* flash)
+{
+    for (uint32_t offset = 0u; offset < 8u; offset++)
+    {
+        for (uint32_t len = 0u; len < 80u; len++)
+        {
+            uint32_t base = STL_TEST_FLASH_BASE + offset;
+
+            STL_CHECK_EQ(SelfTests_CRC32_IEEE(base, len), crc32(0UL, &flash[offset], len));
+            STL_CHECK_EQ(SelfTests_CRC32C(base, len), ref_crc32c(0u, &flash[offset], len));
+        }
+    }
+
+    STL_CHECK_EQ(SelfTests_CRC32_IEEE(STL_TEST_FLASH_BASE, DATA_SIZE),
+                 crc32(0UL, flash, DATA_SIZE));
+    STL_CHECK_EQ(SelfTests_CRC32C(STL_TEST_FLASH_BASE, DATA_SIZE),
+                 ref_crc32c(0u, flash, DATA_SIZE));
+}
+
+
+/*******************************************************************************
+ * Function Name: test_chunks
+ *******************************************************************************
+ *
+ * Summary:
+ *  Calculates the CRC of the test data in chunks with the _ACC functions and
+ *  from two halves with the _Combine functions, and compares them with zlib
+ *  crc32(), crc32_combine(), and the whole-area reference.
+ *
+ ******************************************************************************/
+static void test_chunks(const uint8_t* flash)
+{
+    static const uint32_t chunks[] = { 1u, 3u, 4u, 5u, 63u, 64u, 1000u, DATA_SIZE };
+    uint32_t ieeeRef = (uint32_t)crc32(0UL, flash, DATA_SIZE);
+    uint32_t crc32cRef = ref_crc32c(0u, flash, DATA_SIZE);
+
+    for (uint32_t c = 0u; c < (sizeof(chunks) / sizeof(chunks[0])); c++)
+    {
+        uint32_t ieee = 0u;
+        uint32_t castagnoli = 0u;
+        uLong zcrc = crc32(0UL, Z_NULL, 0u);
+
+        for (uint32_t pos = 0u; pos < DATA_SIZE; pos += chunks[c])
+        {
+            uint32_t len = ((DATA_SIZE - pos) < chunks[c]) ? (DATA_SIZE - pos) : chunks[c];
+
+            ieee = SelfTests_CRC32_IEEE_ACC(ieee, STL_TEST_FLASH_BASE + pos, len);
+            castagnoli = SelfTests_CRC32C_ACC(castagnoli, STL_TEST_FLASH_BASE + pos, len);
+            zcrc = crc32(zcrc, &flash[pos], len);
+            STL_CHECK_EQ(ieee, zcrc);
+        }
+        STL_CHECK_EQ(ieee, ieeeRef);
+        STL_CHECK_EQ(castagnoli, crc32cRef);
+    }
+
+    for (uint32_t split = 0u; split <= DATA_SIZE; split += 257u)
+    {
+        uint32_t len2 = DATA_SIZE - split;
+        uint32_t ieee1 = SelfTests_CRC32_IEEE(STL_TEST_FLASH_BASE, split);
+        uint32_t ieee2 = SelfTests_CRC32_IEEE(STL_TEST_FLASH_BASE + split, len2);
+        uint32_t castagnoli1 = SelfTests_CRC32C(STL_TEST_FLASH_BASE, split);
+        uint32_t castagnoli2 = SelfTests_CRC32C(STL_TEST_FLASH_BASE + split, len2);
+
+        STL_CHECK_EQ(SelfTests_CRC32_IEEE_Combine(ieee1, ieee2, len2),
+                     crc32_combine(ieee1, ieee2, (z_off_t)len2));
+        STL_CHECK_EQ(SelfTests_CRC32_IEEE_Combine(ieee1, ieee2, len2), ieeeRef);
+        STL_CHECK_EQ(SelfTests_CRC32C_Combine(castagnoli1, castagnoli2, len2), crc32cRef);
+    }
+}
+
+
+int main(void)
+{
+    uint8_t* flash = stl_test_flash();
+
+    if (flash == NULL)
+    {
+        fprintf(stderr, "Cannot map the simulated Flash\n");
+        return 1;
+    }
+
+    test_check_values(flash);
+    stl_test_fill(flash, DATA_SIZE + 8u, 0x4352u);
+    test_areas(flash);
+    test_chunks(flash);
+
+    return stl_test_result("test_crc32");
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,305 @@
+/*******************************************************************************
+* File Name: test_crc_engine.c
+*
+* Description:
+*  This file checks the generic CRC engine with every STL_CRC_CFG_*
+*  configuration and every table size: the known-answer test, a bitwise
+*  reference over random data, split calculations, and the combine functions
+*  of the fixed CRC variants that the configurations equal.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#include "SelfTest_CRC_calc.h"
+#include "SelfTest_CRC_Engine.h"
+#include "stl_test.h"
+
+/* Length of the random test data */
+#define DATA_SIZE           (1024UL)
+
+/* Configurations under test */
+static const stl_crc_cfg_t configs[] =
+{
+    STL_CRC_CFG_CRC8_SAE_J1850,
+    STL_CRC_CFG_CRC8_AUTOSAR,
+    STL_CRC_CFG_CRC16_MODBUS,
+    STL_CRC_CFG_CRC16_XMODEM,
+    STL_CRC_CFG_CRC24_OPENPGP,
+    STL_CRC_CFG_CRC32_IEEE,
+    STL_CRC_CFG_CRC32_AUTOSAR
+};
+
+#define CONFIG_COUNT        (sizeof(configs) / sizeof(configs[0]))
+#define CFG_XMODEM          (3u)
+#define CFG_IEEE            (5u)
+
+static const stl_crc_table_mode_t modes[] =
+{
+    STL_CRC_TABLE_NONE, STL_CRC_TABLE_NIBBLE, STL_CRC_TABLE_BYTE
+};
+
+#define MODE_COUNT          (sizeof(modes) / sizeof(modes[0]))
+
+static uint32_t table[STL_CRC_TABLE_BYTE];
+
+
+/*******************************************************************************
+ * Function Name: ref_reflect
+ *******************************************************************************
+ *
+ * Summary:
+ *  Reverses the order of the lower width bits of val.
+ *
+ ******************************************************************************/
+static uint32_t ref_reflect(uint32_t val, uint32_t width)
+{
+    uint32_t res = 0u;
+
+    for (uint32_t i = 0u; i < width; i++)
+    {
+        res = (res << 1u) | ((val >> i) & 1u);
+    }
+    return res;
+}
+
+
+/*******************************************************************************
+ * Function Name: ref_crc
+ *******************************************************************************
+ *
+ * Summary:
+ *  Bitwise CRC of the parameter model, one input bit per step.
+ *
+ ******************************************************************************/
+static uint32_t ref_crc(const stl_crc_cfg_t* cfg, const uint8_t* data, uint32_t len)
+{
+    uint64_t top = 1ULL << (cfg->width - 1u);
+    uint64_t mask = (top << 1u) - 1u;
+    uint64_t reg = cfg->init & mask;
+
+    for (uint32_t i = 0u; i < len; i++)
+    {
+        uint32_t val = cfg->refIn ? ref_reflect(data[i], 8u) : data[i];
+
+        for (uint32_t bit = 8u; bit > 0u; bit--)
+        {
+            bool feedback = ((reg & top) != 0u) != (((val >> (bit - 1u)) & 1u) != 0u);
+
+            reg = (reg << 1u) & mask;
+            if (feedback)
+            {
+                reg ^= cfg->poly & mask;
+            }
+        }
+    }
+    if (cfg->refOut)
+    {
+        reg = ref_reflect((uint32_t)reg, cfg->width);
+    }
+    return (uint32_t)((reg ^ cfg->xorOut) & mask);
+}
+
+
+/*******************************************************************************
+ * Function Name: test_kat
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks the check value of every configuration with every table size, and
+ *  the rejected engine parameters.
+ *
+ ******************************************************************************/
+static void test_kat(void)
+{
+    static const uint8_t check[STL_CRC_CHECK_LEN] = "123456789";
+    stl_crc_engine_t engine;
+    stl_crc_cfg_t bad = configs[0];
+
+    for (uint32_t c = 0u; c < CONFIG_COUNT; c++)
+    {
+        STL_CHECK_EQ(ref_crc(&configs[c], check, STL_CRC_CHECK_LEN), configs[c].check);
+        for (uint32_t m = 0u; m < MODE_COUNT; m++)
+        {
+            STL_CHECK_EQ(SelfTests_CRC_Engine_Init(&engine, &configs[c], modes[m], table),
+                         OK_STATUS);
+            STL_CHECK_EQ(SelfTests_CRC_Engine_KAT(&engine), OK_STATUS);
+
+            /* A wrong entry of the first lookup for '1' fails the known-answer test */
+            if (modes[m] != STL_CRC_TABLE_NONE)
+            {
+                uint32_t idxBits = (modes[m] == STL_CRC_TABLE_BYTE) ? 8u : 4u;
+                uint32_t idx = configs[c].refIn ? (engine.init ^ 0x31u) :
+                               ((engine.init >> (32u - idxBits)) ^ (0x31u >> (8u - idxBits)));
+
+                table[idx & ((uint32_t)modes[m] - 1u)] ^= 0x80000001UL;
+                STL_CHECK_EQ(SelfTests_CRC_Engine_KAT(&engine), ERROR_STATUS);
+            }
+        }
+    }
+
+    /* The library known-answer test covers the same configurations */
+    STL_CHECK_EQ(SelfTests_CRC_KAT(), OK_STATUS);
+
+    /* The check value of the fixed variants */
+    STL_CHECK_EQ(configs[CFG_XMODEM].check, CRC16_CCITT_CHECK);
+    STL_CHECK_EQ(configs[CFG_IEEE].check, CRC32_IEEE_CHECK);
+
+    bad.width = 0u;
+    STL_CHECK_EQ(SelfTests_CRC_Engine_Init(&engine, &bad, STL_CRC_TABLE_NONE, NULL),
+                 ERROR_STATUS);
+    bad.width = 33u;
+    STL_CHECK_EQ(SelfTests_CRC_Engine_Init(&engine, &bad, STL_CRC_TABLE_NONE, NULL),
+                 ERROR_STATUS);
+    STL_CHECK_EQ(SelfTests_CRC_Engine_Init(&engine, &configs[0], STL_CRC_TABLE_BYTE, NULL),
+                 ERROR_STATUS);
+    STL_CHECK_EQ(SelfTests_CRC_Engine_Init(&engine, &configs[0], (stl_crc_table_mode_t)8u,
+                                           table), ERROR_STATUS);
+    STL_CHECK_EQ(SelfTests_CRC_Engine_Init(&engine, NULL, STL_CRC_TABLE_NONE, NULL),
+                 ERROR_STATUS);
+}
+
+
+/*******************************************************************************
+ * Function Name: test_reference
+ *******************************************************************************
+ *
+ * Summary:
+ *  Compares every configuration and table size with the bitwise reference
+ *  over random data of all lengths up to 64 bytes and of DATA_SIZE bytes,
+ *  and calculated in two parts with the engine register.
+ *
+ ******************************************************************************/
+static void test_reference(const uint8_t* data)
+{
+    uint32_t addr = (uint32_t)(uintptr_t)data;
+    stl_crc_engine_t engine;
+
+    for (uint32_t c = 0u; c < CONFIG_COUNT; c++)
+    {
+        for (uint32_t m = 0u; m < MODE_COUNT; m++)
+        {
+            (void)SelfTests_CRC_Engine_Init(&engine, &configs[c], modes[m], table);
+            for (uint32_t len = 0u; len <= 64u; len++)
+            {
+                STL_CHECK_EQ(SelfTests_CRC_Engine_Calc(&engine, addr + 1u, len),
+                             ref_crc(&configs[c], data + 1u, len));
+            }
+            STL_CHECK_EQ(SelfTests_CRC_Engine_Calc(&engine, addr, DATA_SIZE),
+                         ref_crc(&configs[c], data, DATA_SIZE));
+
+            for (uint32_t split = 0u; split <= DATA_SIZE; split += 97u)
+            {
+                uint32_t reg = SelfTests_CRC_Engine_Start(&engine);
+
+                reg = SelfTests_CRC_Engine_Update(&engine, reg, addr, split);
+                reg = SelfTests_CRC_Engine_Update(&engine, reg, addr + split, DATA_SIZE - split);
+                STL_CHECK_EQ(SelfTests_CRC_Engine_Final(&engine, reg),
+                             ref_crc(&configs[c], data, DATA_SIZE));
+            }
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: test_combine
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks that the CRC-16/XMODEM and CRC-32/ISO-HDLC configurations equal the
+ *  fixed CRC16 CCITT and CRC-32 (IEEE) functions, so that their combine
+ *  functions merge engine results of two parts into the engine result of the
+ *  whole area.
+ *
+ ******************************************************************************/
+static void test_combine(const uint8_t* data)
+{
+    uint32_t addr = (uint32_t)(uintptr_t)data;
+    stl_crc_engine_t xmodem;
+    stl_crc_engine_t ieee;
+    stl_crc_segment_t segments[3u];
+
+    (void)SelfTests_CRC_Engine_Init(&xmodem, &configs[CFG_XMODEM], STL_CRC_TABLE_NIBBLE, table);
+    STL_CHECK_EQ(SelfTests_CRC_Engine_Calc(&xmodem, addr, DATA_SIZE),
+                 SelfTests_CRC16_CCITT_Block(0u, addr, DATA_SIZE));
+    for (uint32_t split = 0u; split <= DATA_SIZE; split += 61u)
+    {
+        uint16_t crc1 = (uint16_t)SelfTests_CRC_Engine_Calc(&xmodem, addr, split);
+        uint16_t crc2 = (uint16_t)SelfTests_CRC_Engine_Calc(&xmodem, addr + split,
+                                                            DATA_SIZE - split);
+
+        STL_CHECK_EQ(SelfTests_CRC16_CCITT_Combine(crc1, crc2, DATA_SIZE - split),
+                     SelfTests_CRC_Engine_Calc(&xmodem, addr, DATA_SIZE));
+    }
+
+    (void)SelfTests_CRC_Engine_Init(&ieee, &configs[CFG_IEEE], STL_CRC_TABLE_NONE, NULL);
+    STL_CHECK_EQ(SelfTests_CRC_Engine_Calc(&ieee, addr, DATA_SIZE),
+                 SelfTests_CRC32_IEEE(addr, DATA_SIZE));
+    for (uint32_t split = 0u; split <= DATA_SIZE; split += 61u)
+    {
+        uint32_t crc1 = SelfTests_CRC_Engine_Calc(&ieee, addr, split);
+        uint32_t crc2 = SelfTests_CRC_Engine_Calc(&ieee, addr + split, DATA_SIZE - split);
+
+        STL_CHECK_EQ(SelfTests_CRC32_IEEE_Combine(crc1, crc2, DATA_SIZE - split),
+                     SelfTests_CRC_Engine_Calc(&ieee, addr, DATA_SIZE));
+    }
+
+    /* Three segments of different lengths */
+    segments[0].length = 100u;
+    segments[1].length = 1u;
+    segments[2].length = DATA_SIZE - 101u;
+    segments[0].crc = SelfTests_CRC_Engine_Calc(&ieee, addr, 100u);
+    segments[1].crc = SelfTests_CRC_Engine_Calc(&ieee, addr + 100u, 1u);
+    segments[2].crc = SelfTests_CRC_Engine_Calc(&ieee, addr + 101u, DATA_SIZE - 101u);
+    STL_CHECK_EQ(SelfTests_CRC_CombineSegments(STL_CRC_32_IEEE, segments, 3u),
+                 SelfTests_CRC_Engine_Calc(&ieee, addr, DATA_SIZE));
+}
+
+
+int main(void)
+{
+    uint8_t* flash = stl_test_flash();
+
+    if (flash == NULL)
+    {
+        fprintf(stderr, "Cannot map the simulated Flash\n");
+        return 1;
+    }
+
+    stl_test_fill(flash, DATA_SIZE, 0x454Eu);
+    test_kat();
+    test_reference(flash);
+    test_combine(flash);
+
+    return stl_test_result("test_crc_engine");
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,384 @@
+/*******************************************************************************
+* File Name: test_flash_checksum.c
+*
+* Description:
+*  This file checks the checksum kernels and the output of the
+*  stl_flash_checksum host tool against a host build of the Flash test and CRC
+*  sources of the library, including the sector CRC table.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "SelfTest_Flash.h"
+#include "SelfTest_CRC_calc.h"
+#include "stl_checksum.h"
+#include "stl_test.h"
+
+/* Length of the checked range and sector size of the tool runs */
+#define RANGE_SIZE          (0x10000UL)
+#define SECTOR_SIZE         (0x1000UL)
+#define SECTOR_COUNT        (RANGE_SIZE / SECTOR_SIZE)
+
+/* Path of the tool, set by the Makefile */
+#if !defined(STL_FLASH_CHECKSUM_TOOL)
+#define STL_FLASH_CHECKSUM_TOOL "../tools/flash_checksum/stl_flash_checksum"
+#endif
+
+
+/*******************************************************************************
+ * Function Name: target_check
+ *******************************************************************************
+ *
+ * Summary:
+ *  Runs SelfTest_FlashCheckSum() over [start, start + len) in chunks of
+ *  chunkWords with the reference checksum and returns its final status.
+ *  The library keeps the running checksum in static variables that
+ *  SelfTest_Flash_init() does not reset, so each run is made in a new process.
+ *
+ ******************************************************************************/
+static uint8_t target_check(uint32_t start, uint32_t len, uint32_t chunkWords, uint64_t expected)
+{
+    int status = 0;
+    pid_t pid = fork();
+
+    if (pid == 0)
+    {
+        uint8_t ret;
+
+        SelfTest_Flash_init(start, start + len, expected);
+        do
+        {
+            ret = SelfTest_FlashCheckSum(chunkWords);
+        } while (ret == PASS_STILL_TESTING_STATUS);
+        _exit(ret);
+    }
+    if ((pid < 0) || (waitpid(pid, &status, 0) != pid) || (!WIFEXITED(status)))
+    {
+        return 0xFFu;
+    }
+
+    return (uint8_t)WEXITSTATUS(status);
+}
+
+
+/*******************************************************************************
+ * Function Name: check_fletcher64
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks that the library Flash test passes with the reference checksum
+ *  and fails with any other value.
+ *
+ ******************************************************************************/
+static void check_fletcher64(uint32_t len, uint32_t chunkWords, uint64_t expected)
+{
+    STL_CHECK_EQ(target_check(STL_TEST_FLASH_BASE, len, chunkWords, expected),
+                 PASS_COMPLETE_STATUS);
+    STL_CHECK_EQ(target_check(STL_TEST_FLASH_BASE, len, chunkWords, expected ^ 1u),
+                 ERROR_STATUS);
+}
+
+
+/*******************************************************************************
+ * Function Name: test_constants
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks the constants that the tool copies from the library headers.
+ *
+ ******************************************************************************/
+static void test_constants(void)
+{
+    STL_CHECK_EQ(STL_LARGEST_NUM_OF_SUMS, LARGEST_NUM_OF_SUMS);
+    STL_CHECK_EQ(STL_CHECKSUM_INIT_VALUE, CHECKSUM_INIT_VALUE);
+    STL_CHECK_EQ(STL_FLASH_DOUBLE_WORDS_TO_TEST, FLASH_DOUBLE_WORDS_TO_TEST);
+    STL_CHECK_EQ(STL_FLASH_RESERVED_CHECKSUM_SIZE, FLASH_RESERVED_CHECKSUM_SIZE);
+    STL_CHECK_EQ(STL_CRC32_INIT_VALUE, CRC32_INIT_VALUE);
+}
+
+
+/*******************************************************************************
+ * Function Name: test_kernels
+ *******************************************************************************
+ *
+ * Summary:
+ *  Compares the tool kernels with the library for several lengths and chunk
+ *  sizes, including the LARGEST_NUM_OF_SUMS block boundaries.
+ *
+ ******************************************************************************/
+static void test_kernels(const uint8_t* flash)
+{
+    static const uint32_t lengths[] = { 0u, 4u, 1436u, 1440u, 1444u, 2048u, 40000u, RANGE_SIZE };
+    static const uint32_t chunks[] = { 1u, 7u, 359u, 360u, 512u, RANGE_SIZE / 4u };
+
+    for (uint32_t l = 0u; l < (sizeof(lengths) / sizeof(lengths[0])); l++)
+    {
+        uint32_t len = lengths[l];
+        uint32_t crc = stl_crc32_acc(STL_CRC32_INIT_VALUE, flash, len);
+
+        /* The empty range is not tested by the library */
+        if (len == 0u)
+        {
+            STL_CHECK_EQ(crc, CRC32_INIT_VALUE);
+            continue;
+        }
+
+        STL_CHECK_EQ(SelfTests_CRC32_ACC(CRC32_INIT_VALUE, STL_TEST_FLASH_BASE, len), crc);
+        for (uint32_t c = 0u; c < (sizeof(chunks) / sizeof(chunks[0])); c++)
+        {
+            check_fletcher64(len, chunks[c], stl_fletcher64(flash, len, chunks[c]));
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: run_tool
+ *******************************************************************************
+ *
+ * Summary:
+ *  Runs the tool with the options and returns its exit code. The last line of
+ *  its output is parsed into value if value is not NULL.
+ *
+ ******************************************************************************/
+static int run_tool(const char* options, const char* image, uint64_t* value)
+{
+    char cmd[512];
+    char line[256];
+    FILE* out;
+    int status;
+
+    (void)snprintf(cmd, sizeof(cmd), "%s -q %s %s 2>/dev/null", STL_FLASH_CHECKSUM_TOOL,
+                   options, image);
+    out = popen(cmd, "r");
+    if (out == NULL)
+    {
+        return -1;
+    }
+    while (fgets(line, sizeof(line), out) != NULL)
+    {
+        if (value != NULL)
+        {
+            *value = strtoull(line, NULL, 0);
+        }
+    }
+    status = pclose(out);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+
+/*******************************************************************************
+ * Function Name: write_image
+ *******************************************************************************
+ *
+ * Summary:
+ *  Writes the first size bytes of the simulated Flash to a new raw binary
+ *  image. Returns 0 on success.
+ *
+ ******************************************************************************/
+static int write_image(char* image, const uint8_t* flash, uint32_t size)
+{
+    int fd = mkstemp(image);
+    int rc = -1;
+
+    if (fd >= 0)
+    {
+        rc = (write(fd, flash, size) == (ssize_t)size) ? 0 : -1;
+        (void)close(fd);
+    }
+    return rc;
+}
+
+
+/*******************************************************************************
+ * Function Name: read_image
+ *******************************************************************************
+ *
+ * Summary:
+ *  Reads size bytes of a patched raw binary image into the simulated Flash.
+ *
+ ******************************************************************************/
+static void read_image(const char* image, uint8_t* flash, uint32_t size)
+{
+    FILE* f = fopen(image, "rb");
+
+    STL_CHECK(f != NULL);
+    if (f != NULL)
+    {
+        STL_CHECK(fread(flash, 1u, size, f) == size);
+        (void)fclose(f);
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: test_tool
+ *******************************************************************************
+ *
+ * Summary:
+ *  Runs the tool on a raw binary image of the simulated Flash and checks the
+ *  printed and the patched values with the library. The image holds the range
+ *  and the checksum slot.
+ *
+ ******************************************************************************/
+static void test_tool(uint8_t* flash)
+{
+    char image[] = "/tmp/stl_test_imageXXXXXX";
+    char patched[sizeof(image) + 4u];
+    char options[256];
+    uint32_t end = STL_TEST_FLASH_BASE + RANGE_SIZE;
+    uint32_t imageSize = RANGE_SIZE + FLASH_RESERVED_CHECKSUM_SIZE;
+    uint64_t value = 0u;
+    uint64_t stored = 0u;
+
+    (void)memset(&flash[RANGE_SIZE], 0, FLASH_RESERVED_CHECKSUM_SIZE);
+    STL_CHECK_EQ(write_image(image, flash, imageSize), 0);
+    (void)snprintf(patched, sizeof(patched), "%s.bin", image);
+
+    /* Printed values */
+    (void)snprintf(options, sizeof(options), "-b 0x%lx -s 0x%lx -e 0x%" PRIx32 " -c 100",
+                   STL_TEST_FLASH_BASE, STL_TEST_FLASH_BASE, end);
+    STL_CHECK_EQ(run_tool(options, image, &value), 0);
+    check_fletcher64(RANGE_SIZE, 100u, value);
+
+    (void)snprintf(options, sizeof(options), "-b 0x%lx -s 0x%lx -e 0x%" PRIx32 " -a crc32",
+                   STL_TEST_FLASH_BASE, STL_TEST_FLASH_BASE, end);
+    STL_CHECK_EQ(run_tool(options, image, &value), 0);
+    STL_CHECK_EQ(value, SelfTests_CRC32_ACC(CRC32_INIT_VALUE, STL_TEST_FLASH_BASE, RANGE_SIZE));
+
+    /* Patched image: the stored checksum is accepted by the library */
+    (void)snprintf(options, sizeof(options), "-b 0x%lx -s 0x%lx -e 0x%" PRIx32 " -o %s",
+                   STL_TEST_FLASH_BASE, STL_TEST_FLASH_BASE, end, patched);
+    STL_CHECK_EQ(run_tool(options, image, &value), 0);
+    read_image(patched, flash, imageSize);
+    (void)memcpy(&stored, &flash[RANGE_SIZE], sizeof(stored));
+    STL_CHECK_EQ(stored, value);
+    check_fletcher64(RANGE_SIZE, FLASH_DOUBLE_WORDS_TO_TEST, stored);
+
+    /* Rejected range */
+    (void)snprintf(options, sizeof(options), "-b 0x%lx -s 0x%" PRIx32 " -e 0x%lx",
+                   STL_TEST_FLASH_BASE, end, STL_TEST_FLASH_BASE);
+    STL_CHECK_EQ(run_tool(options, image, NULL), 2);
+
+    (void)remove(image);
+    (void)remove(patched);
+}
+
+
+/*******************************************************************************
+ * Function Name: test_sector_table
+ *******************************************************************************
+ *
+ * Summary:
+ *  Runs the tool with a sector CRC table placed after the checksum slot and
+ *  checks the table with the sector functions of the library. Checks that a
+ *  table overlapping the range or the slot is rejected.
+ *
+ ******************************************************************************/
+static void test_sector_table(uint8_t* flash)
+{
+    char image[] = "/tmp/stl_test_imageXXXXXX";
+    char patched[sizeof(image) + 4u];
+    char options[256];
+    uint32_t end = STL_TEST_FLASH_BASE + RANGE_SIZE;
+    uint32_t table = end + FLASH_RESERVED_CHECKSUM_SIZE;
+    uint32_t imageSize = RANGE_SIZE + FLASH_RESERVED_CHECKSUM_SIZE + (SECTOR_COUNT * 4u);
+    uint32_t dirtyMap[FLASH_SECTOR_MAP_WORDS(SECTOR_COUNT)];
+    const uint32_t* refCrc = (const uint32_t*)&flash[RANGE_SIZE + FLASH_RESERVED_CHECKSUM_SIZE];
+    stl_flash_sector_ctx_t sectors;
+
+    (void)memset(&flash[RANGE_SIZE], 0, imageSize - RANGE_SIZE);
+    STL_CHECK_EQ(write_image(image, flash, imageSize), 0);
+    (void)snprintf(patched, sizeof(patched), "%s.bin", image);
+
+    (void)snprintf(options, sizeof(options),
+                   "-b 0x%lx -s 0x%lx -e 0x%" PRIx32 " -S 0x%lx -T 0x%" PRIx32 " -o %s",
+                   STL_TEST_FLASH_BASE, STL_TEST_FLASH_BASE, end, SECTOR_SIZE, table, patched);
+    STL_CHECK_EQ(run_tool(options, image, NULL), 0);
+    read_image(patched, flash, imageSize);
+    for (uint32_t i = 0u; i < SECTOR_COUNT; i++)
+    {
+        STL_CHECK_EQ(refCrc[i], SelfTests_CRC32(STL_TEST_FLASH_BASE + (i * SECTOR_SIZE),
+                                                SECTOR_SIZE));
+    }
+
+    SelfTest_Flash_Sector_Init(&sectors, STL_TEST_FLASH_BASE, SECTOR_SIZE, SECTOR_COUNT, refCrc,
+                               dirtyMap);
+    SelfTest_Flash_Sector_MarkDirty(&sectors, STL_TEST_FLASH_BASE, RANGE_SIZE);
+    STL_CHECK_EQ(SelfTest_Flash_Sector_Revalidate(&sectors, SECTOR_COUNT), PASS_COMPLETE_STATUS);
+    STL_CHECK_EQ(SelfTest_Flash_Sector_ImageCrc(&sectors),
+                 SelfTests_CRC32(STL_TEST_FLASH_BASE, RANGE_SIZE));
+
+    /* A table inside the range, over the end of the range, and over the slot */
+    (void)snprintf(options, sizeof(options),
+                   "-b 0x%lx -s 0x%lx -e 0x%" PRIx32 " -S 0x%lx -T 0x%lx -o %s",
+                   STL_TEST_FLASH_BASE, STL_TEST_FLASH_BASE, end, SECTOR_SIZE,
+                   STL_TEST_FLASH_BASE + SECTOR_SIZE, patched);
+    STL_CHECK_EQ(run_tool(options, image, NULL), 2);
+    (void)snprintf(options, sizeof(options),
+                   "-b 0x%lx -s 0x%lx -e 0x%" PRIx32 " -S 0x%lx -T 0x%" PRIx32 " -o %s",
+                   STL_TEST_FLASH_BASE, STL_TEST_FLASH_BASE, end, SECTOR_SIZE, end - 4u, patched);
+    STL_CHECK_EQ(run_tool(options, image, NULL), 2);
+    (void)snprintf(options, sizeof(options),
+                   "-b 0x%lx -s 0x%lx -e 0x%" PRIx32 " -S 0x%lx -T 0x%" PRIx32 " -o %s",
+                   STL_TEST_FLASH_BASE, STL_TEST_FLASH_BASE, end, SECTOR_SIZE, end + 4u, patched);
+    STL_CHECK_EQ(run_tool(options, image, NULL), 2);
+
+    (void)remove(image);
+    (void)remove(patched);
+}
+
+
+int main(void)
+{
+    uint8_t* flash = stl_test_flash();
+
+    if (flash == NULL)
+    {
+        fprintf(stderr, "Cannot map the simulated Flash\n");
+        return 1;
+    }
+    stl_test_fill(flash, RANGE_SIZE, 0x5354u);
+
+    test_constants();
+    test_kernels(flash);
+    test_tool(flash);
+    test_sector_table(flash);
+
+    return stl_test_result("test_flash_checksum");
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,326 @@
+/*******************************************************************************
+* File Name: test_flash_deadline.c
+*
+* Description:
+*  This file checks the block size of the deadline-driven Flash test against a
+*  host build of the Flash test sources of the library, with simulated time
+*  stamps.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#include "SelfTest_Flash.h"
+#include "stl_test.h"
+
+/* Length of the checked range in bytes and in words */
+#define RANGE_SIZE          (0x10000UL)
+#define RANGE_WORDS         (RANGE_SIZE / sizeof(uint32_t))
+
+/* Time budget of one pass and nominal call period of the tests in ms */
+#define PASS_TIME_MS        (1000u)
+#define CALL_PERIOD_MS      (10u)
+
+
+/*******************************************************************************
+ * Function Name: reference_checksum
+ *******************************************************************************
+ *
+ * Summary:
+ *  Returns the CRC-32 of the simulated Flash range, as calculated by the
+ *  context API in a single call.
+ *
+ ******************************************************************************/
+static uint64_t reference_checksum(void)
+{
+    stl_flash_context_t ctx;
+
+    SelfTest_Flash_Ctx_Init(&ctx, STL_FLASH_CRC32, STL_TEST_FLASH_BASE,
+                            STL_TEST_FLASH_BASE + RANGE_SIZE, 0u);
+    (void)SelfTest_Flash_Ctx_CheckSum(&ctx, RANGE_WORDS);
+
+    return ctx.checkSum;
+}
+
+
+/*******************************************************************************
+ * Function Name: deadline_init
+ *******************************************************************************
+ *
+ * Summary:
+ *  Initializes ctx for the simulated Flash range and configures the
+ *  deadline-driven mode.
+ *
+ ******************************************************************************/
+static void deadline_init(stl_flash_context_t* ctx, uint64_t expected, uint32_t passTimeMs,
+                          uint32_t maxWordsPerCall)
+{
+    SelfTest_Flash_Ctx_Init(ctx, STL_FLASH_CRC32, STL_TEST_FLASH_BASE,
+                            STL_TEST_FLASH_BASE + RANGE_SIZE, expected);
+    SelfTest_Flash_Ctx_SetDeadline(ctx, passTimeMs, CALL_PERIOD_MS, maxWordsPerCall);
+}
+
+
+/*******************************************************************************
+ * Function Name: test_not_configured
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks that the deadline-driven mode fails without a configured deadline.
+ *
+ ******************************************************************************/
+static void test_not_configured(uint64_t expected)
+{
+    stl_flash_context_t ctx;
+
+    SelfTest_Flash_Ctx_Init(&ctx, STL_FLASH_CRC32, STL_TEST_FLASH_BASE,
+                            STL_TEST_FLASH_BASE + RANGE_SIZE, expected);
+    STL_CHECK_EQ(SelfTest_Flash_Ctx_CheckSum_Deadline(&ctx, 0u), ERROR_STATUS);
+}
+
+
+/*******************************************************************************
+ * Function Name: test_first_block
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks that the first block of a pass spreads the range over the calls at
+ *  the nominal period, also for several calls within the same ms.
+ *
+ ******************************************************************************/
+static void test_first_block(uint64_t expected)
+{
+    stl_flash_context_t ctx;
+    uint32_t first = (RANGE_WORDS + ((PASS_TIME_MS / CALL_PERIOD_MS) - 1u)) /
+                     (PASS_TIME_MS / CALL_PERIOD_MS);
+
+    deadline_init(&ctx, expected, PASS_TIME_MS, 0u);
+    STL_CHECK_EQ(SelfTest_Flash_Ctx_CheckSum_Deadline(&ctx, 0u), PASS_STILL_TESTING_STATUS);
+    STL_CHECK_EQ(ctx.deadlineStatus.chunkWords, first);
+    STL_CHECK_EQ(ctx.deadlineStatus.wordsPerMs, 0u);
+    STL_CHECK(ctx.deadlineStatus.slackMs >= 0);
+    STL_CHECK(ctx.deadlineStatus.deadlineAtRisk == false);
+
+    /* No time has passed, so no throughput is measured yet */
+    STL_CHECK_EQ(SelfTest_Flash_Ctx_CheckSum_Deadline(&ctx, 0u), PASS_STILL_TESTING_STATUS);
+    STL_CHECK(ctx.deadlineStatus.chunkWords <= first);
+    STL_CHECK(ctx.deadlineStatus.chunkWords != 0u);
+    STL_CHECK_EQ(ctx.deadlineStatus.wordsPerMs, 0u);
+}
+
+
+/*******************************************************************************
+ * Function Name: test_constant_period
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks that passes called at the nominal period complete within the budget
+ *  with a steady block size, and that the measured throughput is reported.
+ *
+ ******************************************************************************/
+static void test_constant_period(uint64_t expected)
+{
+    stl_flash_context_t ctx;
+    uint32_t now = 0xFFFFFF00u; /* Wraps around during the first pass */
+    uint32_t first;
+    uint8_t ret;
+
+    deadline_init(&ctx, expected, PASS_TIME_MS, 0u);
+    for (uint32_t pass = 0u; pass < 2u; pass++)
+    {
+        uint32_t calls = 0u;
+
+        first = 0u;
+        do
+        {
+            ret = SelfTest_Flash_Ctx_CheckSum_Deadline(&ctx, now);
+            if (first == 0u)
+            {
+                first = ctx.deadlineStatus.chunkWords;
+            }
+            else if (ret == PASS_STILL_TESTING_STATUS)
+            {
+                /* The rounding of the first block may leave one word less per block */
+                STL_CHECK(ctx.deadlineStatus.chunkWords <= first);
+                STL_CHECK(ctx.deadlineStatus.chunkWords >= (first - 1u));
+                STL_CHECK_EQ(ctx.deadlineStatus.wordsPerMs, first / CALL_PERIOD_MS);
+            }
+            STL_CHECK(ctx.deadlineStatus.deadlineAtRisk == false);
+            now += CALL_PERIOD_MS;
+            calls++;
+        } while ((ret == PASS_STILL_TESTING_STATUS) && (calls < RANGE_WORDS));
+
+        STL_CHECK_EQ(ret, PASS_COMPLETE_STATUS);
+        STL_CHECK(ctx.deadlineStatus.lastPassMs <= PASS_TIME_MS);
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: test_slower_calls
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks that the blocks grow when the calls come at a longer period than
+ *  configured, so the pass still completes within the budget.
+ *
+ ******************************************************************************/
+static void test_slower_calls(uint64_t expected)
+{
+    stl_flash_context_t ctx;
+    uint32_t now = 0u;
+    uint32_t first;
+    uint32_t calls = 0u;
+    uint8_t ret;
+
+    deadline_init(&ctx, expected, PASS_TIME_MS, 0u);
+    ret = SelfTest_Flash_Ctx_CheckSum_Deadline(&ctx, now);
+    first = ctx.deadlineStatus.chunkWords;
+
+    /* The application now calls the test at 2.5 times the nominal period */
+    while ((ret == PASS_STILL_TESTING_STATUS) && (calls < RANGE_WORDS))
+    {
+        now += (CALL_PERIOD_MS * 5u) / 2u;
+        ret = SelfTest_Flash_Ctx_CheckSum_Deadline(&ctx, now);
+        if ((calls == 2u) && (ret == PASS_STILL_TESTING_STATUS))
+        {
+            STL_CHECK(ctx.deadlineStatus.chunkWords >= ((first * 5u) / 2u));
+        }
+        calls++;
+    }
+
+    STL_CHECK_EQ(ret, PASS_COMPLETE_STATUS);
+    STL_CHECK(ctx.deadlineStatus.lastPassMs <= PASS_TIME_MS);
+}
+
+
+/*******************************************************************************
+ * Function Name: test_past_deadline
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks that the blocks stay at FLASH_DEADLINE_MAX_WORDS_PER_CALL when the
+ *  deadline has passed and no limit is configured, and that the late pass is
+ *  reported.
+ *
+ ******************************************************************************/
+static void test_past_deadline(uint64_t expected)
+{
+    stl_flash_context_t ctx;
+    uint32_t now = 0u;
+    uint32_t calls = 0u;
+    uint8_t ret;
+
+    deadline_init(&ctx, expected, 100u, 0u);
+    STL_CHECK_EQ(SelfTest_Flash_Ctx_CheckSum_Deadline(&ctx, now), PASS_STILL_TESTING_STATUS);
+
+    /* The application stalls past the budget of the pass */
+    now = 500u;
+    do
+    {
+        ret = SelfTest_Flash_Ctx_CheckSum_Deadline(&ctx, now);
+        STL_CHECK(ctx.deadlineStatus.chunkWords <= FLASH_DEADLINE_MAX_WORDS_PER_CALL);
+        if (ret == PASS_STILL_TESTING_STATUS)
+        {
+            STL_CHECK_EQ(ctx.deadlineStatus.chunkWords, FLASH_DEADLINE_MAX_WORDS_PER_CALL);
+            STL_CHECK(ctx.deadlineStatus.slackMs < 0);
+            STL_CHECK(ctx.deadlineStatus.deadlineAtRisk == true);
+        }
+        now += CALL_PERIOD_MS;
+        calls++;
+    } while ((ret == PASS_STILL_TESTING_STATUS) && (calls < RANGE_WORDS));
+
+    STL_CHECK_EQ(ret, PASS_COMPLETE_STATUS);
+    STL_CHECK(calls >= (RANGE_WORDS / FLASH_DEADLINE_MAX_WORDS_PER_CALL) - 1u);
+    STL_CHECK(ctx.deadlineStatus.lastPassMs > 100u);
+    STL_CHECK(ctx.deadlineStatus.deadlineAtRisk == true);
+}
+
+
+/*******************************************************************************
+ * Function Name: test_max_words
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks that a configured maxWordsPerCall is respected and that a pass that
+ *  cannot complete with it is reported at risk.
+ *
+ ******************************************************************************/
+static void test_max_words(uint64_t expected)
+{
+    stl_flash_context_t ctx;
+    uint32_t now = 0u;
+    uint32_t calls = 0u;
+    uint8_t ret;
+
+    deadline_init(&ctx, expected, PASS_TIME_MS, 64u);
+    do
+    {
+        ret = SelfTest_Flash_Ctx_CheckSum_Deadline(&ctx, now);
+        STL_CHECK(ctx.deadlineStatus.chunkWords <= 64u);
+        if (calls == 0u)
+        {
+            STL_CHECK(ctx.deadlineStatus.slackMs < 0);
+            STL_CHECK(ctx.deadlineStatus.deadlineAtRisk == true);
+        }
+        now += CALL_PERIOD_MS;
+        calls++;
+    } while ((ret == PASS_STILL_TESTING_STATUS) && (calls < RANGE_WORDS));
+
+    STL_CHECK_EQ(ret, PASS_COMPLETE_STATUS);
+    STL_CHECK_EQ(calls, RANGE_WORDS / 64u);
+    STL_CHECK(ctx.deadlineStatus.lastPassMs > PASS_TIME_MS);
+}
+
+
+int main(void)
+{
+    uint8_t* flash = stl_test_flash();
+    uint64_t expected;
+
+    if (flash == NULL)
+    {
+        fprintf(stderr, "Cannot map the simulated Flash\n");
+        return 1;
+    }
+    stl_test_fill(flash, RANGE_SIZE, 0x444Cu);
+    expected = reference_checksum();
+
+    test_not_configured(expected);
+    test_first_block(expected);
+    test_constant_period(expected);
+    test_slower_calls(expected);
+    test_past_deadline(expected);
+    test_max_words(expected);
+
+    return stl_test_result("test_flash_deadline");
+}
+
+
+/* [] END OF FILE */
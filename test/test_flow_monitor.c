@@ -0,0 +1,292 @@
+/*******************************************************************************
+* File Name: test_flow_monitor.c
+*
+* Description:
+*  This file checks the program flow monitor with a correct sequence, a wrong
+*  checkpoint order, a missed deadline, and time stamps taken before the task
+*  ended, including the wrap-around of the millisecond time stamp.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#include "cy_pdl.h"
+#include "SelfTest_Flow_Monitor.h"
+#include "stl_test.h"
+
+#define TASK_CTRL_SIG       STL_FLOW_SIG_3(1u, 2u, 3u)
+#define TASK_COMM_SIG       STL_FLOW_SIG_2(7u, 8u)
+
+#define TASK_CTRL           (0u)
+#define TASK_COMM           (1u)
+#define TASK_COUNT          (2u)
+
+
+/*******************************************************************************
+ * Function Name: run_ctrl
+ *******************************************************************************
+ *
+ * Summary:
+ *  Runs a sequence of the control task with the given checkpoint IDs and
+ *  returns the status of SelfTest_Flow_End.
+ *
+ ******************************************************************************/
+static uint8_t run_ctrl(stl_flow_task_t* task, uint32_t a, uint32_t b, uint32_t c,
+                        uint32_t timeStampMs)
+{
+    SelfTest_Flow_Begin(task);
+    STL_FLOW_CHECKPOINT(task, a);
+    STL_FLOW_CHECKPOINT(task, b);
+    STL_FLOW_CHECKPOINT(task, c);
+    return SelfTest_Flow_End(task, timeStampMs);
+}
+
+
+/*******************************************************************************
+ * Function Name: run_comm
+ *******************************************************************************
+ *
+ * Summary:
+ *  Runs a correct sequence of the communication task.
+ *
+ ******************************************************************************/
+static uint8_t run_comm(stl_flow_task_t* task, uint32_t timeStampMs)
+{
+    SelfTest_Flow_Begin(task);
+    STL_FLOW_CHECKPOINT(task, 7u);
+    STL_FLOW_CHECKPOINT(task, 8u);
+    return SelfTest_Flow_End(task, timeStampMs);
+}
+
+
+/*******************************************************************************
+ * Function Name: init_tasks
+ *******************************************************************************
+ *
+ * Summary:
+ *  Registers a 10 ms control task and a 50 ms communication task.
+ *
+ ******************************************************************************/
+static void init_tasks(stl_flow_task_t* tasks, uint32_t timeStampMs)
+{
+    const stl_flow_task_t table[TASK_COUNT] =
+    {
+        STL_FLOW_TASK(TASK_CTRL_SIG, 10u),
+        STL_FLOW_TASK(TASK_COMM_SIG, 50u)
+    };
+
+    for (uint32_t i = 0u; i < TASK_COUNT; i++)
+    {
+        tasks[i] = table[i];
+    }
+    SelfTest_Flow_Init(tasks, TASK_COUNT, timeStampMs);
+}
+
+
+/*******************************************************************************
+ * Function Name: test_sequence
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks correct sequences within their deadlines, and that the signature
+ *  macros match the run-time checkpoints.
+ *
+ ******************************************************************************/
+static void test_sequence(void)
+{
+    stl_flow_task_t tasks[TASK_COUNT];
+    uint32_t sig = STL_FLOW_SEED;
+
+    sig = STL_FLOW_STEP(sig, 1u);
+    sig = STL_FLOW_STEP(sig, 2u);
+    sig = STL_FLOW_STEP(sig, 3u);
+    STL_CHECK_EQ(sig, TASK_CTRL_SIG);
+    STL_CHECK(TASK_CTRL_SIG != STL_FLOW_SIG_3(2u, 1u, 3u));
+    STL_CHECK(TASK_CTRL_SIG != STL_FLOW_SIG_2(1u, 2u));
+    STL_CHECK(TASK_CTRL_SIG != STL_FLOW_SIG_4(1u, 2u, 3u, 3u));
+
+    /* No task table */
+    SelfTest_Flow_Init(NULL, 0u, 0u);
+    STL_CHECK_EQ(SelfTest_Flow_Verify(0u), ERROR_STATUS);
+
+    init_tasks(tasks, 1000u);
+    STL_CHECK_EQ(SelfTest_Flow_Verify(1000u), OK_STATUS);
+    STL_CHECK_EQ(SelfTest_Flow_GetFailedTask(), STL_FLOW_NO_FAILED_TASK);
+
+    for (uint32_t t = 1005u; t <= 1100u; t += 5u)
+    {
+        STL_CHECK_EQ(run_ctrl(&tasks[TASK_CTRL], 1u, 2u, 3u, t), OK_STATUS);
+        if ((t % 25u) == 0u)
+        {
+            STL_CHECK_EQ(run_comm(&tasks[TASK_COMM], t), OK_STATUS);
+        }
+        STL_CHECK_EQ(SelfTest_Flow_Verify(t + 3u), OK_STATUS);
+    }
+    STL_CHECK_EQ(tasks[TASK_CTRL].state, STL_FLOW_STATE_IDLE);
+    STL_CHECK_EQ(tasks[TASK_CTRL].lastEndMs, 1100u);
+
+    /* The deadline is reached at equality */
+    STL_CHECK_EQ(SelfTest_Flow_Verify(1110u), OK_STATUS);
+}
+
+
+/*******************************************************************************
+ * Function Name: test_wrong_order
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks that swapped, missing, and repeated checkpoints, and a sequence
+ *  started twice or never started, fail the task until it is registered
+ *  again.
+ *
+ ******************************************************************************/
+static void test_wrong_order(void)
+{
+    stl_flow_task_t tasks[TASK_COUNT];
+
+    init_tasks(tasks, 0u);
+    STL_CHECK_EQ(run_ctrl(&tasks[TASK_CTRL], 1u, 3u, 2u, 1u), ERROR_STATUS);
+    STL_CHECK_EQ(tasks[TASK_CTRL].state, STL_FLOW_STATE_ERROR);
+    STL_CHECK_EQ(SelfTest_Flow_Verify(2u), ERROR_STATUS);
+    STL_CHECK_EQ(SelfTest_Flow_GetFailedTask(), TASK_CTRL);
+
+    /* The error stays until the next SelfTest_Flow_Init */
+    STL_CHECK_EQ(run_ctrl(&tasks[TASK_CTRL], 1u, 2u, 3u, 3u), ERROR_STATUS);
+    STL_CHECK_EQ(SelfTest_Flow_Verify(4u), ERROR_STATUS);
+
+    /* Missing checkpoint */
+    init_tasks(tasks, 0u);
+    SelfTest_Flow_Begin(&tasks[TASK_COMM]);
+    STL_FLOW_CHECKPOINT(&tasks[TASK_COMM], 7u);
+    STL_CHECK_EQ(SelfTest_Flow_End(&tasks[TASK_COMM], 1u), ERROR_STATUS);
+    STL_CHECK_EQ(SelfTest_Flow_Verify(2u), ERROR_STATUS);
+    STL_CHECK_EQ(SelfTest_Flow_GetFailedTask(), TASK_COMM);
+
+    /* Repeated checkpoint */
+    init_tasks(tasks, 0u);
+    STL_CHECK_EQ(run_ctrl(&tasks[TASK_CTRL], 1u, 2u, 2u, 1u), ERROR_STATUS);
+
+    /* Begin while a sequence runs */
+    init_tasks(tasks, 0u);
+    SelfTest_Flow_Begin(&tasks[TASK_CTRL]);
+    STL_CHECK_EQ(run_ctrl(&tasks[TASK_CTRL], 1u, 2u, 3u, 1u), ERROR_STATUS);
+
+    /* End without Begin */
+    init_tasks(tasks, 0u);
+    STL_CHECK_EQ(SelfTest_Flow_End(&tasks[TASK_COMM], 1u), ERROR_STATUS);
+    STL_CHECK_EQ(SelfTest_Flow_Verify(2u), ERROR_STATUS);
+    STL_CHECK_EQ(SelfTest_Flow_GetFailedTask(), TASK_COMM);
+}
+
+
+/*******************************************************************************
+ * Function Name: test_deadline
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks that a task that does not complete a sequence within its deadline
+ *  fails, also across the wrap-around of the time stamp.
+ *
+ ******************************************************************************/
+static void test_deadline(void)
+{
+    stl_flow_task_t tasks[TASK_COUNT];
+
+    /* No sequence since Init */
+    init_tasks(tasks, 0u);
+    STL_CHECK_EQ(SelfTest_Flow_Verify(11u), ERROR_STATUS);
+    STL_CHECK_EQ(SelfTest_Flow_GetFailedTask(), TASK_CTRL);
+
+    /* The control task runs, the communication task is late */
+    init_tasks(tasks, 0u);
+    for (uint32_t t = 5u; t <= 60u; t += 5u)
+    {
+        (void)run_ctrl(&tasks[TASK_CTRL], 1u, 2u, 3u, t);
+    }
+    STL_CHECK_EQ(SelfTest_Flow_Verify(50u), OK_STATUS);
+    STL_CHECK_EQ(SelfTest_Flow_Verify(51u), ERROR_STATUS);
+    STL_CHECK_EQ(SelfTest_Flow_GetFailedTask(), TASK_COMM);
+
+    /* A completed sequence clears the failure of the deadline */
+    STL_CHECK_EQ(run_comm(&tasks[TASK_COMM], 60u), OK_STATUS);
+    STL_CHECK_EQ(SelfTest_Flow_Verify(61u), OK_STATUS);
+    STL_CHECK_EQ(SelfTest_Flow_GetFailedTask(), STL_FLOW_NO_FAILED_TASK);
+
+    /* Across the wrap-around */
+    init_tasks(tasks, 0xFFFFFFFAu);
+    (void)run_comm(&tasks[TASK_COMM], 0xFFFFFFFCu);
+    STL_CHECK_EQ(SelfTest_Flow_Verify(4u), OK_STATUS);
+    STL_CHECK_EQ(SelfTest_Flow_Verify(5u), ERROR_STATUS);
+    STL_CHECK_EQ(SelfTest_Flow_GetFailedTask(), TASK_CTRL);
+}
+
+
+/*******************************************************************************
+ * Function Name: test_late_end
+ *******************************************************************************
+ *
+ * Summary:
+ *  Checks time stamps of SelfTest_Flow_Verify taken before the last
+ *  SelfTest_Flow_End, for example when the task ends in an interrupt after
+ *  the caller read the time, and before SelfTest_Flow_Init.
+ *
+ ******************************************************************************/
+static void test_late_end(void)
+{
+    stl_flow_task_t tasks[TASK_COUNT];
+
+    init_tasks(tasks, 100u);
+    STL_CHECK_EQ(run_ctrl(&tasks[TASK_CTRL], 1u, 2u, 3u, 108u), OK_STATUS);
+    STL_CHECK_EQ(SelfTest_Flow_Verify(107u), OK_STATUS);
+    STL_CHECK_EQ(SelfTest_Flow_Verify(90u), OK_STATUS);
+    STL_CHECK_EQ(SelfTest_Flow_Verify(118u), OK_STATUS);
+    STL_CHECK_EQ(SelfTest_Flow_Verify(119u), ERROR_STATUS);
+
+    /* Before the wrap-around of the time stamp, the sequence ended after it */
+    init_tasks(tasks, 0xFFFFFFF0u);
+    STL_CHECK_EQ(run_ctrl(&tasks[TASK_CTRL], 1u, 2u, 3u, 2u), OK_STATUS);
+    STL_CHECK_EQ(run_comm(&tasks[TASK_COMM], 2u), OK_STATUS);
+    STL_CHECK_EQ(SelfTest_Flow_Verify(0xFFFFFFFEu), OK_STATUS);
+    STL_CHECK_EQ(SelfTest_Flow_Verify(12u), OK_STATUS);
+    STL_CHECK_EQ(SelfTest_Flow_Verify(13u), ERROR_STATUS);
+}
+
+
+int main(void)
+{
+    test_sequence();
+    test_wrong_order();
+    test_deadline();
+    test_late_end();
+
+    return stl_test_result("test_flow_monitor");
+}
+
+
+/* [] END OF FILE */
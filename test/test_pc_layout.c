@@ -0,0 +1,235 @@
+/*******************************************************************************
+* File Name: test_pc_layout.c
+*
+* Description:
+*  This file runs the stl_pc_layout host tool and checks the stub addresses in
+*  the generated header and linker fragments, including the reserved tail of
+*  the Flash regions.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+
+#include "stl_test.h"
+
+/* Path of the tool, set by the Makefile */
+#if !defined(STL_PC_LAYOUT_TOOL)
+#define STL_PC_LAYOUT_TOOL  "../tools/pc_layout/stl_pc_layout"
+#endif
+
+/* Stubs in one layout, and bytes of one stub (MOV R0, PC and BX LR) */
+#define MAX_STUBS           (600u)
+#define STUB_SIZE           (4u)
+
+typedef struct
+{
+    uint32_t base;
+    uint32_t size;
+    int ram;
+} region_t;
+
+/* Regions of the tool runs: XMC7200 code and work Flash, and ITCM */
+static const region_t regions[] =
+{
+    { 0x10000000UL, 0x800000UL, 0 },
+    { 0x14000000UL, 0x40000UL, 0 },
+    { 0x00000000UL, 0x10000UL, 1 }
+};
+static const char regionArgs[] =
+    "flash:0x10000000:0x800000:code_flash flash:0x14000000:0x40000:work_flash "
+    "ram:0x00000000:0x10000";
+
+
+/*******************************************************************************
+ * Function Name: run_tool
+ *******************************************************************************
+ *
+ * Summary:
+ *  Runs the tool with the options and the regions and returns its exit code.
+ *
+ ******************************************************************************/
+static int run_tool(const char* options, const char* prefix)
+{
+    char cmd[512];
+    int status;
+
+    (void)snprintf(cmd, sizeof(cmd), "%s -q %s -o %s %s 2>/dev/null", STL_PC_LAYOUT_TOOL,
+                   options, prefix, regionArgs);
+    status = system(cmd);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+
+/*******************************************************************************
+ * Function Name: read_addresses
+ *******************************************************************************
+ *
+ * Summary:
+ *  Reads the addresses of the lines of a generated file that contain filter
+ *  and match the scanf format, with the address as the only conversion.
+ *  Returns the number read.
+ *
+ ******************************************************************************/
+static uint32_t read_addresses(const char* prefix, const char* ext, const char* format,
+                               const char* filter, uint32_t* addresses)
+{
+    char name[256];
+    char line[256];
+    uint32_t count = 0u;
+    FILE* f;
+
+    (void)snprintf(name, sizeof(name), "%s%s", prefix, ext);
+    f = fopen(name, "r");
+    STL_CHECK(f != NULL);
+    if (f == NULL)
+    {
+        return 0u;
+    }
+    while ((fgets(line, sizeof(line), f) != NULL) && (count < MAX_STUBS))
+    {
+        unsigned int address;
+
+        if ((strstr(line, filter) != NULL) && (sscanf(line, format, &address) == 1))
+        {
+            addresses[count] = (uint32_t)address;
+            count++;
+        }
+    }
+    (void)fclose(f);
+    return count;
+}
+
+
+/*******************************************************************************
+ * Function Name: check_layout
+ *******************************************************************************
+ *
+ * Summary:
+ *  Runs the tool and checks that the Flash stubs are placed below the reserved
+ *  tail of their region, that the top stub of each region is directly below
+ *  the tail, and that all outputs agree on the addresses.
+ *
+ ******************************************************************************/
+static void check_layout(const char* dir, const char* options, uint32_t reserve)
+{
+    static uint32_t table[MAX_STUBS];
+    static uint32_t ld[MAX_STUBS];
+    static uint32_t sct[MAX_STUBS];
+    static uint32_t icf[MAX_STUBS];
+    static uint32_t flash[MAX_STUBS];
+    const region_t* ram = &regions[2];
+    char prefix[256];
+    uint32_t count;
+    uint32_t ldCount;
+
+    (void)snprintf(prefix, sizeof(prefix), "%s/layout", dir);
+    STL_CHECK_EQ(run_tool(options, prefix), 0);
+
+    /* RAM stubs are not placed by the linker and have no reserved tail */
+    count = read_addresses(prefix, ".h", " { 0x%x", "true", table);
+    STL_CHECK(count > 0u);
+    for (uint32_t i = 0u; i < count; i++)
+    {
+        STL_CHECK((table[i] >= ram->base) && ((table[i] + STUB_SIZE) <= (ram->base + ram->size)));
+    }
+    STL_CHECK_EQ(table[count - 1u], ram->base + ram->size - STUB_SIZE);
+
+    count = read_addresses(prefix, ".h", " { 0x%x", "false", flash);
+    ldCount = read_addresses(prefix, ".ld", ".stl_pc_stub_%*u 0x%x :", "", ld);
+    STL_CHECK_EQ(ldCount, count);
+    STL_CHECK_EQ(read_addresses(prefix, ".sct", "STL_PC_STUB_%*u 0x%x", "FIXED", sct), ldCount);
+    STL_CHECK_EQ(read_addresses(prefix, ".icf", "place at address mem:0x%x", "", icf), ldCount);
+
+    for (uint32_t i = 0u; i < ldCount; i++)
+    {
+        int inRegion = 0;
+
+        STL_CHECK_EQ(ld[i], flash[i]);
+        STL_CHECK_EQ(sct[i], ld[i]);
+        STL_CHECK_EQ(icf[i], ld[i]);
+        STL_CHECK_EQ(ld[i] % 4u, 0u);
+        for (uint32_t r = 0u; r < 2u; r++)
+        {
+            if ((ld[i] >= regions[r].base) &&
+                ((ld[i] + STUB_SIZE) <= (regions[r].base + regions[r].size - reserve)))
+            {
+                inRegion = 1;
+            }
+        }
+        STL_CHECK(inRegion != 0);
+    }
+
+    for (uint32_t r = 0u; r < 2u; r++)
+    {
+        uint32_t top = regions[r].base + regions[r].size - reserve - STUB_SIZE;
+        int found = 0;
+
+        for (uint32_t i = 0u; i < ldCount; i++)
+        {
+            found |= (ld[i] == top) ? 1 : 0;
+        }
+        STL_CHECK(found != 0);
+    }
+}
+
+
+int main(void)
+{
+    char dir[] = "/tmp/stl_test_layoutXXXXXX";
+    char cmd[64];
+
+    if (mkdtemp(dir) == NULL)
+    {
+        fprintf(stderr, "Cannot create a temporary directory\n");
+        return 1;
+    }
+
+    check_layout(dir, "", 0u);
+    check_layout(dir, "-w", 0u);
+
+    /* The .flash_checksum slot, and the slot with a sector CRC table of 64 entries */
+    check_layout(dir, "-w -r 8", 8u);
+    check_layout(dir, "-r 0x108", 0x108u);
+
+    /* The reserved size must be word aligned and leave room for the stubs */
+    STL_CHECK_EQ(run_tool("-r 6", dir), 2);
+    STL_CHECK_EQ(run_tool("-r 0x3FFF9", dir), 2);
+
+    (void)snprintf(cmd, sizeof(cmd), "rm -rf %s", dir);
+    (void)system(cmd);
+
+    return stl_test_result("test_pc_layout");
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,644 @@
+/*******************************************************************************
+* File Name: stl_checksum.c
+*
+* Description:
+*  This file provides the host-side models of the mtb-stl Flash checksum
+*  kernels and the ELF/HEX image helpers used by stl_flash_checksum.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#include <elf.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "stl_checksum.h"
+
+
+/* Longest data field written to an output HEX record */
+#define HEX_RECORD_DATA_SIZE    (32u)
+
+/* Table for CRC32 calculation, built on first use */
+static uint32_t crc32_Tab[256];
+static int crc32_TabReady = 0;
+
+
+/*******************************************************************************
+ * Function Name: rd32
+ *******************************************************************************
+ *
+ * Summary:
+ *  Reads a little-endian 32-bit word, the same way the Cortex-M core reads Flash.
+ *
+ ******************************************************************************/
+static uint32_t rd32(const uint8_t* p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+
+/*******************************************************************************
+ * Function Name: stl_fletcher64
+ *******************************************************************************
+ *
+ * Summary:
+ *  Host model of SelfTest_FlashCheckSum() + SelfTest_Fletcher64_CheckSum_Formula().
+ *  The 32-bit reduction is applied after every LARGEST_NUM_OF_SUMS words *and* at
+ *  the end of every SelfTest_FlashCheckSum() call, so chunkWords must match the
+ *  DoubleWordsToTest argument used on target for a bit-exact reference value.
+ *
+ ******************************************************************************/
+uint64_t stl_fletcher64(const uint8_t* data, uint32_t len, uint32_t chunkWords)
+{
+    uint64_t sumA = STL_CHECKSUM_INIT_VALUE;
+    uint64_t sumB = STL_CHECKSUM_INIT_VALUE;
+    uint32_t pos = 0u;
+
+    do
+    {
+        /* One SelfTest_FlashCheckSum() call */
+        uint32_t endOfTest = ((len - pos) > (chunkWords * 4u)) ? (pos + (chunkWords * 4u)) : len;
+        uint32_t doubleWords = (endOfTest - pos) / 4u;
+
+        while (doubleWords != 0u)
+        {
+            uint32_t tlen = (doubleWords > STL_LARGEST_NUM_OF_SUMS) ? STL_LARGEST_NUM_OF_SUMS : doubleWords;
+            doubleWords -= tlen;
+
+            do
+            {
+                sumA = sumA + rd32(&data[pos]);
+                sumB = sumB + sumA;
+                pos += 4u;
+                --tlen;
+            } while (tlen != 0u);
+
+            /* First reduction step to 32 bits */
+            sumA = (sumA & 0xFFFFFFFFu) + (sumA >> 32);
+            sumB = (sumB & 0xFFFFFFFFu) + (sumB >> 32);
+        }
+
+        if (pos == len)
+        {
+            /* Second reduction step to 32 bits */
+            sumA = (sumA & 0xFFFFFFFFu) + (sumA >> 32);
+            sumB = (sumB & 0xFFFFFFFFu) + (sumB >> 32);
+            sumB = (sumB << 32) | sumA;
+        }
+    } while (pos != len);
+
+    return sumB;
+}
+
+
+/*******************************************************************************
+ * Function Name: stl_crc32_acc
+ *******************************************************************************
+ *
+ * Summary:
+ *  Host model of SelfTests_CRC32_ACC(). The target table is the MSB-first table
+ *  of the 0xEDB88320 constant, which is regenerated here rather than copied.
+ *
+ ******************************************************************************/
+uint32_t stl_crc32_acc(uint32_t crc, const uint8_t* data, size_t len)
+{
+    if (crc32_TabReady == 0)
+    {
+        for (uint32_t i = 0u; i < 256u; i++)
+        {
+            uint32_t t = i << 24;
+            for (uint32_t b = 0u; b < 8u; b++)
+            {
+                t = ((t & 0x80000000u) != 0u) ? ((t << 1) ^ STL_CRC32_POLY) : (t << 1);
+            }
+            crc32_Tab[i] = t;
+        }
+        crc32_TabReady = 1;
+    }
+
+    for (size_t i = 0u; i < len; i++)
+    {
+        crc = crc32_Tab[(uint8_t)((crc >> 24) ^ data[i])] ^ (crc << 8);
+    }
+    return crc;
+}
+
+
+/*******************************************************************************
+ * Function Name: img_add_segment
+ ******************************************************************************/
+static int img_add_segment(stl_img_t* img, uint32_t addr, uint32_t size, uint8_t* data)
+{
+    stl_img_segment_t* seg = realloc(img->seg, (img->segCount + 1u) * sizeof(*seg));
+    if (seg == NULL)
+    {
+        return STL_ERR_NOMEM;
+    }
+    img->seg = seg;
+    img->seg[img->segCount].addr = addr;
+    img->seg[img->segCount].size = size;
+    img->seg[img->segCount].data = data;
+    img->segCount++;
+    return STL_OK;
+}
+
+
+/*******************************************************************************
+ * Function Name: img_parse_elf
+ *******************************************************************************
+ *
+ * Summary:
+ *  Maps every PT_LOAD segment with file contents at its load (physical) address,
+ *  which is where the data sits in Flash. Segment data aliases img->raw.
+ *
+ ******************************************************************************/
+static int img_parse_elf(stl_img_t* img)
+{
+    Elf32_Ehdr eh;
+
+    if ((img->rawSize < sizeof(eh)) || (img->raw[EI_CLASS] != ELFCLASS32) ||
+        (img->raw[EI_DATA] != ELFDATA2LSB))
+    {
+        return STL_ERR_FORMAT;
+    }
+    memcpy(&eh, img->raw, sizeof(eh));
+
+    for (uint32_t i = 0u; i < eh.e_phnum; i++)
+    {
+        Elf32_Phdr ph;
+        size_t off = (size_t)eh.e_phoff + ((size_t)i * eh.e_phentsize);
+
+        if ((off + sizeof(ph)) > img->rawSize)
+        {
+            return STL_ERR_FORMAT;
+        }
+        memcpy(&ph, &img->raw[off], sizeof(ph));
+
+        if ((ph.p_type != PT_LOAD) || (ph.p_filesz == 0u))
+        {
+            continue;
+        }
+        if (((size_t)ph.p_offset + ph.p_filesz) > img->rawSize)
+        {
+            return STL_ERR_FORMAT;
+        }
+        if (img_add_segment(img, ph.p_paddr, ph.p_filesz, &img->raw[ph.p_offset]) != STL_OK)
+        {
+            return STL_ERR_NOMEM;
+        }
+    }
+    return STL_OK;
+}
+
+
+/*******************************************************************************
+ * Function Name: hex_byte
+ ******************************************************************************/
+static int hex_byte(const char* s)
+{
+    int v = 0;
+
+    for (int i = 0; i < 2; i++)
+    {
+        char c = s[i];
+        v <<= 4;
+        if ((c >= '0') && (c <= '9'))
+        {
+            v |= c - '0';
+        }
+        else if ((c >= 'A') && (c <= 'F'))
+        {
+            v |= c - 'A' + 10;
+        }
+        else if ((c >= 'a') && (c <= 'f'))
+        {
+            v |= c - 'a' + 10;
+        }
+        else
+        {
+            return -1;
+        }
+    }
+    return v;
+}
+
+
+/*******************************************************************************
+ * Function Name: img_parse_hex
+ *******************************************************************************
+ *
+ * Summary:
+ *  Parses an Intel HEX file. Consecutive data records are merged into one
+ *  segment, so a typical image ends up with a handful of large segments.
+ *
+ ******************************************************************************/
+static int img_parse_hex(stl_img_t* img)
+{
+    uint32_t upper = 0u;
+    uint8_t* cur = NULL;
+    uint32_t curAddr = 0u;
+    uint32_t curSize = 0u;
+    uint32_t curCap = 0u;
+    size_t pos = 0u;
+    int ret = STL_OK;
+
+    while ((ret == STL_OK) && (pos < img->rawSize))
+    {
+        uint8_t rec[5u + 255u];
+        const char* line = (const char*)&img->raw[pos];
+        size_t eol = pos;
+        uint32_t n;
+        uint8_t sum = 0u;
+
+        while ((eol < img->rawSize) && (img->raw[eol] != '\n'))
+        {
+            eol++;
+        }
+        n = (uint32_t)(eol - pos);
+        pos = eol + 1u;
+        while ((n > 0u) && ((line[n - 1u] == '\r') || (line[n - 1u] == ' ')))
+        {
+            n--;
+        }
+        if (n == 0u)
+        {
+            continue;
+        }
+        if ((line[0] != ':') || (n < 11u) || (((n - 1u) & 1u) != 0u) || (((n - 1u) / 2u) > sizeof(rec)))
+        {
+            ret = STL_ERR_FORMAT;
+            break;
+        }
+        for (uint32_t i = 0u; i < ((n - 1u) / 2u); i++)
+        {
+            int b = hex_byte(&line[1u + (2u * i)]);
+            if (b < 0)
+            {
+                ret = STL_ERR_FORMAT;
+                break;
+            }
+            rec[i] = (uint8_t)b;
+            sum = (uint8_t)(sum + (uint8_t)b);
+        }
+        if ((ret != STL_OK) || (sum != 0u) || (((n - 1u) / 2u) != (5u + (uint32_t)rec[0])))
+        {
+            ret = STL_ERR_FORMAT;
+            break;
+        }
+
+        uint32_t len = rec[0];
+        uint32_t addr = upper + (((uint32_t)rec[1] << 8) | rec[2]);
+        const uint8_t* d = &rec[4];
+
+        switch (rec[3])
+        {
+            case 0x00u:
+                if ((cur == NULL) || (addr != (curAddr + curSize)))
+                {
+                    if (cur != NULL)
+                    {
+                        ret = img_add_segment(img, curAddr, curSize, cur);
+                    }
+                    cur = NULL;
+                    curAddr = addr;
+                    curSize = 0u;
+                    curCap = 0u;
+                }
+                if ((ret == STL_OK) && ((curSize + len) > curCap))
+                {
+                    uint8_t* p;
+                    curCap = (curCap == 0u) ? 4096u : curCap;
+                    while ((curSize + len) > curCap)
+                    {
+                        curCap *= 2u;
+                    }
+                    p = realloc(cur, curCap);
+                    if (p == NULL)
+                    {
+                        ret = STL_ERR_NOMEM;
+                        break;
+                    }
+                    cur = p;
+                }
+                if (ret == STL_OK)
+                {
+                    memcpy(&cur[curSize], d, len);
+                    curSize += len;
+                }
+                break;
+
+            case 0x01u:
+                pos = img->rawSize;
+                break;
+
+            case 0x02u:
+                upper = (((uint32_t)d[0] << 8) | d[1]) << 4;
+                break;
+
+            case 0x04u:
+                upper = (((uint32_t)d[0] << 8) | d[1]) << 16;
+                break;
+
+            case 0x03u:
+            case 0x05u:
+                img->hexStart = ((uint32_t)d[0] << 24) | ((uint32_t)d[1] << 16) | ((uint32_t)d[2] << 8) | d[3];
+                img->hexHasStart = 1;
+                img->hexStartType = rec[3];
+                break;
+
+            default:
+                ret = STL_ERR_FORMAT;
+                break;
+        }
+    }
+
+    if (cur != NULL)
+    {
+        if (ret == STL_OK)
+        {
+            ret = img_add_segment(img, curAddr, curSize, cur);
+        }
+        if (ret != STL_OK)
+        {
+            free(cur);
+        }
+    }
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: stl_img_load
+ ******************************************************************************/
+int stl_img_load(stl_img_t* img, const char* path, stl_img_format_t format, uint32_t binBase)
+{
+    FILE* f;
+    long size;
+    int ret;
+
+    memset(img, 0, sizeof(*img));
+
+    f = fopen(path, "rb");
+    if (f == NULL)
+    {
+        return STL_ERR_IO;
+    }
+    if ((fseek(f, 0, SEEK_END) != 0) || ((size = ftell(f)) < 0) || (fseek(f, 0, SEEK_SET) != 0))
+    {
+        fclose(f);
+        return STL_ERR_IO;
+    }
+    img->rawSize = (size_t)size;
+    img->raw = malloc((img->rawSize != 0u) ? img->rawSize : 1u);
+    if (img->raw == NULL)
+    {
+        fclose(f);
+        return STL_ERR_NOMEM;
+    }
+    if (fread(img->raw, 1u, img->rawSize, f) != img->rawSize)
+    {
+        fclose(f);
+        return STL_ERR_IO;
+    }
+    fclose(f);
+
+    if (format == STL_FMT_AUTO)
+    {
+        if ((img->rawSize >= SELFMAG) && (memcmp(img->raw, ELFMAG, SELFMAG) == 0))
+        {
+            format = STL_FMT_ELF;
+        }
+        else if ((img->rawSize > 0u) && (img->raw[0] == ':'))
+        {
+            format = STL_FMT_HEX;
+        }
+        else
+        {
+            format = STL_FMT_BIN;
+        }
+    }
+    img->format = format;
+
+    switch (format)
+    {
+        case STL_FMT_ELF:
+            ret = img_parse_elf(img);
+            break;
+
+        case STL_FMT_HEX:
+            ret = img_parse_hex(img);
+            break;
+
+        default:
+            img->binBase = binBase;
+            ret = img_add_segment(img, binBase, (uint32_t)img->rawSize, img->raw);
+            break;
+    }
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: stl_img_read
+ ******************************************************************************/
+void stl_img_read(const stl_img_t* img, uint32_t start, uint32_t end, uint8_t fill, uint8_t* buf)
+{
+    memset(buf, fill, (size_t)(end - start));
+
+    for (size_t i = 0u; i < img->segCount; i++)
+    {
+        const stl_img_segment_t* s = &img->seg[i];
+        uint64_t lo = (s->addr > start) ? s->addr : start;
+        uint64_t hi = (((uint64_t)s->addr + s->size) < end) ? ((uint64_t)s->addr + s->size) : end;
+
+        if (lo < hi)
+        {
+            memcpy(&buf[lo - start], &s->data[lo - s->addr], (size_t)(hi - lo));
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: stl_img_patch
+ *******************************************************************************
+ *
+ * Summary:
+ *  Writes bytes into the image. ELF and raw images can only be patched where the
+ *  file already holds data (the reserved checksum section); a HEX image gets a
+ *  new segment if the address is not covered yet.
+ *
+ ******************************************************************************/
+int stl_img_patch(stl_img_t* img, uint32_t addr, const uint8_t* bytes, uint32_t size)
+{
+    for (uint32_t k = 0u; k < size; k++)
+    {
+        uint32_t a = addr + k;
+        int found = 0;
+
+        for (size_t i = 0u; i < img->segCount; i++)
+        {
+            if ((a >= img->seg[i].addr) && ((a - img->seg[i].addr) < img->seg[i].size))
+            {
+                img->seg[i].data[a - img->seg[i].addr] = bytes[k];
+                found = 1;
+            }
+        }
+        if (found == 0)
+        {
+            uint8_t* d;
+
+            if (img->format != STL_FMT_HEX)
+            {
+                return STL_ERR_RANGE;
+            }
+            d = malloc(size - k);
+            if (d == NULL)
+            {
+                return STL_ERR_NOMEM;
+            }
+            memcpy(d, &bytes[k], size - k);
+            if (img_add_segment(img, a, size - k, d) != STL_OK)
+            {
+                free(d);
+                return STL_ERR_NOMEM;
+            }
+            break;
+        }
+    }
+    return STL_OK;
+}
+
+
+/*******************************************************************************
+ * Function Name: hex_record
+ ******************************************************************************/
+static void hex_record(FILE* f, uint8_t type, uint16_t addr, const uint8_t* d, uint32_t len)
+{
+    uint8_t sum = (uint8_t)(len + (addr >> 8) + (addr & 0xFFu) + type);
+
+    fprintf(f, ":%02X%04X%02X", (unsigned)len, (unsigned)addr, (unsigned)type);
+    for (uint32_t i = 0u; i < len; i++)
+    {
+        fprintf(f, "%02X", d[i]);
+        sum = (uint8_t)(sum + d[i]);
+    }
+    fprintf(f, "%02X\n", (unsigned)(uint8_t)(0u - sum));
+}
+
+
+/*******************************************************************************
+ * Function Name: stl_img_save
+ ******************************************************************************/
+int stl_img_save(const stl_img_t* img, const char* path)
+{
+    FILE* f = fopen(path, (img->format == STL_FMT_HEX) ? "w" : "wb");
+    int ret = STL_OK;
+
+    if (f == NULL)
+    {
+        return STL_ERR_IO;
+    }
+
+    if (img->format != STL_FMT_HEX)
+    {
+        /* Segment data aliases the raw file, so patches are already in place */
+        if (fwrite(img->raw, 1u, img->rawSize, f) != img->rawSize)
+        {
+            ret = STL_ERR_IO;
+        }
+    }
+    else
+    {
+        uint32_t upper = 0xFFFFFFFFu;
+
+        for (size_t i = 0u; i < img->segCount; i++)
+        {
+            const stl_img_segment_t* s = &img->seg[i];
+            uint32_t off = 0u;
+
+            while (off < s->size)
+            {
+                uint32_t a = s->addr + off;
+                uint32_t len = s->size - off;
+
+                if ((a & 0xFFFF0000u) != upper)
+                {
+                    uint8_t ela[2] = { (uint8_t)(a >> 24), (uint8_t)(a >> 16) };
+                    upper = a & 0xFFFF0000u;
+                    hex_record(f, 0x04u, 0u, ela, 2u);
+                }
+                len = (len > HEX_RECORD_DATA_SIZE) ? HEX_RECORD_DATA_SIZE : len;
+                /* Do not let a record cross a 64 KB boundary */
+                if (((a & 0xFFFFu) + len) > 0x10000u)
+                {
+                    len = 0x10000u - (a & 0xFFFFu);
+                }
+                hex_record(f, 0x00u, (uint16_t)(a & 0xFFFFu), &s->data[off], len);
+                off += len;
+            }
+        }
+        if (img->hexHasStart != 0)
+        {
+            uint8_t sa[4] = { (uint8_t)(img->hexStart >> 24), (uint8_t)(img->hexStart >> 16),
+                              (uint8_t)(img->hexStart >> 8), (uint8_t)img->hexStart };
+            hex_record(f, (uint8_t)img->hexStartType, 0u, sa, 4u);
+        }
+        hex_record(f, 0x01u, 0u, NULL, 0u);
+    }
+
+    if (fclose(f) != 0)
+    {
+        ret = STL_ERR_IO;
+    }
+    return ret;
+}
+
+
+/*******************************************************************************
+ * Function Name: stl_img_free
+ ******************************************************************************/
+void stl_img_free(stl_img_t* img)
+{
+    if (img->format == STL_FMT_HEX)
+    {
+        for (size_t i = 0u; i < img->segCount; i++)
+        {
+            free(img->seg[i].data);
+        }
+    }
+    free(img->seg);
+    free(img->raw);
+    memset(img, 0, sizeof(*img));
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,133 @@
+/*******************************************************************************
+* File Name: stl_checksum.h
+*
+* Description:
+*  This file provides the host-side models of the mtb-stl Flash checksum
+*  kernels and the ELF/HEX image helpers used by stl_flash_checksum.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#if !defined(STL_CHECKSUM_H)
+    #define STL_CHECKSUM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/***************************************
+* Constants (mirror stl/flash and stl/crc)
+***************************************/
+
+/* Flash test algorithms, same values as FLASH_TEST_MODE */
+#define STL_ALGO_FLETCHER64             (0u)
+#define STL_ALGO_CRC32                  (1u)
+
+/* SelfTest_Flash.h */
+#define STL_LARGEST_NUM_OF_SUMS         (359u)
+#define STL_CHECKSUM_INIT_VALUE         (0xFFFFFFFFu)
+#define STL_FLASH_DOUBLE_WORDS_TO_TEST  (512u)
+#define STL_FLASH_RESERVED_CHECKSUM_SIZE (8u)
+
+/* SelfTest_CRC_calc.h */
+#define STL_CRC32_INIT_VALUE            (0xFFFFFFFFu)
+#define STL_CRC32_POLY                  (0xEDB88320u)
+
+/* Return codes */
+#define STL_OK                          (0)
+#define STL_ERR_IO                      (-1)
+#define STL_ERR_FORMAT                  (-2)
+#define STL_ERR_RANGE                   (-3)
+#define STL_ERR_NOMEM                   (-4)
+
+/***************************************
+* Types
+***************************************/
+
+/* Input/output file format */
+typedef enum
+{
+    STL_FMT_AUTO = 0,
+    STL_FMT_ELF,
+    STL_FMT_HEX,
+    STL_FMT_BIN
+} stl_img_format_t;
+
+/* One contiguous block of loadable data at a device (load) address */
+typedef struct
+{
+    uint32_t addr;
+    uint32_t size;
+    uint8_t* data;
+} stl_img_segment_t;
+
+/* Sparse memory image as loaded from ELF, HEX or raw binary */
+typedef struct
+{
+    stl_img_format_t format;
+    stl_img_segment_t* seg;
+    size_t segCount;
+    uint8_t* raw;           /* Raw file contents, kept for in-place ELF/BIN patching */
+    size_t rawSize;
+    uint32_t binBase;       /* Load address of a raw binary */
+    uint32_t hexStart;      /* Start address record of a HEX file */
+    int hexHasStart;
+    int hexStartType;       /* 3 - start segment, 5 - start linear */
+} stl_img_t;
+
+/***************************************
+* Checksum kernels
+***************************************/
+
+/* Fletcher64 exactly as SelfTest_FlashCheckSum computes it when called with
+ * chunkWords double words per call over data[0..len). len must be a multiple of 4. */
+uint64_t stl_fletcher64(const uint8_t* data, uint32_t len, uint32_t chunkWords);
+
+/* Accumulates the SelfTests_CRC32_ACC CRC of data[0..len) onto crc */
+uint32_t stl_crc32_acc(uint32_t crc, const uint8_t* data, size_t len);
+
+/***************************************
+* Image handling
+***************************************/
+
+int stl_img_load(stl_img_t* img, const char* path, stl_img_format_t format, uint32_t binBase);
+
+/* Flattens [start, end) into buf, filling gaps with fill */
+void stl_img_read(const stl_img_t* img, uint32_t start, uint32_t end, uint8_t fill, uint8_t* buf);
+
+/* Overwrites size bytes at addr */
+int stl_img_patch(stl_img_t* img, uint32_t addr, const uint8_t* bytes, uint32_t size);
+
+int stl_img_save(const stl_img_t* img, const char* path);
+
+void stl_img_free(stl_img_t* img);
+
+#endif /* STL_CHECKSUM_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,326 @@
+/*******************************************************************************
+* File Name: stl_flash_checksum.c
+*
+* Description:
+*  Post-link tool computing the SelfTest_FlashCheckSum() reference value
+*  and patching it into the reserved checksum slot.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#include <getopt.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "stl_checksum.h"
+
+
+/*******************************************************************************
+ * Function Name: usage
+ ******************************************************************************/
+static void usage(const char* prog)
+{
+    fprintf(stderr,
+            "Usage: %s [options] <image.elf|image.hex|image.bin>\n"
+            "\n"
+            "Computes the reference value for SelfTest_FlashCheckSum() over [start, end)\n"
+            "and optionally writes it into the FLASH_RESERVED_CHECKSUM_SIZE slot.\n"
+            "\n"
+            "  -s, --start ADDR   StartAddressOfFlash passed to SelfTest_Flash_init() (required)\n"
+            "  -e, --end ADDR     EndAddressOfFlash, e.g. FLASH_END_ADDR (required)\n"
+            "  -a, --algo NAME    fletcher64 (default) or crc32, must match FLASH_TEST_MODE\n"
+            "  -c, --chunk N      DoubleWordsToTest passed to SelfTest_FlashCheckSum()\n"
+            "                     (default %u)\n"
+            "  -f, --fill BYTE    Value of Flash not covered by the image (default 0x00)\n"
+            "  -b, --base ADDR    Load address of a raw binary image (default 0)\n"
+            "  -t, --slot ADDR    Address of the checksum slot (default: end)\n"
+            "  -S, --sector-size N   Also compute one SelfTests_CRC32 value per N-byte sector\n"
+            "  -T, --sector-table ADDR  Address of the sector CRC table to patch\n"
+            "  -o, --output FILE  Write the image with the checksum patched in\n"
+            "  -q, --quiet        Print the checksum only\n",
+            prog, STL_FLASH_DOUBLE_WORDS_TO_TEST);
+}
+
+
+/*******************************************************************************
+ * Function Name: parse_u32
+ ******************************************************************************/
+static int parse_u32(const char* s, uint32_t* out)
+{
+    char* end;
+    unsigned long long v = strtoull(s, &end, 0);
+
+    if ((*s == '\0') || (*end != '\0') || (v > 0xFFFFFFFFull))
+    {
+        return -1;
+    }
+    *out = (uint32_t)v;
+    return 0;
+}
+
+
+int main(int argc, char* argv[])
+{
+    static const struct option opts[] =
+    {
+        { "start",  required_argument, NULL, 's' },
+        { "end",    required_argument, NULL, 'e' },
+        { "algo",   required_argument, NULL, 'a' },
+        { "chunk",  required_argument, NULL, 'c' },
+        { "fill",   required_argument, NULL, 'f' },
+        { "base",   required_argument, NULL, 'b' },
+        { "slot",   required_argument, NULL, 't' },
+        { "sector-size",  required_argument, NULL, 'S' },
+        { "sector-table", required_argument, NULL, 'T' },
+        { "output", required_argument, NULL, 'o' },
+        { "quiet",  no_argument,       NULL, 'q' },
+        { "help",   no_argument,       NULL, 'h' },
+        { NULL,     0,                 NULL, 0   }
+    };
+    uint32_t start = 0u, end = 0u, base = 0u, slot = 0u, fill = 0u;
+    uint32_t sectorSize = 0u, sectorTable = 0u, sectorCount = 0u;
+    uint8_t* table = NULL;
+    uint32_t chunk = STL_FLASH_DOUBLE_WORDS_TO_TEST;
+    uint32_t algo = STL_ALGO_FLETCHER64;
+    int haveStart = 0, haveEnd = 0, haveSlot = 0, haveTable = 0, quiet = 0;
+    const char* output = NULL;
+    stl_img_t img;
+    uint8_t* buf;
+    uint64_t checksum;
+    int c;
+
+    while ((c = getopt_long(argc, argv, "s:e:a:c:f:b:t:S:T:o:qh", opts, NULL)) != -1)
+    {
+        int bad = 0;
+
+        switch (c)
+        {
+            case 's': bad = parse_u32(optarg, &start); haveStart = 1; break;
+            case 'e': bad = parse_u32(optarg, &end); haveEnd = 1; break;
+            case 'c': bad = parse_u32(optarg, &chunk); break;
+            case 'f': bad = (parse_u32(optarg, &fill) != 0) || (fill > 0xFFu); break;
+            case 'b': bad = parse_u32(optarg, &base); break;
+            case 't': bad = parse_u32(optarg, &slot); haveSlot = 1; break;
+            case 'S': bad = parse_u32(optarg, &sectorSize); break;
+            case 'T': bad = parse_u32(optarg, &sectorTable); haveTable = 1; break;
+            case 'o': output = optarg; break;
+            case 'q': quiet = 1; break;
+            case 'a':
+                if (strcmp(optarg, "fletcher64") == 0)
+                {
+                    algo = STL_ALGO_FLETCHER64;
+                }
+                else if (strcmp(optarg, "crc32") == 0)
+                {
+                    algo = STL_ALGO_CRC32;
+                }
+                else
+                {
+                    bad = 1;
+                }
+                break;
+            default:
+                usage(argv[0]);
+                return (c == 'h') ? 0 : 2;
+        }
+        if (bad != 0)
+        {
+            fprintf(stderr, "Invalid value for -%c: %s\n", c, optarg);
+            return 2;
+        }
+    }
+
+    if ((optind != (argc - 1)) || (haveStart == 0) || (haveEnd == 0))
+    {
+        usage(argv[0]);
+        return 2;
+    }
+    if (end < start)
+    {
+        fprintf(stderr, "End address 0x%08" PRIX32 " is below the start address 0x%08" PRIX32 "\n",
+                end, start);
+        return 2;
+    }
+    /* SelfTest_FlashCheckSum() never reaches the end address otherwise */
+    if (((end - start) % 4u) != 0u)
+    {
+        fprintf(stderr, "Range [0x%08" PRIX32 ", 0x%08" PRIX32 ") must be a multiple of 4 bytes\n",
+                start, end);
+        return 2;
+    }
+    if ((chunk == 0u) || (chunk > 0x3FFFFFFFu))
+    {
+        fprintf(stderr, "Chunk must be between 1 and 0x3FFFFFFF double words\n");
+        return 2;
+    }
+    if ((sectorSize != 0u) && (((sectorSize % 4u) != 0u) || (((end - start) % sectorSize) != 0u)))
+    {
+        fprintf(stderr, "Sector size must be a multiple of 4 that divides the range\n");
+        return 2;
+    }
+    if ((haveTable != 0) && (sectorSize == 0u))
+    {
+        fprintf(stderr, "--sector-table requires --sector-size\n");
+        return 2;
+    }
+    if (haveSlot == 0)
+    {
+        slot = end;
+    }
+    if ((slot < end) && ((slot + STL_FLASH_RESERVED_CHECKSUM_SIZE) > start))
+    {
+        fprintf(stderr, "Checksum slot 0x%08" PRIX32 " overlaps the checked range\n", slot);
+        return 2;
+    }
+    if (haveTable != 0)
+    {
+        /* The table would change the sectors it describes, or the checksum */
+        uint64_t tableEnd = (uint64_t)sectorTable + (((uint64_t)(end - start) / sectorSize) * 4u);
+
+        if ((sectorTable < end) && (tableEnd > start))
+        {
+            fprintf(stderr, "Sector table 0x%08" PRIX32 " overlaps the checked range\n",
+                    sectorTable);
+            return 2;
+        }
+        if ((sectorTable < ((uint64_t)slot + STL_FLASH_RESERVED_CHECKSUM_SIZE)) && (tableEnd > slot))
+        {
+            fprintf(stderr, "Sector table 0x%08" PRIX32 " overlaps the checksum slot\n",
+                    sectorTable);
+            return 2;
+        }
+    }
+
+    if (stl_img_load(&img, argv[optind], STL_FMT_AUTO, base) != STL_OK)
+    {
+        fprintf(stderr, "Cannot load image %s\n", argv[optind]);
+        stl_img_free(&img);
+        return 1;
+    }
+
+    buf = malloc(((end - start) != 0u) ? (end - start) : 1u);
+    if (buf == NULL)
+    {
+        fprintf(stderr, "Out of memory\n");
+        stl_img_free(&img);
+        return 1;
+    }
+    stl_img_read(&img, start, end, (uint8_t)fill, buf);
+
+    if (algo == STL_ALGO_FLETCHER64)
+    {
+        checksum = stl_fletcher64(buf, end - start, chunk);
+    }
+    else
+    {
+        /* SelfTest_Flash_init() truncates the expected value to 32 bits */
+        checksum = stl_crc32_acc(STL_CRC32_INIT_VALUE, buf, end - start);
+    }
+
+    if (sectorSize != 0u)
+    {
+        /* Table for SelfTest_Flash_Sector_Init(), little-endian SelfTests_CRC32 per sector */
+        sectorCount = (end - start) / sectorSize;
+        table = malloc((sectorCount != 0u) ? (sectorCount * 4u) : 1u);
+        if (table == NULL)
+        {
+            fprintf(stderr, "Out of memory\n");
+            free(buf);
+            stl_img_free(&img);
+            return 1;
+        }
+        for (uint32_t i = 0u; i < sectorCount; i++)
+        {
+            uint32_t crc = stl_crc32_acc(STL_CRC32_INIT_VALUE, &buf[i * sectorSize], sectorSize);
+            for (uint32_t k = 0u; k < 4u; k++)
+            {
+                table[(i * 4u) + k] = (uint8_t)(crc >> (8u * k));
+            }
+            if (quiet == 0)
+            {
+                printf("sector %4" PRIu32 " [0x%08" PRIX32 "] crc32 = 0x%08" PRIX32 "\n",
+                       i, start + (i * sectorSize), crc);
+            }
+        }
+    }
+    free(buf);
+
+    if (quiet != 0)
+    {
+        printf("0x%016" PRIX64 "\n", checksum);
+    }
+    else
+    {
+        printf("%s [0x%08" PRIX32 ", 0x%08" PRIX32 ") = 0x%016" PRIX64 "\n",
+               (algo == STL_ALGO_FLETCHER64) ? "fletcher64" : "crc32", start, end, checksum);
+    }
+
+    if (output != NULL)
+    {
+        uint8_t le[STL_FLASH_RESERVED_CHECKSUM_SIZE];
+
+        for (uint32_t i = 0u; i < STL_FLASH_RESERVED_CHECKSUM_SIZE; i++)
+        {
+            le[i] = (uint8_t)(checksum >> (8u * i));
+        }
+        if (stl_img_patch(&img, slot, le, sizeof(le)) != STL_OK)
+        {
+            fprintf(stderr, "Checksum slot 0x%08" PRIX32 " is not part of the image; "
+                    "reserve it in the linker script\n", slot);
+            free(table);
+            stl_img_free(&img);
+            return 1;
+        }
+        if ((haveTable != 0) && (stl_img_patch(&img, sectorTable, table, sectorCount * 4u) != STL_OK))
+        {
+            fprintf(stderr, "Sector table 0x%08" PRIX32 " is not part of the image; "
+                    "reserve it in the linker script\n", sectorTable);
+            free(table);
+            stl_img_free(&img);
+            return 1;
+        }
+        if (stl_img_save(&img, output) != STL_OK)
+        {
+            fprintf(stderr, "Cannot write %s\n", output);
+            free(table);
+            stl_img_free(&img);
+            return 1;
+        }
+    }
+
+    free(table);
+    stl_img_free(&img);
+    return 0;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,401 @@
+/*******************************************************************************
+* File Name: stl_pc_layout.c
+*
+* Description:
+*  Host tool selecting the SelfTest_PC_Stubs() stub addresses of each Flash
+*  and RAM region and generating the stub table and linker script fragments.
+*
+*******************************************************************************
+* (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#include <getopt.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Regions on the command line, and stubs per region: 0x5555, 0xAAAA, top, 30 walking zeros */
+#define STL_PC_MAX_REGIONS      (16u)
+#define STL_PC_MAX_STUBS        (STL_PC_MAX_REGIONS * 33u)
+
+/* Section name of Flash stub N, shared by the C file and the linker fragments */
+#define STL_PC_SECTION_FMT      ".stl_pc_stub_%u"
+
+typedef struct
+{
+    uint32_t base;
+    uint32_t size;
+    int ram;
+    const char* mem;
+} stl_region_t;
+
+typedef struct
+{
+    uint32_t address;
+    int ram;
+    const char* mem;
+} stl_stub_t;
+
+
+/*******************************************************************************
+ * Function Name: usage
+ ******************************************************************************/
+static void usage(const char* prog)
+{
+    fprintf(stderr,
+            "Usage: %s [options] <flash|ram>:BASE:SIZE[:MEMORY] ...\n"
+            "\n"
+            "Selects the SelfTest_PC_Stubs() stub addresses of each region so that every\n"
+            "address bit of the region is tested as 0 and 1, and writes:\n"
+            "  PREFIX.h    STL_PC_LAYOUT_COUNT and the STL_PC_LAYOUT_STUBS initializer\n"
+            "  PREFIX.c    STL_PC_STUB() definitions of the Flash stubs\n"
+            "  PREFIX.ld   GNU ld output sections placing the Flash stubs\n"
+            "  PREFIX.icf  IAR ILINK placement of the Flash stubs\n"
+            "  PREFIX.sct  ARM scatter execution regions of the Flash stubs\n"
+            "\n"
+            "MEMORY is the GNU ld memory region of a Flash region (default \"flash\").\n"
+            "\n"
+            "  -w, --walking      Also add one stub per address bit with only that bit cleared\n"
+            "  -r, --reserve SIZE  Bytes at the end of each Flash region without stubs, for\n"
+            "                     example the .flash_checksum slot (default 0)\n"
+            "  -o, --output PREFIX  Output file prefix (default stl_pc_layout)\n"
+            "  -q, --quiet        Do not print the stub list\n",
+            prog);
+}
+
+
+/*******************************************************************************
+ * Function Name: parse_u32
+ ******************************************************************************/
+static int parse_u32(const char* s, uint32_t* out)
+{
+    char* end;
+    unsigned long long v = strtoull(s, &end, 0);
+
+    if ((*s == '\0') || (*end != '\0') || (v > 0xFFFFFFFFull))
+    {
+        return -1;
+    }
+    *out = (uint32_t)v;
+    return 0;
+}
+
+
+/*******************************************************************************
+ * Function Name: parse_region
+ ******************************************************************************/
+static int parse_region(char* arg, stl_region_t* region)
+{
+    char* kind = strtok(arg, ":");
+    char* base = strtok(NULL, ":");
+    char* size = strtok(NULL, ":");
+    char* mem = strtok(NULL, ":");
+
+    if ((kind == NULL) || (base == NULL) || (size == NULL) || (strtok(NULL, ":") != NULL))
+    {
+        return -1;
+    }
+    if (strcmp(kind, "flash") == 0)
+    {
+        region->ram = 0;
+    }
+    else if (strcmp(kind, "ram") == 0)
+    {
+        region->ram = 1;
+    }
+    else
+    {
+        return -1;
+    }
+    region->mem = (mem != NULL) ? mem : "flash";
+    if ((parse_u32(base, &region->base) != 0) || (parse_u32(size, &region->size) != 0))
+    {
+        return -1;
+    }
+    /* Stubs are whole words, and the region must not wrap around the address space */
+    if (((region->base % 4u) != 0u) || (region->size < 8u) ||
+        ((region->size - 1u) > (0xFFFFFFFFu - region->base)))
+    {
+        return -1;
+    }
+    return 0;
+}
+
+
+/*******************************************************************************
+ * Function Name: fit_offset
+ ******************************************************************************/
+static uint32_t fit_offset(uint32_t offset, uint32_t last)
+{
+    /* Clear the highest bits until the pattern lies within the region */
+    while (offset > last)
+    {
+        uint32_t bit = 0x80000000u;
+
+        while ((offset & bit) == 0u)
+        {
+            bit >>= 1u;
+        }
+        offset &= ~bit;
+    }
+    return offset;
+}
+
+
+/*******************************************************************************
+ * Function Name: add_stub
+ ******************************************************************************/
+static void add_stub(stl_stub_t* stubs, uint32_t* count, const stl_region_t* region,
+                     uint32_t offset)
+{
+    uint32_t address = region->base + offset;
+
+    for (uint32_t i = 0u; i < *count; i++)
+    {
+        if (stubs[i].address == address)
+        {
+            return;
+        }
+    }
+    stubs[*count].address = address;
+    stubs[*count].ram = region->ram;
+    stubs[*count].mem = region->mem;
+    (*count)++;
+}
+
+
+/*******************************************************************************
+ * Function Name: compare_stubs
+ ******************************************************************************/
+static int compare_stubs(const void* a, const void* b)
+{
+    uint32_t x = ((const stl_stub_t*)a)->address;
+    uint32_t y = ((const stl_stub_t*)b)->address;
+
+    return (x > y) - (x < y);
+}
+
+
+/*******************************************************************************
+ * Function Name: open_output
+ ******************************************************************************/
+static FILE* open_output(const char* prefix, const char* ext, char* name, size_t len)
+{
+    FILE* f;
+
+    (void)snprintf(name, len, "%s%s", prefix, ext);
+    f = fopen(name, "w");
+    if (f == NULL)
+    {
+        fprintf(stderr, "Cannot create %s\n", name);
+    }
+    return f;
+}
+
+
+/*******************************************************************************
+ * Function Name: write_outputs
+ ******************************************************************************/
+static int write_outputs(const char* prefix, const stl_stub_t* stubs, uint32_t count)
+{
+    static const char* const exts[] = { ".h", ".c", ".ld", ".icf", ".sct" };
+    const char* base = strrchr(prefix, '/');
+    char name[4096];
+    char section[32];
+    FILE* f[5];
+    uint32_t n = 0u;
+    int rc = 0;
+
+    base = (base != NULL) ? (base + 1) : prefix;
+    for (uint32_t i = 0u; i < 5u; i++)
+    {
+        f[i] = open_output(prefix, exts[i], name, sizeof(name));
+        if (f[i] == NULL)
+        {
+            for (uint32_t k = 0u; k < i; k++)
+            {
+                (void)fclose(f[k]);
+            }
+            return 1;
+        }
+        /* Scatter files without a preprocessor only accept ';' comments */
+        fprintf(f[i], (i == 4u) ? "; Generated by stl_pc_layout, do not edit\n\n" :
+                "/* Generated by stl_pc_layout, do not edit */\n\n");
+    }
+
+    fprintf(f[0], "#if !defined(STL_PC_LAYOUT_H)\n#define STL_PC_LAYOUT_H\n\n");
+    fprintf(f[0], "#define STL_PC_LAYOUT_COUNT     (%" PRIu32 "u)\n\n", count);
+    fprintf(f[0], "/* Initializer of stl_pc_stub_t[STL_PC_LAYOUT_COUNT] */\n");
+    fprintf(f[0], "#define STL_PC_LAYOUT_STUBS     \\\n{ \\\n");
+    fprintf(f[1], "#include \"SelfTest_CPU.h\"\n#include \"%s.h\"\n\n", base);
+    fprintf(f[3], "keep\n{");
+
+    for (uint32_t i = 0u; i < count; i++)
+    {
+        fprintf(f[0], "    { 0x%08" PRIX32 "UL, %s }, \\\n", stubs[i].address,
+                (stubs[i].ram != 0) ? "true" : "false");
+        if (stubs[i].ram != 0)
+        {
+            continue;
+        }
+        (void)snprintf(section, sizeof(section), STL_PC_SECTION_FMT, (unsigned)n);
+        fprintf(f[1], "STL_PC_STUB(stlPcStub%" PRIu32 ", \"%s\");\n", n, section);
+        fprintf(f[2], "%s 0x%08" PRIX32 " :\n{\n    KEEP(*(%s))\n} > %s\n\n",
+                section, stubs[i].address, section, stubs[i].mem);
+        fprintf(f[3], "%s\n    section %s", (n == 0u) ? "" : ",", section);
+        fprintf(f[4], "STL_PC_STUB_%" PRIu32 " 0x%08" PRIX32 " FIXED\n{\n    *(%s)\n}\n\n",
+                n, stubs[i].address, section);
+        n++;
+    }
+
+    fprintf(f[0], "}\n\n#endif /* STL_PC_LAYOUT_H */\n");
+    fprintf(f[3], "\n};\n\n");
+    n = 0u;
+    for (uint32_t i = 0u; i < count; i++)
+    {
+        if (stubs[i].ram == 0)
+        {
+            (void)snprintf(section, sizeof(section), STL_PC_SECTION_FMT, (unsigned)n);
+            fprintf(f[3], "place at address mem:0x%08" PRIX32 " { readonly section %s };\n",
+                    stubs[i].address, section);
+            n++;
+        }
+    }
+
+    for (uint32_t i = 0u; i < 5u; i++)
+    {
+        if (fclose(f[i]) != 0)
+        {
+            rc = 1;
+        }
+    }
+    return rc;
+}
+
+
+int main(int argc, char* argv[])
+{
+    static const struct option opts[] =
+    {
+        { "walking", no_argument,       NULL, 'w' },
+        { "reserve", required_argument, NULL, 'r' },
+        { "output",  required_argument, NULL, 'o' },
+        { "quiet",   no_argument,       NULL, 'q' },
+        { "help",    no_argument,       NULL, 'h' },
+        { NULL,      0,                 NULL, 0   }
+    };
+    static stl_region_t regions[STL_PC_MAX_REGIONS];
+    static stl_stub_t stubs[STL_PC_MAX_STUBS];
+    const char* prefix = "stl_pc_layout";
+    uint32_t regionCount = 0u;
+    uint32_t count = 0u;
+    uint32_t reserve = 0u;
+    int walking = 0, quiet = 0;
+    int c;
+
+    while ((c = getopt_long(argc, argv, "wr:o:qh", opts, NULL)) != -1)
+    {
+        switch (c)
+        {
+            case 'w': walking = 1; break;
+            case 'r':
+                if ((parse_u32(optarg, &reserve) != 0) || ((reserve % 4u) != 0u))
+                {
+                    fprintf(stderr, "Invalid reserved size %s, expected a multiple of 4\n",
+                            optarg);
+                    return 2;
+                }
+                break;
+            case 'o': prefix = optarg; break;
+            case 'q': quiet = 1; break;
+            default:
+                usage(argv[0]);
+                return (c == 'h') ? 0 : 2;
+        }
+    }
+
+    if ((optind == argc) || ((uint32_t)(argc - optind) > STL_PC_MAX_REGIONS))
+    {
+        usage(argv[0]);
+        return 2;
+    }
+    for (int i = optind; i < argc; i++)
+    {
+        char arg[256];
+
+        (void)snprintf(arg, sizeof(arg), "%s", argv[i]);
+        if (parse_region(argv[i], &regions[regionCount]) != 0)
+        {
+            fprintf(stderr, "Invalid region %s, expected <flash|ram>:BASE:SIZE[:MEMORY] with "
+                    "a 4-byte aligned BASE and SIZE of at least 8\n", arg);
+            return 2;
+        }
+        /* The reserved tail of a Flash region must leave room for two stubs */
+        if ((regions[regionCount].ram == 0) && (reserve > (regions[regionCount].size - 8u)))
+        {
+            fprintf(stderr, "Region %s is too small for a reserved size of 0x%" PRIX32 "\n",
+                    arg, reserve);
+            return 2;
+        }
+        regionCount++;
+    }
+
+    for (uint32_t r = 0u; r < regionCount; r++)
+    {
+        const stl_region_t* region = &regions[r];
+        uint32_t size = (region->ram != 0) ? region->size : (region->size - reserve);
+        uint32_t last = (size - 4u) & ~3u;
+
+        add_stub(stubs, &count, region, fit_offset(0x55555554u, last));
+        add_stub(stubs, &count, region, fit_offset(0xAAAAAAA8u, last));
+        add_stub(stubs, &count, region, last);
+        if (walking != 0)
+        {
+            for (uint32_t b = 2u; b < 32u; b++)
+            {
+                if ((last & (1UL << b)) != 0u)
+                {
+                    add_stub(stubs, &count, region, last & ~(1UL << b));
+                }
+            }
+        }
+    }
+    qsort(stubs, count, sizeof(stubs[0]), compare_stubs);
+
+    if (quiet == 0)
+    {
+        for (uint32_t i = 0u; i < count; i++)
+        {
+            printf("stub %3" PRIu32 " 0x%08" PRIX32 " %s\n", i, stubs[i].address,
+                   (stubs[i].ram != 0) ? "ram" : "flash");
+        }
+    }
+    return write_outputs(prefix, stubs, count);
+}